@@ -11,6 +11,20 @@ AbstractTriangulation::AbstractTriangulation() {
 AbstractTriangulation::~AbstractTriangulation() {
 }
 
+const vector<vector<SimplexId>> *
+  AbstractTriangulation::getUnavailableList(const string &getterName) const {
+
+  stringstream msg;
+  msg << "[AbstractTriangulation] " << getterName
+      << "(): relation not available as a list for this triangulation type."
+      << endl;
+  msg << "[AbstractTriangulation] Please use " << getterName
+      << "View() instead." << endl;
+  dMsg(cerr, msg.str(), Debug::fatalMsg);
+
+  return NULL;
+}
+
 int AbstractTriangulation::clear() {
 
   hasPreprocessedBoundaryEdges_ = false;
@@ -66,7 +80,8 @@ size_t AbstractTriangulation::tableTableFootprint(
   const string tableName,
   stringstream *msg) const {
 
-  size_t localByteNumber = 0;
+  // account for the bookkeeping of each (separately allocated) entry
+  size_t localByteNumber = table.size() * sizeof(vector<itemType>);
 
   for(size_t i = 0; i < table.size(); i++) {
     localByteNumber += table[i].size() * sizeof(itemType);
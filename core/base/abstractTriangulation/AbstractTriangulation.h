@@ -16,11 +16,253 @@
 #include <Geometry.h>
 #include <Wrapper.h>
 
+#include <cstddef>
+#include <iterator>
+
 namespace ttk {
 
   class AbstractTriangulation : public Wrapper {
 
   public:
+    /// \brief Lightweight read-only view on a whole relation of the
+    /// triangulation (for instance, the neighbors of all the vertices).
+    ///
+    /// Entries are computed on the fly through the per-simplex getters
+    /// (getVertexNeighbor(), getEdgeStar(), etc.), hence a view does not
+    /// allocate any memory, whatever the triangulation type. In particular,
+    /// implicit triangulations keep their small memory footprint.
+    ///
+    /// Usage:
+    /// \code
+    /// const auto neighbors = triangulation->getVertexNeighborsView();
+    /// for(SimplexId i = 0; i < neighbors.size(); i++)
+    ///   for(const SimplexId neighborId : neighbors[i])
+    ///     ...
+    /// \endcode
+    ///
+    /// Views, entries and iterators only refer to the triangulation, not to
+    /// each other: for instance, the entry returned by
+    /// triangulation->getVertexNeighborsView()[v] can be iterated after the
+    /// temporary view is destroyed.
+    ///
+    /// \warning Views, entries and iterators are only valid as long as the
+    /// triangulation they have been obtained from exists (and is not
+    /// modified), and the same pre-processing requirements as for the
+    /// corresponding per-simplex getters apply.
+    class RelationView {
+
+    public:
+      typedef SimplexId (AbstractTriangulation::*NumberGetter)(
+        const SimplexId &) const;
+      typedef int (AbstractTriangulation::*ItemGetter)(const SimplexId &,
+                                                       const int &,
+                                                       SimplexId &) const;
+
+      /// Items of one entry of the relation.
+      class Entry {
+
+      public:
+        /// Random access iterator on the items of an entry. As for
+        /// std::vector<bool>, items are returned by value.
+        class const_iterator {
+        public:
+          typedef std::random_access_iterator_tag iterator_category;
+          typedef SimplexId value_type;
+          typedef std::ptrdiff_t difference_type;
+          typedef const SimplexId *pointer;
+          typedef SimplexId reference;
+
+          const_iterator()
+            : triangulation_(NULL), itemGetter_(NULL), id_(-1), localId_(0) {
+          }
+
+          const_iterator(const AbstractTriangulation *triangulation,
+                         ItemGetter itemGetter,
+                         const SimplexId &id,
+                         const difference_type &localId)
+            : triangulation_(triangulation), itemGetter_(itemGetter), id_(id),
+              localId_(localId) {
+          }
+
+          inline reference operator*() const {
+            SimplexId itemId = -1;
+            (triangulation_->*itemGetter_)(id_, localId_, itemId);
+            return itemId;
+          }
+
+          inline reference operator[](const difference_type &n) const {
+            return *(*this + n);
+          }
+
+          inline const_iterator &operator++() {
+            localId_++;
+            return *this;
+          }
+
+          inline const_iterator operator++(int) {
+            const_iterator it(*this);
+            localId_++;
+            return it;
+          }
+
+          inline const_iterator &operator--() {
+            localId_--;
+            return *this;
+          }
+
+          inline const_iterator operator--(int) {
+            const_iterator it(*this);
+            localId_--;
+            return it;
+          }
+
+          inline const_iterator &operator+=(const difference_type &n) {
+            localId_ += n;
+            return *this;
+          }
+
+          inline const_iterator &operator-=(const difference_type &n) {
+            localId_ -= n;
+            return *this;
+          }
+
+          inline const_iterator operator+(const difference_type &n) const {
+            return const_iterator(*this) += n;
+          }
+
+          friend inline const_iterator operator+(const difference_type &n,
+                                                 const const_iterator &it) {
+            return it + n;
+          }
+
+          inline const_iterator operator-(const difference_type &n) const {
+            return const_iterator(*this) -= n;
+          }
+
+          inline difference_type operator-(const const_iterator &other) const {
+            return localId_ - other.localId_;
+          }
+
+          inline bool operator==(const const_iterator &other) const {
+            return localId_ == other.localId_;
+          }
+
+          inline bool operator!=(const const_iterator &other) const {
+            return localId_ != other.localId_;
+          }
+
+          inline bool operator<(const const_iterator &other) const {
+            return localId_ < other.localId_;
+          }
+
+          inline bool operator>(const const_iterator &other) const {
+            return localId_ > other.localId_;
+          }
+
+          inline bool operator<=(const const_iterator &other) const {
+            return localId_ <= other.localId_;
+          }
+
+          inline bool operator>=(const const_iterator &other) const {
+            return localId_ >= other.localId_;
+          }
+
+        protected:
+          const AbstractTriangulation *triangulation_;
+          ItemGetter itemGetter_;
+          SimplexId id_;
+          difference_type localId_;
+        };
+
+        Entry(const RelationView &view, const SimplexId &id)
+          : triangulation_(view.triangulation_),
+            itemGetter_(view.itemGetter_), id_(id),
+            size_(view.getItemNumber(id)) {
+        }
+
+        inline const_iterator begin() const {
+          return const_iterator(triangulation_, itemGetter_, id_, 0);
+        }
+
+        inline const_iterator end() const {
+          return const_iterator(triangulation_, itemGetter_, id_, size_);
+        }
+
+        inline bool empty() const {
+          return !size_;
+        }
+
+        inline SimplexId size() const {
+          return size_;
+        }
+
+        inline SimplexId operator[](const int &localId) const {
+          SimplexId itemId = -1;
+          (triangulation_->*itemGetter_)(id_, localId, itemId);
+          return itemId;
+        }
+
+      protected:
+        const AbstractTriangulation *triangulation_;
+        ItemGetter itemGetter_;
+        SimplexId id_, size_;
+      };
+
+      RelationView()
+        : triangulation_(NULL), entryNumber_(0), numberGetter_(NULL),
+          itemGetter_(NULL), arity_(0) {
+      }
+
+      /// \param triangulation Input triangulation.
+      /// \param entryNumber Number of entries of the relation.
+      /// \param numberGetter Per-entry item number getter (NULL if all the
+      /// entries have \p arity items).
+      /// \param itemGetter Per-entry item getter.
+      /// \param arity Number of items per entry (if \p numberGetter is NULL).
+      RelationView(const AbstractTriangulation *triangulation,
+                   const SimplexId &entryNumber,
+                   NumberGetter numberGetter,
+                   ItemGetter itemGetter,
+                   const int &arity = 0)
+        : triangulation_(triangulation), entryNumber_(entryNumber),
+          numberGetter_(numberGetter), itemGetter_(itemGetter),
+          arity_(arity) {
+      }
+
+      inline bool empty() const {
+        return !entryNumber_;
+      }
+
+      /// Number of entries of the relation.
+      inline SimplexId size() const {
+        return entryNumber_;
+      }
+
+      inline SimplexId getItemNumber(const SimplexId &id) const {
+        if(numberGetter_)
+          return (triangulation_->*numberGetter_)(id);
+        return arity_;
+      }
+
+      inline SimplexId getItem(const SimplexId &id,
+                               const int &localId) const {
+        SimplexId itemId = -1;
+        (triangulation_->*itemGetter_)(id, localId, itemId);
+        return itemId;
+      }
+
+      inline Entry operator[](const SimplexId &id) const {
+        return Entry(*this, id);
+      }
+
+    protected:
+      const AbstractTriangulation *triangulation_;
+      SimplexId entryNumber_;
+      NumberGetter numberGetter_;
+      ItemGetter itemGetter_;
+      int arity_;
+    };
+
     AbstractTriangulation();
 
     virtual ~AbstractTriangulation();
@@ -35,7 +277,9 @@ namespace ttk {
 
     virtual SimplexId getCellEdgeNumber(const SimplexId &cellId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getCellEdges() = 0;
+    virtual const std::vector<std::vector<SimplexId>> *getCellEdges() {
+      return getUnavailableList("getCellEdges");
+    }
 
     virtual int getCellNeighbor(const SimplexId &cellId,
                                 const int &localNeighborId,
@@ -43,7 +287,9 @@ namespace ttk {
 
     virtual SimplexId getCellNeighborNumber(const SimplexId &cellId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getCellNeighbors() = 0;
+    virtual const std::vector<std::vector<SimplexId>> *getCellNeighbors() {
+      return getUnavailableList("getCellNeighbors");
+    }
 
     virtual int getCellTriangle(const SimplexId &cellId,
                                 const int &localTriangleId,
@@ -51,7 +297,9 @@ namespace ttk {
 
     virtual SimplexId getCellTriangleNumber(const SimplexId &cellId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getCellTriangles() = 0;
+    virtual const std::vector<std::vector<SimplexId>> *getCellTriangles() {
+      return getUnavailableList("getCellTriangles");
+    }
 
     virtual int getCellVertex(const SimplexId &cellId,
                               const int &localVertexId,
@@ -69,7 +317,9 @@ namespace ttk {
 
     virtual SimplexId getEdgeLinkNumber(const SimplexId &edgeId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getEdgeLinks() = 0;
+    virtual const std::vector<std::vector<SimplexId>> *getEdgeLinks() {
+      return getUnavailableList("getEdgeLinks");
+    }
 
     virtual int getEdgeStar(const SimplexId &edgeId,
                             const int &localStarId,
@@ -77,7 +327,9 @@ namespace ttk {
 
     virtual SimplexId getEdgeStarNumber(const SimplexId &edgeId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getEdgeStars() = 0;
+    virtual const std::vector<std::vector<SimplexId>> *getEdgeStars() {
+      return getUnavailableList("getEdgeStars");
+    }
 
     virtual int getEdgeTriangle(const SimplexId &edgeId,
                                 const int &localTriangleId,
@@ -85,7 +337,9 @@ namespace ttk {
 
     virtual SimplexId getEdgeTriangleNumber(const SimplexId &edgeId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getEdgeTriangles() = 0;
+    virtual const std::vector<std::vector<SimplexId>> *getEdgeTriangles() {
+      return getUnavailableList("getEdgeTriangles");
+    }
 
     virtual int getEdgeVertex(const SimplexId &edgeId,
                               const int &localVertexId,
@@ -99,7 +353,9 @@ namespace ttk {
 
     virtual SimplexId getNumberOfVertices() const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getTriangles() = 0;
+    virtual const std::vector<std::vector<SimplexId>> *getTriangles() {
+      return getUnavailableList("getTriangles");
+    }
 
     virtual int getTriangleEdge(const SimplexId &triangleId,
                                 const int &localEdgeId,
@@ -108,7 +364,9 @@ namespace ttk {
     virtual SimplexId
       getTriangleEdgeNumber(const SimplexId &triangleId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getTriangleEdges() = 0;
+    virtual const std::vector<std::vector<SimplexId>> *getTriangleEdges() {
+      return getUnavailableList("getTriangleEdges");
+    }
 
     virtual int getTriangleLink(const SimplexId &triangleId,
                                 const int &localLinkId,
@@ -117,7 +375,9 @@ namespace ttk {
     virtual SimplexId
       getTriangleLinkNumber(const SimplexId &triangleId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getTriangleLinks() = 0;
+    virtual const std::vector<std::vector<SimplexId>> *getTriangleLinks() {
+      return getUnavailableList("getTriangleLinks");
+    }
 
     virtual int getTriangleStar(const SimplexId &triangleId,
                                 const int &localStarId,
@@ -126,7 +386,9 @@ namespace ttk {
     virtual SimplexId
       getTriangleStarNumber(const SimplexId &triangleId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getTriangleStars() = 0;
+    virtual const std::vector<std::vector<SimplexId>> *getTriangleStars() {
+      return getUnavailableList("getTriangleStars");
+    }
 
     virtual int getTriangleVertex(const SimplexId &triangleId,
                                   const int &localVertexId,
@@ -138,7 +400,9 @@ namespace ttk {
 
     virtual SimplexId getVertexEdgeNumber(const SimplexId &vertexId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getVertexEdges() = 0;
+    virtual const std::vector<std::vector<SimplexId>> *getVertexEdges() {
+      return getUnavailableList("getVertexEdges");
+    }
 
     virtual int getVertexLink(const SimplexId &vertexId,
                               const int &localLinkId,
@@ -146,7 +410,9 @@ namespace ttk {
 
     virtual SimplexId getVertexLinkNumber(const SimplexId &vertexId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getVertexLinks() = 0;
+    virtual const std::vector<std::vector<SimplexId>> *getVertexLinks() {
+      return getUnavailableList("getVertexLinks");
+    }
 
     virtual int getVertexNeighbor(const SimplexId &vertexId,
                                   const int &localNeighborId,
@@ -155,7 +421,9 @@ namespace ttk {
     virtual SimplexId
       getVertexNeighborNumber(const SimplexId &vertexId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getVertexNeighbors() = 0;
+    virtual const std::vector<std::vector<SimplexId>> *getVertexNeighbors() {
+      return getUnavailableList("getVertexNeighbors");
+    }
 
     virtual int getVertexPoint(const SimplexId &vertexId,
                                float &x,
@@ -168,7 +436,9 @@ namespace ttk {
 
     virtual SimplexId getVertexStarNumber(const SimplexId &vertexId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getVertexStars() = 0;
+    virtual const std::vector<std::vector<SimplexId>> *getVertexStars() {
+      return getUnavailableList("getVertexStars");
+    }
 
     virtual int getVertexTriangle(const SimplexId &vertexId,
                                   const int &localTriangleId,
@@ -177,7 +447,106 @@ namespace ttk {
     virtual SimplexId
       getVertexTriangleNumber(const SimplexId &vertexId) const = 0;
 
-    virtual const std::vector<std::vector<SimplexId>> *getVertexTriangles() = 0;
+    virtual const std::vector<std::vector<SimplexId>> *getVertexTriangles() {
+      return getUnavailableList("getVertexTriangles");
+    }
+
+    // Allocation-free counterparts of the whole-relation getters above (see
+    // RelationView).
+
+    inline RelationView getCellEdgesView() const {
+      return RelationView(this, getNumberOfCells(),
+                          &AbstractTriangulation::getCellEdgeNumber,
+                          &AbstractTriangulation::getCellEdge);
+    }
+
+    inline RelationView getCellNeighborsView() const {
+      return RelationView(this, getNumberOfCells(),
+                          &AbstractTriangulation::getCellNeighborNumber,
+                          &AbstractTriangulation::getCellNeighbor);
+    }
+
+    inline RelationView getCellTrianglesView() const {
+      return RelationView(this, getNumberOfCells(),
+                          &AbstractTriangulation::getCellTriangleNumber,
+                          &AbstractTriangulation::getCellTriangle);
+    }
+
+    inline RelationView getEdgeLinksView() const {
+      return RelationView(this, getNumberOfEdges(),
+                          &AbstractTriangulation::getEdgeLinkNumber,
+                          &AbstractTriangulation::getEdgeLink);
+    }
+
+    inline RelationView getEdgesView() const {
+      return RelationView(this, getNumberOfEdges(), NULL,
+                          &AbstractTriangulation::getEdgeVertex, 2);
+    }
+
+    inline RelationView getEdgeStarsView() const {
+      return RelationView(this, getNumberOfEdges(),
+                          &AbstractTriangulation::getEdgeStarNumber,
+                          &AbstractTriangulation::getEdgeStar);
+    }
+
+    inline RelationView getEdgeTrianglesView() const {
+      return RelationView(this, getNumberOfEdges(),
+                          &AbstractTriangulation::getEdgeTriangleNumber,
+                          &AbstractTriangulation::getEdgeTriangle);
+    }
+
+    inline RelationView getTrianglesView() const {
+      return RelationView(this, getNumberOfTriangles(), NULL,
+                          &AbstractTriangulation::getTriangleVertex, 3);
+    }
+
+    inline RelationView getTriangleEdgesView() const {
+      return RelationView(this, getNumberOfTriangles(),
+                          &AbstractTriangulation::getTriangleEdgeNumber,
+                          &AbstractTriangulation::getTriangleEdge);
+    }
+
+    inline RelationView getTriangleLinksView() const {
+      return RelationView(this, getNumberOfTriangles(),
+                          &AbstractTriangulation::getTriangleLinkNumber,
+                          &AbstractTriangulation::getTriangleLink);
+    }
+
+    inline RelationView getTriangleStarsView() const {
+      return RelationView(this, getNumberOfTriangles(),
+                          &AbstractTriangulation::getTriangleStarNumber,
+                          &AbstractTriangulation::getTriangleStar);
+    }
+
+    inline RelationView getVertexEdgesView() const {
+      return RelationView(this, getNumberOfVertices(),
+                          &AbstractTriangulation::getVertexEdgeNumber,
+                          &AbstractTriangulation::getVertexEdge);
+    }
+
+    inline RelationView getVertexLinksView() const {
+      return RelationView(this, getNumberOfVertices(),
+                          &AbstractTriangulation::getVertexLinkNumber,
+                          &AbstractTriangulation::getVertexLink);
+    }
+
+    inline RelationView getVertexNeighborsView() const {
+      return RelationView(this, getNumberOfVertices(),
+                          &AbstractTriangulation::getVertexNeighborNumber,
+                          &AbstractTriangulation::getVertexNeighbor);
+    }
+
+    inline RelationView getVertexStarsView() const {
+      return RelationView(this, getNumberOfVertices(),
+                          &AbstractTriangulation::getVertexStarNumber,
+                          &AbstractTriangulation::getVertexStar);
+    }
+
+    inline RelationView getVertexTrianglesView() const {
+      return RelationView(this, getNumberOfVertices(),
+                          &AbstractTriangulation::getVertexTriangleNumber,
+                          &AbstractTriangulation::getVertexTriangle);
+    }
 
     virtual inline bool hasPreprocessedBoundaryEdges() const {
       return hasPreprocessedBoundaryEdges_;
@@ -496,6 +865,12 @@ namespace ttk {
       return table.size() * sizeof(itemType);
     }
 
+    /// Default implementation of the whole-relation list getters, for the
+    /// triangulation types which do not store their relations in this form
+    /// (see the corresponding views instead).
+    const std::vector<std::vector<SimplexId>> *
+      getUnavailableList(const std::string &getterName) const;
+
     template <class itemType>
     size_t tableTableFootprint(const std::vector<std::vector<itemType>> &table,
                                const std::string tableName = "",
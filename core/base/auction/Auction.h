@@ -67,6 +67,7 @@ namespace ttk {
       geometricalFactor_ = geometricalFactor;
       lambda_ = lambda;
       use_kdt_ = use_kdTree;
+      use_jacobi_ = false;
       diagonal_goods_ = new GoodDiagram<dataType>;
       delete_bidders_ = true;
       delete_kdTree_ = true;
@@ -88,6 +89,7 @@ namespace ttk {
 
       delete_bidders_ = false;
       delete_kdTree_ = false;
+      use_jacobi_ = false;
       bidders_ = bidders;
       goods_ = goods;
       diagonal_goods_ = new GoodDiagram<dataType>;
@@ -143,9 +145,11 @@ namespace ttk {
     };
 
     void runAuctionRound(int &n_biddings, const int kdt_index = 0);
+    void runJacobiAuctionRound(int &n_biddings, const int kdt_index = 0);
     dataType getMatchingsAndDistance(std::vector<matchingTuple> *matchings,
                                      bool get_diagonal_matches = false);
-    dataType run(std::vector<matchingTuple> *matchings);
+    dataType run(std::vector<matchingTuple> *matchings,
+                 const int kdt_index = 0);
     dataType getMaximalPrice();
 
     void BuildAuctionDiagrams(BidderDiagram<dataType> *BD,
@@ -205,8 +209,7 @@ namespace ttk {
         b.setPositionInAuction(bidders_->size());
         bidders_->addBidder(b);
       }
-      if(bidders_->size() > 0) {
-        use_kdt_ = true;
+      if(use_kdt_ && bidders_->size() > 0) {
         this->buildKDTree();
       } else {
         use_kdt_ = false;
@@ -258,6 +261,12 @@ namespace ttk {
         = kdt_->build(coordinates.data(), goods_->size(), dimension);
     }
 
+    // Jacobi mode: the unassigned off-diagonal bidders of a pass all bid in
+    // parallel against the same prices, the highest bid per good wins
+    void setUseJacobi(const bool useJacobi) {
+      use_jacobi_ = useJacobi;
+    }
+
     void setEpsilon(dataType epsilon) {
       epsilon_ = epsilon;
     }
@@ -266,7 +275,8 @@ namespace ttk {
       dataType max_persistence = 0;
       for(int i = 0; i < bidders_->size(); i++) {
         Bidder<dataType> &b = bidders_->get(i);
-        dataType persistence = b.getPersistence();
+        // weighted births and deaths may come in reverse order
+        dataType persistence = std::abs(b.getPersistence());
         if(persistence > max_persistence) {
           max_persistence = persistence;
         }
@@ -274,7 +284,7 @@ namespace ttk {
 
       for(int i = 0; i < goods_->size(); i++) {
         Good<dataType> &g = goods_->get(i);
-        dataType persistence = g.getPersistence();
+        dataType persistence = std::abs(g.getPersistence());
         if(persistence > max_persistence) {
           max_persistence = persistence;
         }
@@ -379,6 +389,11 @@ namespace ttk {
     // pair sad-max) lambda = 0 : saddle (bad stability) lambda = 1/2 : middle
     // of the 2 critical points of the pair
     bool use_kdt_;
+    bool use_jacobi_;
+
+    int runBidding(const int pos,
+                   const dataType epsilon,
+                   const int kdt_index = 0);
 
     // KDTree<dataType>* kdt_;
   };
@@ -145,14 +145,15 @@ namespace ttk {
     if(is_diagonal_ && g.isDiagonal()) {
       return 0;
     } else if(is_diagonal_) {
+      // diagonal actors have no pair length: the one of g is used
       return geometricalFactor
                * (2 * pow(abs<dataType>(g.y_ / 2 - g.x_ / 2), wasserstein))
-             + (1 - geometricalFactor) * getPairGeometricalLength(wasserstein);
+             + (1 - geometricalFactor)
+                 * g.getPairGeometricalLength(wasserstein);
     } else if(g.isDiagonal()) {
       return geometricalFactor
                * (2 * pow(abs<dataType>(y_ / 2 - x_ / 2), wasserstein))
-             + (1 - geometricalFactor)
-                 * g.getPairGeometricalLength(wasserstein);
+             + (1 - geometricalFactor) * getPairGeometricalLength(wasserstein);
     } else {
       return geometricalFactor
                * (pow(abs<dataType>(x_ - g.x_), wasserstein)
@@ -205,11 +206,11 @@ namespace ttk {
       dataType coords_z;
 
       this->geom_pair_length_[0]
-        = abs(std::get<7>(tuple) - std::get<11>(tuple));
+        = std::abs(std::get<7>(tuple) - std::get<11>(tuple));
       this->geom_pair_length_[1]
-        = abs(std::get<8>(tuple) - std::get<12>(tuple));
+        = std::abs(std::get<8>(tuple) - std::get<12>(tuple));
       this->geom_pair_length_[2]
-        = abs(std::get<9>(tuple) - std::get<13>(tuple));
+        = std::abs(std::get<9>(tuple) - std::get<13>(tuple));
 
       if(type2 == BLocalMax) {
         coords_x
@@ -369,11 +370,11 @@ namespace ttk {
       dataType coords_z;
 
       this->geom_pair_length_[0]
-        = abs(std::get<7>(tuple) - std::get<11>(tuple));
+        = std::abs(std::get<7>(tuple) - std::get<11>(tuple));
       this->geom_pair_length_[1]
-        = abs(std::get<8>(tuple) - std::get<12>(tuple));
+        = std::abs(std::get<8>(tuple) - std::get<12>(tuple));
       this->geom_pair_length_[2]
-        = abs(std::get<9>(tuple) - std::get<13>(tuple));
+        = std::abs(std::get<9>(tuple) - std::get<13>(tuple));
 
       if(type2 == BLocalMax) {
         coords_x
@@ -424,6 +425,24 @@ namespace ttk {
                       KDTree<dataType> *kdt,
                       const int kdt_index = 0);
 
+    // Off-diagonal bid computed against the current prices, without
+    // assigning anything (the caller resolves the conflicts between bids)
+    Good<dataType> *computeBid(GoodDiagram<dataType> *goods,
+                               Good<dataType> &twinGood,
+                               int wasserstein,
+                               dataType epsilon,
+                               double geometricalFactor,
+                               dataType &new_price);
+    Good<dataType> *computeKDTBid(GoodDiagram<dataType> *goods,
+                                  Good<dataType> &twinGood,
+                                  int wasserstein,
+                                  dataType epsilon,
+                                  double geometricalFactor,
+                                  KDTree<dataType> *kdt,
+                                  KDTree<dataType> *&closest_kdt,
+                                  dataType &new_price,
+                                  const int kdt_index = 0);
+
     // Diagonal Bidding (with or without the use of a KD-Tree
     int runDiagonalBidding(
       GoodDiagram<dataType> *goods,
@@ -479,6 +498,27 @@ namespace ttk {
                                    int wasserstein,
                                    dataType epsilon,
                                    double geometricalFactor) {
+    dataType new_price;
+    Good<dataType> *best_good = this->computeBid(
+      goods, twinGood, wasserstein, epsilon, geometricalFactor, new_price);
+    // Assign bidder to best_good
+    this->setProperty(best_good);
+    this->setPricePaid(new_price);
+
+    // Assign best_good to bidder and unassign the previous owner of best_good
+    // if need be
+    int idx_reassigned = best_good->getOwner();
+    best_good->assign(this->position_in_auction_, new_price);
+    return idx_reassigned;
+  }
+
+  template <typename dataType>
+  Good<dataType> *Bidder<dataType>::computeBid(GoodDiagram<dataType> *goods,
+                                               Good<dataType> &twinGood,
+                                               int wasserstein,
+                                               dataType epsilon,
+                                               double geometricalFactor,
+                                               dataType &new_price) {
     dataType best_val = std::numeric_limits<dataType>::lowest();
     dataType second_val = std::numeric_limits<dataType>::lowest();
     Good<dataType> *best_good = nullptr;
@@ -511,20 +551,12 @@ namespace ttk {
       second_val = best_val;
     }
     dataType old_price = best_good->getPrice();
-    dataType new_price = old_price + best_val - second_val + epsilon;
+    new_price = old_price + best_val - second_val + epsilon;
     if(new_price > std::numeric_limits<dataType>::max() / 2) {
       new_price = old_price + epsilon;
       std::cout << "Huho 376" << std::endl;
     }
-    // Assign bidder to best_good
-    this->setProperty(best_good);
-    this->setPricePaid(new_price);
-
-    // Assign best_good to bidder and unassign the previous owner of best_good
-    // if need be
-    int idx_reassigned = best_good->getOwner();
-    best_good->assign(this->position_in_auction_, new_price);
-    return idx_reassigned;
+    return best_good;
   }
 
   template <typename dataType>
@@ -787,6 +819,39 @@ namespace ttk {
                                       KDTree<dataType> *kdt,
                                       const int kdt_index) {
     /// Runs bidding of a non-diagonal bidder
+    KDTree<dataType> *closest_kdt;
+    dataType new_price;
+    Good<dataType> *best_good
+      = this->computeKDTBid(goods, twinGood, wasserstein, epsilon,
+                            geometricalFactor, kdt, closest_kdt, new_price,
+                            kdt_index);
+    // Assign bidder to best_good
+    this->setProperty(best_good);
+    this->setPricePaid(new_price);
+    // Assign best_good to bidder and unassign the previous owner of best_good
+    // if need be
+    int idx_reassigned = best_good->getOwner();
+
+    best_good->assign(this->position_in_auction_, new_price);
+    // Update the price in the KDTree
+    if(closest_kdt) {
+      closest_kdt->updateWeight(new_price, kdt_index);
+    }
+    return idx_reassigned;
+  }
+
+  template <typename dataType>
+  Good<dataType> *
+    Bidder<dataType>::computeKDTBid(GoodDiagram<dataType> *goods,
+                                    Good<dataType> &twinGood,
+                                    int wasserstein,
+                                    dataType epsilon,
+                                    double geometricalFactor,
+                                    KDTree<dataType> *kdt,
+                                    KDTree<dataType> *&closest_kdt,
+                                    dataType &new_price,
+                                    const int kdt_index) {
+    // closest_kdt is left to nullptr when the twin (diagonal) good is chosen
     std::vector<KDTree<dataType> *> neighbours;
     std::vector<dataType> costs;
 
@@ -803,7 +868,6 @@ namespace ttk {
     kdt->getKClosest(2, coordinates, neighbours, costs, kdt_index);
     // std::cout<<"got to 2"<<std::endl;
     dataType best_val, second_val;
-    KDTree<dataType> *closest_kdt;
     Good<dataType> *best_good;
     if(costs.size() == 2) {
       // std::cout<<"got to 735"<<std::endl;
@@ -829,7 +893,6 @@ namespace ttk {
     }
     // std::cout<<"got to 755"<<std::endl;
     // And now check for the corresponding twin bidder
-    bool twin_chosen = false;
     Good<dataType> &g = twinGood;
     dataType val = -this->cost(g, wasserstein, geometricalFactor);
     val -= g.getPrice();
@@ -837,7 +900,7 @@ namespace ttk {
       second_val = best_val;
       best_val = val;
       best_good = &g;
-      twin_chosen = true;
+      closest_kdt = nullptr;
     } else if(val > second_val) {
       second_val = val;
     }
@@ -848,25 +911,12 @@ namespace ttk {
       second_val = best_val;
     }
     dataType old_price = best_good->getPrice();
-    dataType new_price = old_price + best_val - second_val + epsilon;
+    new_price = old_price + best_val - second_val + epsilon;
     if(new_price > std::numeric_limits<dataType>::max() / 2) {
       new_price = old_price + epsilon;
       std::cout << "Huho 681" << std::endl;
     }
-    // Assign bidder to best_good
-    this->setProperty(best_good);
-    this->setPricePaid(new_price);
-    // Assign best_good to bidder and unassign the previous owner of best_good
-    // if need be
-    int idx_reassigned = best_good->getOwner();
-
-    // std::cout << "got here 3" << std::endl;
-    best_good->assign(this->position_in_auction_, new_price);
-    // Update the price in the KDTree
-    if(!twin_chosen) {
-      closest_kdt->updateWeight(new_price, kdt_index);
-    }
-    return idx_reassigned;
+    return best_good;
   }
 
   template <typename dataType>
@@ -5,9 +5,48 @@
 #define matchingTuple std::tuple<SimplexId, SimplexId, dataType>
 #endif
 
+template <typename dataType>
+int ttk::Auction<dataType>::runBidding(const int pos,
+                                       const dataType epsilon,
+                                       const int kdt_index) {
+  Bidder<dataType> &b = bidders_->get(pos);
+
+  GoodDiagram<dataType> *all_goods = b.isDiagonal() ? diagonal_goods_ : goods_;
+  Good<dataType> &twin_good
+    = b.id_ >= 0 ? diagonal_goods_->get(b.id_) : goods_->get(-b.id_ - 1);
+  // dataType eps = epsilon_*(1+0.05*n_biddings/bidders_->size());
+  int idx_reassigned;
+  if(b.isDiagonal()) {
+    if(use_kdt_) {
+      idx_reassigned = b.runDiagonalKDTBidding(
+        all_goods, twin_good, wasserstein_, epsilon, geometricalFactor_,
+        correspondance_kdt_map_, diagonal_queue_, kdt_index);
+    } else {
+      idx_reassigned
+        = b.runDiagonalBidding(all_goods, twin_good, wasserstein_, epsilon,
+                               geometricalFactor_, diagonal_queue_);
+    }
+  } else {
+    if(use_kdt_) {
+      // We can use the kd-tree to speed up the search
+      idx_reassigned
+        = b.runKDTBidding(all_goods, twin_good, wasserstein_, epsilon,
+                          geometricalFactor_, kdt_, kdt_index);
+    } else {
+      idx_reassigned = b.runBidding(
+        all_goods, twin_good, wasserstein_, epsilon, geometricalFactor_);
+    }
+  }
+  return idx_reassigned;
+}
+
 template <typename dataType>
 void ttk::Auction<dataType>::runAuctionRound(int &n_biddings,
                                              const int kdt_index) {
+  if(use_jacobi_) {
+    runJacobiAuctionRound(n_biddings, kdt_index);
+    return;
+  }
   dataType max_price = getMaximalPrice();
   dataType epsilon = epsilon_;
   if(epsilon_ < 1e-6 * max_price) {
@@ -17,48 +56,122 @@ void ttk::Auction<dataType>::runAuctionRound(int &n_biddings,
   while(unassignedBidders_.size() > 0) {
     n_biddings++;
     int pos = unassignedBidders_.front();
-    Bidder<dataType> &b = bidders_->get(pos);
     unassignedBidders_.pop_front();
 
-    GoodDiagram<dataType> *all_goods
-      = b.isDiagonal() ? diagonal_goods_ : goods_;
-    Good<dataType> &twin_good
-      = b.id_ >= 0 ? diagonal_goods_->get(b.id_) : goods_->get(-b.id_ - 1);
-    // dataType eps = epsilon_*(1+0.05*n_biddings/bidders_->size());
-    int idx_reassigned;
-    if(b.isDiagonal()) {
-      if(use_kdt_) {
-        idx_reassigned = b.runDiagonalKDTBidding(
-          all_goods, twin_good, wasserstein_, epsilon, geometricalFactor_,
-          correspondance_kdt_map_, diagonal_queue_, kdt_index);
+    int idx_reassigned = runBidding(pos, epsilon, kdt_index);
+    if(idx_reassigned >= 0) {
+      Bidder<dataType> &reassigned = bidders_->get(idx_reassigned);
+      reassigned.setProperty(NULL);
+      unassignedBidders_.push_back(idx_reassigned);
+    }
+  }
+}
+
+template <typename dataType>
+void ttk::Auction<dataType>::runJacobiAuctionRound(int &n_biddings,
+                                                   const int kdt_index) {
+  dataType max_price = getMaximalPrice();
+  dataType epsilon = epsilon_;
+  if(epsilon_ < 1e-6 * max_price) {
+    // Risks of floating point limits reached...
+    epsilon = 1e-6 * max_price;
+  }
+
+  // Bids computed against stale prices are likely to lose on the contested
+  // goods: passes are limited to a few hundred bidders per thread
+  const int batchSize = 256 * std::max(1, threadNumber_);
+  std::vector<int> offDiagonalBidders, diagonalBidders;
+  std::vector<Good<dataType> *> bidGoods;
+  std::vector<KDTree<dataType> *> bidNodes;
+  std::vector<dataType> bidPrices;
+  std::unordered_map<Good<dataType> *, int> winningBids;
+
+  while(unassignedBidders_.size() > 0) {
+    offDiagonalBidders.clear();
+    diagonalBidders.clear();
+    while(unassignedBidders_.size() > 0
+          && (int)(offDiagonalBidders.size() + diagonalBidders.size())
+               < batchSize) {
+      const int pos = unassignedBidders_.front();
+      unassignedBidders_.pop_front();
+      if(bidders_->get(pos).isDiagonal()) {
+        diagonalBidders.push_back(pos);
       } else {
-        idx_reassigned
-          = b.runDiagonalBidding(all_goods, twin_good, wasserstein_, epsilon,
-                                 geometricalFactor_, diagonal_queue_);
+        offDiagonalBidders.push_back(pos);
       }
-    } else {
+    }
+
+    // 1. off-diagonal bids, all computed against the current prices (neither
+    // the goods nor the kd-tree are modified here)
+    const int nBids = offDiagonalBidders.size();
+    n_biddings += nBids;
+    bidGoods.resize(nBids);
+    bidNodes.resize(nBids);
+    bidPrices.resize(nBids);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic, 16)
+#endif
+    for(int i = 0; i < nBids; i++) {
+      Bidder<dataType> &b = bidders_->get(offDiagonalBidders[i]);
+      Good<dataType> &twin_good
+        = b.id_ >= 0 ? diagonal_goods_->get(b.id_) : goods_->get(-b.id_ - 1);
       if(use_kdt_) {
-        // We can use the kd-tree to speed up the search
-        idx_reassigned
-          = b.runKDTBidding(all_goods, twin_good, wasserstein_, epsilon,
-                            geometricalFactor_, kdt_, kdt_index);
+        bidGoods[i] = b.computeKDTBid(goods_, twin_good, wasserstein_,
+                                      epsilon, geometricalFactor_, kdt_,
+                                      bidNodes[i], bidPrices[i], kdt_index);
       } else {
-        idx_reassigned = b.runBidding(
-          all_goods, twin_good, wasserstein_, epsilon, geometricalFactor_);
+        bidNodes[i] = nullptr;
+        bidGoods[i] = b.computeBid(goods_, twin_good, wasserstein_, epsilon,
+                                   geometricalFactor_, bidPrices[i]);
       }
     }
-    /*if(n_biddings>-1){
-      std::cout.precision(10);
-      std::cout<< n_biddings << ", out : " <<idx_reassigned<< ", " << b.id_ <<
-    "->" << b.getProperty()->id_ << ", distance : "<< b.cost(b.getProperty(),
-    wasserstein_, geometricalFactor_) << ", price : "
-    <<b.getProperty()->getPrice() << ", diagonal ? " << b.isDiagonal() << ", "<<
-    b.getProperty()->isDiagonal() << std::endl;
-    }*/
-    if(idx_reassigned >= 0) {
-      Bidder<dataType> &reassigned = bidders_->get(idx_reassigned);
-      reassigned.setProperty(NULL);
-      unassignedBidders_.push_back(idx_reassigned);
+
+    // 2. conflict resolution: the highest bid per good wins (the first one
+    // in the list on ties, so that the result does not depend on threads)
+    winningBids.clear();
+    for(int i = 0; i < nBids; i++) {
+      auto it = winningBids.find(bidGoods[i]);
+      if(it == winningBids.end()) {
+        winningBids.emplace(bidGoods[i], i);
+      } else if(bidPrices[i] > bidPrices[it->second]) {
+        it->second = i;
+      }
+    }
+
+    // 3. assignment of the winners, the losers and the previous owners of the
+    // goods bid again in the next pass
+    for(int i = 0; i < nBids; i++) {
+      const int pos = offDiagonalBidders[i];
+      Good<dataType> *good = bidGoods[i];
+      if(winningBids[good] != i) {
+        unassignedBidders_.push_back(pos);
+        continue;
+      }
+      Bidder<dataType> &b = bidders_->get(pos);
+      b.setProperty(good);
+      b.setPricePaid(bidPrices[i]);
+      int idx_reassigned = good->getOwner();
+      good->assign(b.getPositionInAuction(), bidPrices[i]);
+      if(bidNodes[i]) {
+        bidNodes[i]->updateWeight(bidPrices[i], kdt_index);
+      }
+      if(idx_reassigned >= 0) {
+        Bidder<dataType> &reassigned = bidders_->get(idx_reassigned);
+        reassigned.setProperty(NULL);
+        unassignedBidders_.push_back(idx_reassigned);
+      }
+    }
+
+    // 4. diagonal bidders: their bids only look at the top of the diagonal
+    // queue, they are kept sequential
+    for(const int pos : diagonalBidders) {
+      n_biddings++;
+      int idx_reassigned = runBidding(pos, epsilon, kdt_index);
+      if(idx_reassigned >= 0) {
+        Bidder<dataType> &reassigned = bidders_->get(idx_reassigned);
+        reassigned.setProperty(NULL);
+        unassignedBidders_.push_back(idx_reassigned);
+      }
     }
   }
 }
@@ -128,7 +241,8 @@ dataType ttk::Auction<dataType>::getMatchingsAndDistance(
 }
 
 template <typename dataType>
-dataType ttk::Auction<dataType>::run(std::vector<matchingTuple> *matchings) {
+dataType ttk::Auction<dataType>::run(std::vector<matchingTuple> *matchings,
+                                     const int kdt_index) {
   initializeEpsilon();
   int n_biddings = 0;
   dataType delta = 5;
@@ -136,7 +250,7 @@ dataType ttk::Auction<dataType>::run(std::vector<matchingTuple> *matchings) {
     epsilon_ /= 5;
     this->buildUnassignedBidders();
     this->reinitializeGoods();
-    this->runAuctionRound(n_biddings);
+    this->runAuctionRound(n_biddings, kdt_index);
     delta = this->getRelativePrecision();
   }
   dataType wassersteinDistance = this->getMatchingsAndDistance(matchings, true);
@@ -29,7 +29,9 @@
 #endif
 
 // base code includes
+#include <Auction.h>
 #include <GabowTarjan.h>
+#include <GeometricBottleneck.h>
 #include <Munkres.h>
 #include <PersistenceDiagram.h>
 #include <Triangulation.h>
@@ -45,7 +47,8 @@ namespace ttk {
 
   public:
     BottleneckDistance()
-      : distance_(-1), wasserstein_("inf"), pvAlgorithm_(-1), zeroThreshold_(0),
+      : distance_(-1), wasserstein_("inf"), pvAlgorithm_(-1),
+        useGeometricBottleneck_(false), useAuction_(false), zeroThreshold_(0),
         px_(0), py_(0), pz_(0), pe_(0), ps_(0){};
 
     ~BottleneckDistance(){};
@@ -138,6 +141,10 @@ namespace ttk {
     std::string wasserstein_;
     std::string algorithm_;
     int pvAlgorithm_;
+    // sparse bottleneck matching instead of Gabow-Tarjan on cost matrices
+    bool useGeometricBottleneck_;
+    // parallel Auction instead of Munkres on cost matrices (finite p)
+    bool useAuction_;
     double zeroThreshold_;
     double px_;
     double py_;
@@ -211,6 +218,26 @@ namespace ttk {
                                   std::vector<matchingTuple> &matchings,
                                   GabowTarjan &solver);
 
+    template <typename dataType>
+    void solveGeometricBottleneck(const std::vector<diagramTuple> &CTDiagram1,
+                                  const std::vector<diagramTuple> &CTDiagram2,
+                                  const std::vector<int> &map1,
+                                  const std::vector<int> &map2,
+                                  std::vector<matchingTuple> &matchings,
+                                  GeometricBottleneck &solver);
+
+    template <typename dataType>
+    void solveAuction(
+      const std::vector<diagramTuple> &CTDiagram1,
+      const std::vector<diagramTuple> &CTDiagram2,
+      const std::vector<int> &map1,
+      const std::vector<int> &map2,
+      std::vector<matchingTuple> &matchings,
+      std::function<dataType(const diagramTuple, const diagramTuple)>
+        &distanceFunction,
+      std::function<dataType(const diagramTuple)> &diagonalDistanceFunction,
+      int wasserstein);
+
     template <typename dataType>
     dataType buildMappings(const std::vector<matchingTuple> &inputMatchings,
                            bool transposeGlobal,
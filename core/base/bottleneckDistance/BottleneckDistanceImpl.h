@@ -9,6 +9,8 @@ template <typename dataType>
 int BottleneckDistance::execute(const bool usePersistenceMetric) {
   Timer t;
 
+  useGeometricBottleneck_ = false;
+  useAuction_ = false;
   bool fromParaView = pvAlgorithm_ >= 0;
   if(fromParaView) {
     switch(pvAlgorithm_) {
@@ -34,19 +36,30 @@ int BottleneckDistance::execute(const bool usePersistenceMetric) {
       } break;
       case 2: {
         std::stringstream msg;
-        msg << "[BottleneckDistance|PV] Solving with the approximate Dionysus "
-               "geometric approach."
-            << std::endl
-            << "[BottleneckDistance|PV] Not supported." << std::endl;
+        msg << "[BottleneckDistance|PV] Solving with the geometric approach."
+            << std::endl;
         dMsg(std::cout, msg.str(), timeMsg);
-      } break;
+      }
+        useGeometricBottleneck_ = true;
+        this->computeBottleneck<dataType>(
+          *static_cast<const std::vector<diagramTuple> *>(outputCT1_),
+          *static_cast<const std::vector<diagramTuple> *>(outputCT2_),
+          *static_cast<std::vector<matchingTuple> *>(matchings_),
+          usePersistenceMetric);
+        break;
       case 3: {
         std::stringstream msg;
         msg << "[BottleneckDistance|PV] Solving with the parallel TTK approach."
-            << std::endl
-            << "[BottleneckDistance|PV] Not supported." << std::endl;
+            << std::endl;
         dMsg(std::cout, msg.str(), timeMsg);
-      } break;
+      }
+        useAuction_ = true;
+        this->computeBottleneck<dataType>(
+          *static_cast<const std::vector<diagramTuple> *>(outputCT1_),
+          *static_cast<const std::vector<diagramTuple> *>(outputCT2_),
+          *static_cast<std::vector<matchingTuple> *>(matchings_),
+          usePersistenceMetric);
+        break;
       case 4: {
         std::stringstream msg;
         msg << "[BottleneckDistance] Benchmarking..." << std::endl
@@ -89,20 +102,31 @@ int BottleneckDistance::execute(const bool usePersistenceMetric) {
       case str2int("2"):
       case str2int("geometric"): {
         std::stringstream msg;
-        msg << "[BottleneckDistance] Solving with the approximate Dionysus "
-               "geometric approach."
-            << std::endl
-            << "[BottleneckDistance|PV] Not supported." << std::endl;
+        msg << "[BottleneckDistance] Solving with the geometric approach."
+            << std::endl;
         dMsg(std::cout, msg.str(), timeMsg);
-      } break;
+      }
+        useGeometricBottleneck_ = true;
+        this->computeBottleneck<dataType>(
+          *static_cast<const std::vector<diagramTuple> *>(outputCT1_),
+          *static_cast<const std::vector<diagramTuple> *>(outputCT2_),
+          *static_cast<std::vector<matchingTuple> *>(matchings_),
+          usePersistenceMetric);
+        break;
       case str2int("3"):
       case str2int("parallel"): {
         std::stringstream msg;
         msg << "[BottleneckDistance] Solving with the parallel TTK approach."
-            << std::endl
-            << "[BottleneckDistance|PV] Not supported." << std::endl;
+            << std::endl;
         dMsg(std::cout, msg.str(), timeMsg);
-      } break;
+      }
+        useAuction_ = true;
+        this->computeBottleneck<dataType>(
+          *static_cast<const std::vector<diagramTuple> *>(outputCT1_),
+          *static_cast<const std::vector<diagramTuple> *>(outputCT2_),
+          *static_cast<std::vector<matchingTuple> *>(matchings_),
+          usePersistenceMetric);
+        break;
       case str2int("bench"): {
         std::stringstream msg;
         msg << "[BottleneckDistance] Benchmarking..." << std::endl
@@ -466,6 +490,149 @@ void BottleneckDistance::solveInfinityWasserstein(
   solver.clear<dataType>();
 }
 
+template <typename dataType>
+void BottleneckDistance::solveGeometricBottleneck(
+  const std::vector<diagramTuple> &CTDiagram1,
+  const std::vector<diagramTuple> &CTDiagram2,
+  const std::vector<int> &map1,
+  const std::vector<int> &map2,
+  std::vector<matchingTuple> &matchings,
+  GeometricBottleneck &solver) {
+  // Embedding of the pairs such that the L1 distance between two of them is
+  // the distance used with the cost matrices (for p = inf)
+  const bool useGeometry = px_ > 0 || py_ > 0 || pz_ > 0;
+  const int dimension = useGeometry ? 5 : 2;
+
+  auto embed = [&](const diagramTuple &t, std::vector<double> &coordinates,
+                   std::vector<double> &diagonal) {
+    bool isMin = std::get<1>(t) == BLocalMin;
+    bool isMax = std::get<3>(t) == BLocalMax;
+    double rX = std::get<6>(t);
+    double rY = std::get<10>(t);
+    coordinates.push_back(((isMin && !isMax) ? pe_ : ps_) * rX);
+    coordinates.push_back((isMax ? pe_ : ps_) * rY);
+
+    double x1 = std::get<7>(t), y1 = std::get<8>(t), z1 = std::get<9>(t);
+    double x2 = std::get<11>(t), y2 = std::get<12>(t), z2 = std::get<13>(t);
+    if(useGeometry) {
+      // critical point of the extremum, middle of the pair for saddles
+      double x = isMax ? x2 : isMin ? x1 : (x1 + x2) / 2;
+      double y = isMax ? y2 : isMin ? y1 : (y1 + y2) / 2;
+      double z = isMax ? z2 : isMin ? z1 : (z1 + z2) / 2;
+      coordinates.push_back(px_ * x);
+      coordinates.push_back(py_ * y);
+      coordinates.push_back(pz_ * z);
+    }
+    diagonal.push_back((isMin || isMax ? pe_ : ps_) * abs_diff<double>(rX, rY)
+                       + px_ * abs(x2 - x1) + py_ * abs(y2 - y1)
+                       + pz_ * abs(z2 - z1));
+  };
+
+  std::vector<double> coordinates1, coordinates2, diagonal1, diagonal2;
+  coordinates1.reserve(dimension * map1.size());
+  coordinates2.reserve(dimension * map2.size());
+  for(const int i : map1) {
+    embed(CTDiagram1[i], coordinates1, diagonal1);
+  }
+  for(const int j : map2) {
+    embed(CTDiagram2[j], coordinates2, diagonal2);
+  }
+
+  solver.setDebugLevel(debugLevel_);
+  solver.setInput(dimension, coordinates1, diagonal1, coordinates2, diagonal2);
+  std::vector<std::tuple<int, int, double>> geometricMatchings;
+  solver.run(geometricMatchings);
+  solver.clear();
+  matchings.clear();
+  for(const auto &m : geometricMatchings) {
+    matchings.push_back(std::make_tuple(
+      std::get<0>(m), std::get<1>(m), (dataType)std::get<2>(m)));
+  }
+}
+
+template <typename dataType>
+void BottleneckDistance::solveAuction(
+  const std::vector<diagramTuple> &CTDiagram1,
+  const std::vector<diagramTuple> &CTDiagram2,
+  const std::vector<int> &map1,
+  const std::vector<int> &map2,
+  std::vector<matchingTuple> &matchings,
+  std::function<dataType(const diagramTuple, const diagramTuple)>
+    &distanceFunction,
+  std::function<dataType(const diagramTuple)> &diagonalDistanceFunction,
+  const int wasserstein) {
+  // The weights are applied to the bidders and goods: births, deaths and
+  // critical point coordinates are scaled by the p-th root of their weight,
+  // so that the Auction cost between two pairs is proportional to the p-th
+  // power of distanceFunction (lambda = 1: coordinates of the extremum).
+  // The cost of a pair matched to the diagonal remains the one of the
+  // Auction (distance to its projection on the diagonal).
+  const bool useGeometry = px_ > 0 || py_ > 0 || pz_ > 0;
+  const double w = wasserstein;
+  const double sx = pow(px_, 1 / w);
+  const double sy = pow(py_, 1 / w);
+  const double sz = pow(pz_, 1 / w);
+  const double se = pow(pe_, 1 / w);
+  const double ss = pow(ps_, 1 / w);
+  auto weigh = [&](diagramTuple t) {
+    const bool isMin = std::get<1>(t) == BLocalMin;
+    const bool isMax = std::get<3>(t) == BLocalMax;
+    std::get<6>(t) *= (isMin && !isMax) ? se : ss;
+    std::get<10>(t) *= isMax ? se : ss;
+    std::get<7>(t) *= sx;
+    std::get<8>(t) *= sy;
+    std::get<9>(t) *= sz;
+    std::get<11>(t) *= sx;
+    std::get<12>(t) *= sy;
+    std::get<13>(t) *= sz;
+    return t;
+  };
+
+  std::vector<diagramTuple> diagram1, diagram2, weighted1, weighted2;
+  diagram1.reserve(map1.size());
+  diagram2.reserve(map2.size());
+  weighted1.reserve(map1.size());
+  weighted2.reserve(map2.size());
+  for(const int i : map1) {
+    diagram1.push_back(CTDiagram1[i]);
+    weighted1.push_back(weigh(CTDiagram1[i]));
+  }
+  for(const int j : map2) {
+    diagram2.push_back(CTDiagram2[j]);
+    weighted2.push_back(weigh(CTDiagram2[j]));
+  }
+
+  // equal shares of persistence and geometry, or persistence only. The
+  // kd-tree only prices the goods as cost() does for a geometrical factor
+  // of 1, hence it is not used with the geometry.
+  Auction<dataType> auction(
+    wasserstein, useGeometry ? 0.5 : 1, 1, 0.01, !useGeometry);
+  auction.setDebugLevel(debugLevel_);
+  auction.setThreadNumber(threadNumber_);
+  auction.setUseJacobi(threadNumber_ > 1);
+  auction.BuildAuctionDiagrams(weighted1, weighted2);
+  std::vector<matchingTuple> auctionMatchings;
+  auction.run(&auctionMatchings);
+
+  // Same convention as the other solvers: an index out of range stands for
+  // the diagonal.
+  matchings.clear();
+  for(const auto &m : auctionMatchings) {
+    const int i = std::get<0>(m);
+    const int j = std::get<1>(m);
+    if(i >= 0 && j >= 0) {
+      matchings.push_back(std::make_tuple(
+        i, j, distanceFunction(diagram1[i], diagram2[j])));
+    } else if(i >= 0) {
+      matchings.push_back(
+        std::make_tuple(i, -1, diagonalDistanceFunction(diagram1[i])));
+    } else if(j >= 0) {
+      matchings.push_back(
+        std::make_tuple(-1, j, diagonalDistanceFunction(diagram2[j])));
+    }
+  }
+}
+
 template <typename dataType>
 dataType BottleneckDistance::buildMappings(
   const std::vector<matchingTuple> &inputMatchings,
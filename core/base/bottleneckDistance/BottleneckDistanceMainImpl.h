@@ -83,12 +83,29 @@ int BottleneckDistance::computeBottleneck(const std::vector<diagramTuple> &d1,
   minRowColMax = std::min(nbRowMax + 1, nbColMax + 1);
   minRowColSad = std::min(nbRowSad + 1, nbColSad + 1);
 
-  std::vector<std::vector<dataType>> minMatrix(
-    (unsigned long)minRowColMin, std::vector<dataType>(maxRowColMin));
-  std::vector<std::vector<dataType>> maxMatrix(
-    (unsigned long)minRowColMax, std::vector<dataType>(maxRowColMax));
-  std::vector<std::vector<dataType>> sadMatrix(
-    (unsigned long)minRowColSad, std::vector<dataType>(maxRowColSad));
+  // The geometric bottleneck and the Auction matchings need no cost matrix.
+  const bool geometricBottleneck = wasserstein < 0 && useGeometricBottleneck_;
+  // The Auction needs positive persistence weights to scale its bids.
+  const bool auction = wasserstein > 0 && useAuction_ && pe_ > 0 && ps_ > 0;
+  if(wasserstein > 0 && useAuction_ && !auction) {
+    std::stringstream msg;
+    msg << "[BottleneckDistance] Null persistence weight: solving with the "
+           "TTK approach."
+        << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
+
+  std::vector<std::vector<dataType>> minMatrix;
+  std::vector<std::vector<dataType>> maxMatrix;
+  std::vector<std::vector<dataType>> sadMatrix;
+  if(!geometricBottleneck && !auction) {
+    minMatrix.resize(
+      (unsigned long)minRowColMin, std::vector<dataType>(maxRowColMin));
+    maxMatrix.resize(
+      (unsigned long)minRowColMax, std::vector<dataType>(maxRowColMax));
+    sadMatrix.resize(
+      (unsigned long)minRowColSad, std::vector<dataType>(maxRowColSad));
+  }
 
   double px = px_;
   double py = py_;
@@ -171,18 +188,67 @@ int BottleneckDistance::computeBottleneck(const std::vector<diagramTuple> &d1,
     return pow(val, 1 / w);
   };
 
-  const bool transposeMin = nbRowMin > nbColMin;
-  const bool transposeMax = nbRowMax > nbColMax;
-  const bool transposeSad = nbRowSad > nbColSad;
+  const bool noMatrix = geometricBottleneck || auction;
+  const bool transposeMin = !noMatrix && nbRowMin > nbColMin;
+  const bool transposeMax = !noMatrix && nbRowMax > nbColMax;
+  const bool transposeSad = !noMatrix && nbRowSad > nbColSad;
 
   Timer t;
 
-  this->buildCostMatrices(
-    CTDiagram1, CTDiagram2, d1Size, d2Size, distanceFunction,
-    diagonalDistanceFunction, zeroThresh, minMatrix, maxMatrix, sadMatrix,
-    transposeMin, transposeMax, transposeSad, wasserstein);
+  if(!noMatrix) {
+    this->buildCostMatrices(
+      CTDiagram1, CTDiagram2, d1Size, d2Size, distanceFunction,
+      diagonalDistanceFunction, zeroThresh, minMatrix, maxMatrix, sadMatrix,
+      transposeMin, transposeMax, transposeSad, wasserstein);
+  }
+
+  if(geometricBottleneck) {
+
+    if(nbRowMin > 0 || nbColMin > 0) {
+      GeometricBottleneck solverMin;
+      dMsg(std::cout, "[BottleneckDistance] Affecting minima...\n", timeMsg);
+      this->solveGeometricBottleneck<dataType>(
+        CTDiagram1, CTDiagram2, minMap1, minMap2, minMatchings, solverMin);
+    }
+
+    if(nbRowMax > 0 || nbColMax > 0) {
+      GeometricBottleneck solverMax;
+      dMsg(std::cout, "[BottleneckDistance] Affecting maxima...\n", timeMsg);
+      this->solveGeometricBottleneck<dataType>(
+        CTDiagram1, CTDiagram2, maxMap1, maxMap2, maxMatchings, solverMax);
+    }
+
+    if(nbRowSad > 0 || nbColSad > 0) {
+      GeometricBottleneck solverSad;
+      dMsg(std::cout, "[BottleneckDistance] Affecting saddles...\n", timeMsg);
+      this->solveGeometricBottleneck<dataType>(
+        CTDiagram1, CTDiagram2, sadMap1, sadMap2, sadMatchings, solverSad);
+    }
 
-  if(wasserstein > 0) {
+  } else if(auction) {
+
+    if(nbRowMin > 0 || nbColMin > 0) {
+      dMsg(std::cout, "[BottleneckDistance] Affecting minima...\n", timeMsg);
+      this->solveAuction<dataType>(CTDiagram1, CTDiagram2, minMap1, minMap2,
+                                   minMatchings, distanceFunction,
+                                   diagonalDistanceFunction, wasserstein);
+    }
+
+    if(nbRowMax > 0 || nbColMax > 0) {
+      dMsg(std::cout, "[BottleneckDistance] Affecting maxima...\n", timeMsg);
+      this->solveAuction<dataType>(CTDiagram1, CTDiagram2, maxMap1, maxMap2,
+                                   maxMatchings, distanceFunction,
+                                   diagonalDistanceFunction, wasserstein);
+    }
+
+    if(nbRowSad > 0 || nbColSad > 0) {
+      dMsg(std::cout, "[BottleneckDistance] Affecting saddles...\n", timeMsg);
+      this->solveAuction<dataType>(CTDiagram1, CTDiagram2, sadMap1, sadMap2,
+                                   sadMatchings, distanceFunction,
+                                   diagonalDistanceFunction, wasserstein);
+    }
+
+  } else if(wasserstein > 0) {
 
     if(nbRowMin > 0 && nbColMin > 0) {
       Munkres solverMin;
@@ -292,10 +358,12 @@ int BottleneckDistance::computeBottleneck(const std::vector<diagramTuple> &d1,
     dataType partialDistance = distanceFunction(t1, t2);
     // wasserstein > 0 ? pow(lInf, wasserstein) : std::max(d, lInf);
 
-    if(wasserstein > 0)
+    if(auction)
+      d += pow(partialDistance, wasserstein);
+    else if(wasserstein > 0)
       d += partialDistance;
     else
-      d = partialDistance;
+      d = std::max(d, partialDistance);
   }
 
   if(numberOfMismatches > 0) {
@@ -305,6 +373,36 @@ int BottleneckDistance::computeBottleneck(const std::vector<diagramTuple> &d1,
     dMsg(std::cout, msg.str(), timeMsg);
   }
 
+  // The Auction minimizes the sum of the p-th powers of the distances
+  // between the pairs (p-th Wasserstein distance of the weighted ground
+  // distance), whereas the cost matrices hold the distances themselves.
+  if(auction) {
+    addedMinPersistence = addedMaxPersistence = addedSadPersistence = 0;
+    auto addDiagonal = [&](const std::vector<diagramTuple> &diagram,
+                           const std::vector<int> &map,
+                           const std::vector<bool> &paired,
+                           dataType &addedPersistence) {
+      for(const int i : map) {
+        if(!paired[i])
+          addedPersistence
+            += pow(diagonalDistanceFunction(diagram[i]), wasserstein);
+      }
+    };
+    addDiagonal(CTDiagram1, minMap1, paired1, addedMinPersistence);
+    addDiagonal(CTDiagram2, minMap2, paired2, addedMinPersistence);
+    addDiagonal(CTDiagram1, maxMap1, paired1, addedMaxPersistence);
+    addDiagonal(CTDiagram2, maxMap2, paired2, addedMaxPersistence);
+    addDiagonal(CTDiagram1, sadMap1, paired1, addedSadPersistence);
+    addDiagonal(CTDiagram2, sadMap2, paired2, addedSadPersistence);
+
+    std::stringstream msg;
+    msg << "[BottleneckDistance] Parallel approach: p-th Wasserstein "
+           "distance (sum of the p-th powers of the pair distances), not "
+           "comparable with the TTK approach (sum of the pair distances)."
+        << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
+
   dataType affectationD = d;
   d = wasserstein > 0
         ? pow(
@@ -83,74 +83,26 @@ void GabowTarjan::HopcroftKarp(unsigned int &matching) {
 
 template <typename dataType>
 dataType GabowTarjan::Distance(dataType maxLevel) {
-  // Clear the pairing
-  Pair.clear();
-  Pair.assign(2 * MaxSize, -1);
-
-  // Clearing Layers
-  Layers.clear();
-  Layers.resize(MaxSize + 1);
-
   // No vertices are matched
   unsigned int matching = 0;
-  unsigned int matching0 = 0;
-
-  // Clear the connection matrix and set it to the right size
-  Connections.clear();
-  Connections.resize(MaxSize);
 
-  // The maximal weight of the edges which are used for the matching
-  double currentWeight = 0;
-
-  // First non added edge is an iterator pointing to the first edge
-  // in Edges which was added to the Connections
-  unsigned int firstNotAddedEdge = 0;
+  // Binary search on the (sorted) edges: lowerBound is the index of the
+  // smallest edge whose weight may be the bottleneck distance, upperBound
+  // the one of an edge whose weight allows a perfect matching.
   unsigned int nbEdges = (unsigned int)Edges.size();
-
   unsigned int lowerBound = 0;
-  unsigned int upperBound = nbEdges;
-  unsigned int guessEdge = (lowerBound + nbEdges) / 2;
-
-  std::map<int, int> offPairings;
+  unsigned int upperBound = nbEdges > 0 ? nbEdges - 1 : 0;
 
-  // Repeat till all the vertices are matched
-  while(matching < MaxSize) {
-    // Save initial matching.
-    matching0 = matching;
-    unsigned int oldGuessEdge = guessEdge;
+  // Match the vertices with the edges up to the given one (and those with
+  // the same weight).
+  auto matchUpTo = [&](unsigned int lastEdge) {
+    double weight = Edges[lastEdge].weight;
 
-    currentWeight = Edges[guessEdge].weight;
-    while(Edges[guessEdge].weight == currentWeight && guessEdge < nbEdges)
-      ++guessEdge;
-
-    if(guessEdge >= nbEdges) {
-      std::stringstream msg;
-      ttk::Debug d;
-      msg << "[Gabow-Tarjan] ran out of edges." << std::endl;
-      d.dMsg(std::cout, msg.str(), ttk::Debug::timeMsg);
-    }
-
-    // Add the edges with the current weight (distance) to the connection matrix
-    while(firstNotAddedEdge >= guessEdge) {
-      int v1 = Edges[firstNotAddedEdge].v1;
-      int v2 = Edges[firstNotAddedEdge].v2;
-
-      std::vector<int> vec1 = Connections[v1];
-      vec1.erase(std::remove(vec1.begin(), vec1.end(), v2), vec1.end());
-      Connections[v1] = vec1;
-
-      --firstNotAddedEdge;
-    }
-
-    // Edges[firstNotAddedEdge].weight == currentWeight && firstNotAddedEdge <
-    // nbEdges
-    while(firstNotAddedEdge < guessEdge) {
-      int v1 = Edges[firstNotAddedEdge].v1;
-      int v2 = Edges[firstNotAddedEdge].v2;
-
-      Connections[v1].push_back(v2);
-      ++firstNotAddedEdge;
-    }
+    // Clear the connection matrix and set it to the right size
+    Connections.clear();
+    Connections.resize(MaxSize);
+    for(unsigned int e = 0; e < nbEdges && Edges[e].weight <= weight; ++e)
+      Connections[Edges[e].v1].push_back(Edges[e].v2);
 
     // Clear the pairing
     Pair.clear();
@@ -159,7 +111,16 @@ dataType GabowTarjan::Distance(dataType maxLevel) {
     Layers.clear();
     Layers.resize(MaxSize + 1);
 
-    // Temporarily augment matching.
+    matching = 0;
+    HopcroftKarp<dataType>(matching);
+  };
+
+  if(nbEdges == 0)
+    return -1;
+
+  while(lowerBound < upperBound) {
+    unsigned int guessEdge = (lowerBound + upperBound) / 2;
+
     {
       std::stringstream msg;
       ttk::Debug d;
@@ -167,56 +128,32 @@ dataType GabowTarjan::Distance(dataType maxLevel) {
       d.dMsg(std::cout, msg.str(), ttk::Debug::infoMsg);
     }
 
-    matching = 0;
-    HopcroftKarp<dataType>(matching);
-    // printCurrentMatching<dataType>();
-
-    if(matching >= MaxSize) {
+    matchUpTo(guessEdge);
 
-      // Reset matching.
-      matching = matching0;
+    if(matching >= MaxSize)
       upperBound = guessEdge;
-      guessEdge = (lowerBound + guessEdge) / 2;
-
-      // Ended binary search.
-      if(oldGuessEdge == guessEdge) {
-        std::stringstream msg;
-        ttk::Debug d;
-        msg << "[Gabow-Tarjan] Binary search success." << std::endl;
-        d.dMsg(std::cout, msg.str(), ttk::Debug::timeMsg);
-        return Edges[(guessEdge > 0 ? guessEdge - 1 : guessEdge)].weight;
-      }
-
-    } else {
+    else
+      lowerBound = guessEdge + 1;
+  }
 
-      // Check if we did not run out of edges. This should never happen.
-      if(firstNotAddedEdge == nbEdges) {
-        std::stringstream msg;
-        ttk::Debug d;
-        msg << "[Gabow-Tarjan] Not enough edges to find the matching!"
-            << std::endl;
-        d.dMsg(std::cout, msg.str(), ttk::Debug::timeMsg);
-        // return -1;
-        return currentWeight;
-      }
+  // Leave the pairing of the bottleneck distance.
+  matchUpTo(lowerBound);
 
-      lowerBound = guessEdge;
-      guessEdge = (guessEdge + upperBound) / 2;
-      // Increase the value of the current weight
-      // currentWeight = Edges[firstNotAddedEdge].weight;
-
-      // Ended binary search.
-      if(oldGuessEdge == guessEdge) {
-        std::stringstream msg;
-        ttk::Debug d;
-        msg << "[Gabow-Tarjan] Binary search success." << std::endl;
-        d.dMsg(std::cout, msg.str(), ttk::Debug::timeMsg);
-        return Edges[(guessEdge > 0 ? guessEdge - 1 : guessEdge)].weight;
-      }
-    }
+  if(matching < MaxSize) {
+    // This should never happen.
+    std::stringstream msg;
+    ttk::Debug d;
+    msg << "[Gabow-Tarjan] Not enough edges to find the matching!"
+        << std::endl;
+    d.dMsg(std::cout, msg.str(), ttk::Debug::timeMsg);
+  } else {
+    std::stringstream msg;
+    ttk::Debug d;
+    msg << "[Gabow-Tarjan] Binary search success." << std::endl;
+    d.dMsg(std::cout, msg.str(), ttk::Debug::timeMsg);
   }
 
-  return -1;
+  return Edges[lowerBound].weight;
 }
 
 template <typename dataType>
@@ -305,13 +242,10 @@ int GabowTarjan::run(std::vector<matchingTuple> &matchings) {
       // return -1;
     }
 
+    // Diagonal points matched together are not reported.
     if(i <= -1) {
       matchingTuple t = std::make_tuple(i, j - Size1, (*C)[Size1][j - Size1]);
       matchings.push_back(t);
-    } else {
-      // Already added by symmetry.
-      matchingTuple t = std::make_tuple(i, j - Size1, (*C)[i][j - Size1]);
-      matchings.push_back(t);
     }
   }
 
@@ -0,0 +1,440 @@
+#include <GeometricBottleneck.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+using namespace std;
+using namespace ttk;
+
+// weight of the points removed from a KD-tree
+static const double removedWeight = numeric_limits<double>::max();
+
+void GeometricBottleneck::setInput(const int dimension,
+                                   const vector<double> &coordinates1,
+                                   const vector<double> &diagonal1,
+                                   const vector<double> &coordinates2,
+                                   const vector<double> &diagonal2) {
+  clear();
+  dimension_ = dimension;
+  size1_ = diagonal1.size();
+  size2_ = diagonal2.size();
+  size_ = size1_ + size2_;
+  coordinates1_ = coordinates1;
+  coordinates2_ = coordinates2;
+  diagonal1_ = diagonal1;
+  diagonal2_ = diagonal2;
+  query_.resize(dimension_);
+}
+
+void GeometricBottleneck::clear() {
+  clearLayerTrees();
+  if(tree2_) {
+    delete tree2_;
+    tree2_ = nullptr;
+  }
+  nodes2_.clear();
+  size1_ = size2_ = size_ = 0;
+}
+
+void GeometricBottleneck::clearLayerTrees() {
+  for(auto tree : layerTrees_) {
+    delete tree;
+  }
+  layerTrees_.clear();
+  layerNodes_.clear();
+}
+
+double GeometricBottleneck::edgeCost(const int left, const int right) const {
+  if(left < size1_) {
+    if(right < size2_) {
+      const double *p1 = point1(left);
+      const double *p2 = point2(right);
+      double cost = 0;
+      for(int a = 0; a < dimension_; a++) {
+        cost += fabs(p1[a] - p2[a]);
+      }
+      return cost;
+    }
+    // a point of the first diagram and its projection
+    return diagonal1_[left];
+  }
+  if(right < size2_) {
+    // a projection and its point of the second diagram
+    return diagonal2_[right];
+  }
+  // two projections
+  return 0;
+}
+
+void GeometricBottleneck::match(const int left, const int right) {
+  pairLeft_[left] = right;
+  pairRight_[right] = left;
+  pairCost_[left] = edgeCost(left, right);
+}
+
+int GeometricBottleneck::popNeighbour(KDTree<double> *tree,
+                                      vector<KDTree<double> *> &nodes,
+                                      const int left,
+                                      const double threshold) {
+  if(nodes.empty()) {
+    return -1;
+  }
+  const double *p = point1(left);
+  for(int a = 0; a < dimension_; a++) {
+    query_[a] = p[a];
+  }
+  neighbours_.clear();
+  costs_.clear();
+  tree->getKClosest(1, query_, neighbours_, costs_);
+  if(costs_.empty() || costs_[0] > threshold) {
+    return -1;
+  }
+  neighbours_[0]->updateWeight(removedWeight);
+  return neighbours_[0]->id_;
+}
+
+double GeometricBottleneck::lowerBound() {
+  // every point is matched either to the diagonal or to a point of the other
+  // diagram
+  double bound = 0;
+
+  if(size2_ > 0) {
+    for(int i = 0; i < size1_; i++) {
+      query_.assign(point1(i), point1(i) + dimension_);
+      neighbours_.clear();
+      costs_.clear();
+      tree2_->getKClosest(1, query_, neighbours_, costs_);
+      bound = max(bound, min(diagonal1_[i], costs_[0]));
+    }
+  } else {
+    for(int i = 0; i < size1_; i++) {
+      bound = max(bound, diagonal1_[i]);
+    }
+  }
+
+  if(size1_ > 0) {
+    KDTree<double> tree1(true, 1);
+    tree1.build(coordinates1_.data(), size1_, dimension_);
+    for(int j = 0; j < size2_; j++) {
+      query_.assign(point2(j), point2(j) + dimension_);
+      neighbours_.clear();
+      costs_.clear();
+      tree1.getKClosest(1, query_, neighbours_, costs_);
+      bound = max(bound, min(diagonal2_[j], costs_[0]));
+    }
+  } else {
+    for(int j = 0; j < size2_; j++) {
+      bound = max(bound, diagonal2_[j]);
+    }
+  }
+  return bound;
+}
+
+double GeometricBottleneck::nextThreshold() {
+  // After a failed search, the left vertices reached from the free ones have
+  // too few neighbours. Below the shortest edge leaving them to an unreached
+  // right vertex, this does not change.
+  double next = numeric_limits<double>::max();
+  for(int left = 0; left < size_; left++) {
+    if(layerLeft_[left] < 0) {
+      continue;
+    }
+    if(left < size1_) {
+      if(size2_ > 0) {
+        query_.assign(point1(left), point1(left) + dimension_);
+        neighbours_.clear();
+        costs_.clear();
+        tree2_->getKClosest(1, query_, neighbours_, costs_);
+        next = min(next, costs_[0]);
+      }
+      if(aliveRight_[size2_ + left]) {
+        next = min(next, diagonal1_[left]);
+      }
+    } else if(aliveRight_[left - size1_]) {
+      next = min(next, diagonal2_[left - size1_]);
+    }
+  }
+  return next;
+}
+
+bool GeometricBottleneck::buildLayers(const double threshold) {
+  // Breadth-first search from the free left vertices. Each right vertex is
+  // visited once: the points of the second diagram are removed from the
+  // KD-tree, the projections from the stack.
+  layerLeft_.assign(size_, -1);
+  layerRight_.assign(size_, -1);
+  aliveRight_.assign(size_, true);
+  for(int j = 0; j < size2_; j++) {
+    if(nodes2_[j]->getWeight() != 0) {
+      nodes2_[j]->updateWeight(0);
+    }
+  }
+  projections_.resize(size1_);
+  for(int i = 0; i < size1_; i++) {
+    projections_[i] = size2_ + i;
+  }
+
+  vector<int> queue;
+  for(int v = 0; v < size_; v++) {
+    if(pairLeft_[v] < 0) {
+      layerLeft_[v] = 0;
+      queue.push_back(v);
+    }
+  }
+
+  lastLayer_ = -1;
+  auto visit = [&](const int right, const int layer) {
+    aliveRight_[right] = false;
+    layerRight_[right] = layer;
+    const int mate = pairRight_[right];
+    if(mate < 0) {
+      lastLayer_ = layer;
+    } else {
+      layerLeft_[mate] = layer + 1;
+      queue.push_back(mate);
+    }
+  };
+
+  for(size_t q = 0; q < queue.size(); q++) {
+    const int v = queue[q];
+    const int layer = layerLeft_[v];
+    if(lastLayer_ >= 0 && layer > lastLayer_) {
+      break;
+    }
+    if(v < size1_) {
+      int j;
+      while((j = popNeighbour(tree2_, nodes2_, v, threshold)) >= 0) {
+        visit(j, layer);
+      }
+      const int projection = size2_ + v;
+      if(diagonal1_[v] <= threshold && aliveRight_[projection]) {
+        visit(projection, layer);
+      }
+    } else {
+      const int j = v - size1_;
+      if(diagonal2_[j] <= threshold && aliveRight_[j]) {
+        nodes2_[j]->updateWeight(removedWeight);
+        visit(j, layer);
+      }
+      while(!projections_.empty()) {
+        const int projection = projections_.back();
+        projections_.pop_back();
+        if(aliveRight_[projection]) {
+          visit(projection, layer);
+        }
+      }
+    }
+  }
+
+  if(lastLayer_ < 0) {
+    return false;
+  }
+
+  // Right vertices of each layer, for the depth-first searches. Those of the
+  // second diagram get a KD-tree per layer.
+  clearLayerTrees();
+  layerPoints_.assign(lastLayer_ + 1, vector<int>());
+  layerProjections_.assign(lastLayer_ + 1, vector<int>());
+  localIndex_.assign(size2_, -1);
+  for(int right = 0; right < size_; right++) {
+    const int layer = layerRight_[right];
+    if(layer < 0 || layer > lastLayer_) {
+      continue;
+    }
+    if(right < size2_) {
+      localIndex_[right] = layerPoints_[layer].size();
+      layerPoints_[layer].push_back(right);
+    } else {
+      layerProjections_[layer].push_back(right);
+    }
+  }
+  vector<double> coordinates;
+  for(int layer = 0; layer <= lastLayer_; layer++) {
+    const vector<int> &points = layerPoints_[layer];
+    coordinates.clear();
+    for(const int j : points) {
+      coordinates.insert(
+        coordinates.end(), point2(j), point2(j) + dimension_);
+    }
+    auto tree = new KDTree<double>(true, 1);
+    layerNodes_.push_back(
+      tree->build(coordinates.data(), points.size(), dimension_));
+    layerTrees_.push_back(tree);
+  }
+
+  return true;
+}
+
+bool GeometricBottleneck::tryRight(const int right,
+                                   const int layer,
+                                   const double threshold) {
+  const int mate = pairRight_[right];
+  if(layer == lastLayer_) {
+    return mate < 0;
+  }
+  return mate >= 0 && layerLeft_[mate] == layer + 1
+         && depthFirstSearch(mate, threshold);
+}
+
+bool GeometricBottleneck::depthFirstSearch(const int left,
+                                           const double threshold) {
+  // Right vertices are removed from their layer once tried: either they are
+  // now on an augmenting path, or no path goes through them in this phase.
+  const int layer = layerLeft_[left];
+
+  if(left < size1_) {
+    int local;
+    while((local = popNeighbour(
+             layerTrees_[layer], layerNodes_[layer], left, threshold))
+          >= 0) {
+      const int right = layerPoints_[layer][local];
+      layerRight_[right] = -1;
+      if(tryRight(right, layer, threshold)) {
+        match(left, right);
+        return true;
+      }
+    }
+    const int projection = size2_ + left;
+    if(diagonal1_[left] <= threshold && layerRight_[projection] == layer) {
+      layerRight_[projection] = -1;
+      if(tryRight(projection, layer, threshold)) {
+        match(left, projection);
+        return true;
+      }
+    }
+  } else {
+    const int j = left - size1_;
+    if(diagonal2_[j] <= threshold && layerRight_[j] == layer) {
+      layerRight_[j] = -1;
+      layerNodes_[layer][localIndex_[j]]->updateWeight(removedWeight);
+      if(tryRight(j, layer, threshold)) {
+        match(left, j);
+        return true;
+      }
+    }
+    vector<int> &projections = layerProjections_[layer];
+    while(!projections.empty()) {
+      const int projection = projections.back();
+      projections.pop_back();
+      if(layerRight_[projection] != layer) {
+        continue;
+      }
+      layerRight_[projection] = -1;
+      if(tryRight(projection, layer, threshold)) {
+        match(left, projection);
+        return true;
+      }
+    }
+  }
+
+  layerLeft_[left] = -1;
+  return false;
+}
+
+bool GeometricBottleneck::augment(const double threshold) {
+  // Hopcroft-Karp, starting from the current matching without its edges
+  // longer than the threshold
+  int matched = 0;
+  for(int left = 0; left < size_; left++) {
+    const int right = pairLeft_[left];
+    if(right < 0) {
+      continue;
+    }
+    if(pairCost_[left] > threshold) {
+      pairLeft_[left] = -1;
+      pairRight_[right] = -1;
+    } else {
+      matched++;
+    }
+  }
+
+  while(matched < size_ && buildLayers(threshold)) {
+    for(int left = 0; left < size_; left++) {
+      if(pairLeft_[left] < 0 && layerLeft_[left] == 0
+         && depthFirstSearch(left, threshold)) {
+        matched++;
+      }
+    }
+  }
+  return matched == size_;
+}
+
+double GeometricBottleneck::run(vector<tuple<int, int, double>> &matchings) {
+  Timer t;
+
+  matchings.clear();
+  if(size_ == 0) {
+    return 0;
+  }
+
+  pairLeft_.assign(size_, -1);
+  pairRight_.assign(size_, -1);
+  pairCost_.assign(size_, 0);
+
+  nodes2_.clear();
+  tree2_ = new KDTree<double>(true, 1);
+  if(size2_ > 0) {
+    nodes2_ = tree2_->build(coordinates2_.data(), size2_, dimension_);
+  }
+
+  // Everything matched to the diagonal gives the first upper bound.
+  for(int i = 0; i < size1_; i++) {
+    match(i, size2_ + i);
+  }
+  for(int j = 0; j < size2_; j++) {
+    match(size1_ + j, j);
+  }
+
+  // Binary search over the doubles, through their ordered bit patterns.
+  // Both bounds are moved to actual distances: the longest edge of the
+  // matching after a success, the shortest edge that may extend it after a
+  // failure.
+  double lower = lowerBound();
+  double upper = *max_element(pairCost_.begin(), pairCost_.end());
+  vector<int> bestPairLeft = pairLeft_;
+  int iterations = 0;
+  while(lower < upper) {
+    uint64_t lowerBits, upperBits;
+    memcpy(&lowerBits, &lower, sizeof(double));
+    memcpy(&upperBits, &upper, sizeof(double));
+    const uint64_t middleBits = lowerBits + (upperBits - lowerBits) / 2;
+    double middle;
+    memcpy(&middle, &middleBits, sizeof(double));
+
+    iterations++;
+    if(augment(middle)) {
+      upper = *max_element(pairCost_.begin(), pairCost_.end());
+      bestPairLeft = pairLeft_;
+    } else {
+      lower = nextThreshold();
+    }
+  }
+  clearLayerTrees();
+
+  for(int i = 0; i < size1_; i++) {
+    const int right = bestPairLeft[i];
+    if(right < size2_) {
+      matchings.push_back(make_tuple(i, right, edgeCost(i, right)));
+    } else {
+      matchings.push_back(make_tuple(i, size2_, diagonal1_[i]));
+    }
+  }
+  for(int j = 0; j < size2_; j++) {
+    if(bestPairLeft[size1_ + j] == j) {
+      matchings.push_back(make_tuple(-1, j, diagonal2_[j]));
+    }
+  }
+
+  {
+    stringstream msg;
+    msg << "[GeometricBottleneck] Distance " << upper << " found in "
+        << iterations << " matching(s), " << t.getElapsedTime() << " s."
+        << endl;
+    dMsg(cout, msg.str(), timeMsg);
+  }
+
+  return upper;
+}
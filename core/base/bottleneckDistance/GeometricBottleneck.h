@@ -0,0 +1,122 @@
+/// \ingroup base
+/// \class ttk::GeometricBottleneck
+///
+/// \brief Bottleneck matching without cost matrix.
+///
+/// The persistence pairs of the two diagrams are embedded so that the L1
+/// distance between two points is their matching cost. The bottleneck
+/// distance is found by a binary search over the distances, the perfect
+/// matching at a given threshold being computed by Hopcroft-Karp on the
+/// implicit threshold graph: the neighbours of a point are queried in
+/// KD-trees and removed from them once visited (Efrat, Itai and Katz,
+/// "Geometry helps in bottleneck matching and related problems", 2001).
+/// Memory is linear in the number of pairs.
+///
+/// The bipartite graph follows the one of GabowTarjan: the left side holds
+/// the points of the first diagram then the diagonal projections of the
+/// points of the second one, the right side the points of the second diagram
+/// then the projections of the points of the first one.
+
+#ifndef _GEOMETRICBOTTLENECK_H
+#define _GEOMETRICBOTTLENECK_H
+
+#include <Debug.h>
+#include <KDTree.h>
+
+#include <tuple>
+#include <vector>
+
+namespace ttk {
+
+  class GeometricBottleneck : public Debug {
+
+  public:
+    GeometricBottleneck() {
+    }
+
+    ~GeometricBottleneck() {
+      clear();
+    }
+
+    /// Points are given as size * dimension coordinates, along with their
+    /// distances to the diagonal.
+    void setInput(const int dimension,
+                  const std::vector<double> &coordinates1,
+                  const std::vector<double> &diagonal1,
+                  const std::vector<double> &coordinates2,
+                  const std::vector<double> &diagonal2);
+
+    /// Computes the bottleneck distance and fills the matchings with the
+    /// conventions of GabowTarjan::run: an index out of range stands for the
+    /// diagonal. The tuple type is spelled out: matchingTuple depends on
+    /// dataType when Auction.h is included first.
+    double run(std::vector<std::tuple<int, int, double>> &matchings);
+
+    void clear();
+
+  protected:
+    int dimension_{0};
+    int size1_{0};
+    int size2_{0};
+    // number of vertices on each side of the bipartite graph
+    int size_{0};
+
+    std::vector<double> coordinates1_;
+    std::vector<double> coordinates2_;
+    std::vector<double> diagonal1_;
+    std::vector<double> diagonal2_;
+
+    // points of the second diagram, for the breadth-first searches
+    KDTree<double> *tree2_{nullptr};
+    std::vector<KDTree<double> *> nodes2_;
+
+    // current matching
+    std::vector<int> pairLeft_;
+    std::vector<int> pairRight_;
+    std::vector<double> pairCost_;
+
+    // layered graph of a Hopcroft-Karp phase
+    std::vector<int> layerLeft_;
+    std::vector<int> layerRight_;
+    int lastLayer_{-1};
+    std::vector<bool> aliveRight_;
+    std::vector<int> projections_;
+    std::vector<KDTree<double> *> layerTrees_;
+    std::vector<std::vector<KDTree<double> *>> layerNodes_;
+    std::vector<std::vector<int>> layerPoints_;
+    std::vector<std::vector<int>> layerProjections_;
+    std::vector<int> localIndex_;
+    // nearest neighbour queries
+    std::vector<double> query_;
+    std::vector<KDTree<double> *> neighbours_;
+    std::vector<double> costs_;
+
+    double edgeCost(const int left, const int right) const;
+    double lowerBound();
+    double nextThreshold();
+
+    void match(const int left, const int right);
+    bool augment(const double threshold);
+    bool buildLayers(const double threshold);
+    bool depthFirstSearch(const int left, const double threshold);
+    bool tryRight(const int right, const int layer, const double threshold);
+
+    // pops an unvisited point of the second diagram closer than threshold
+    int popNeighbour(KDTree<double> *tree,
+                     std::vector<KDTree<double> *> &nodes,
+                     const int left,
+                     const double threshold);
+    void clearLayerTrees();
+
+    inline const double *point1(const int i) const {
+      return &coordinates1_[i * dimension_];
+    }
+
+    inline const double *point2(const int j) const {
+      return &coordinates2_[j * dimension_];
+    }
+  };
+
+} // namespace ttk
+
+#endif
@@ -0,0 +1,214 @@
+/// \ingroup base
+/// \class ttk::FlatJaggedArray
+/// \date October 2019.
+///
+/// \brief Compact storage for jagged arrays of simplex identifiers.
+///
+/// %FlatJaggedArray stores a list of variable-length lists (for instance the
+/// star of each vertex of a triangulation) in compressed sparse row form: a
+/// single contiguous array of identifiers plus an array of offsets. Compared
+/// to a std::vector<std::vector<SimplexId>>, this saves one heap allocation
+/// (and its bookkeeping) per entry and keeps the items of consecutive entries
+/// contiguous in memory.
+/// \sa ttk::ExplicitTriangulation
+
+#ifndef _FLATJAGGEDARRAY_H
+#define _FLATJAGGEDARRAY_H
+
+#include <DataTypes.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace ttk {
+
+  class FlatJaggedArray {
+
+  public:
+    /// Read-only view on the items of one entry.
+    class Slice {
+    public:
+      Slice(const SimplexId *begin, const SimplexId *end)
+        : begin_(begin), end_(end) {
+      }
+
+      inline const SimplexId *begin() const {
+        return begin_;
+      }
+
+      inline const SimplexId *end() const {
+        return end_;
+      }
+
+      inline bool empty() const {
+        return begin_ == end_;
+      }
+
+      inline size_t size() const {
+        return end_ - begin_;
+      }
+
+      inline const SimplexId &operator[](const size_t &i) const {
+        return begin_[i];
+      }
+
+    protected:
+      const SimplexId *begin_, *end_;
+    };
+
+    inline void clear() {
+      offsets_.clear();
+      data_.clear();
+      offsets_.shrink_to_fit();
+      data_.shrink_to_fit();
+    }
+
+    /// Number of entries.
+    inline size_t size() const {
+      return offsets_.empty() ? 0 : offsets_.size() - 1;
+    }
+
+    inline bool empty() const {
+      return offsets_.size() < 2;
+    }
+
+    /// Number of items in the \p id-th entry.
+    inline SimplexId size(const SimplexId &id) const {
+      return offsets_[id + 1] - offsets_[id];
+    }
+
+    /// Get the \p local-th item of the \p id-th entry.
+    inline SimplexId get(const SimplexId &id, const SimplexId &local) const {
+      return data_[offsets_[id] + local];
+    }
+
+    inline Slice operator[](const SimplexId &id) const {
+      return Slice(
+        data_.data() + offsets_[id], data_.data() + offsets_[id + 1]);
+    }
+
+    /// Total number of items (over all the entries).
+    inline size_t dataSize() const {
+      return data_.size();
+    }
+
+    inline const std::vector<SimplexId> &getOffsets() const {
+      return offsets_;
+    }
+
+    inline const std::vector<SimplexId> &getData() const {
+      return data_;
+    }
+
+    /// Memory footprint in bytes.
+    inline size_t footprint() const {
+      return (offsets_.size() + data_.size()) * sizeof(SimplexId);
+    }
+
+    /// Take ownership of an offset array (of size entry number + 1, starting
+    /// at 0) and of the corresponding item array.
+    inline void setData(std::vector<SimplexId> &&offsets,
+                        std::vector<SimplexId> &&data) {
+      offsets_ = std::move(offsets);
+      data_ = std::move(data);
+    }
+
+    /// Turn an array of per-entry item counts (of size entry number + 1,
+    /// whose last value is ignored) into offsets, in place. Returns the
+    /// total number of items.
+    static inline SimplexId countsToOffsets(std::vector<SimplexId> &counts) {
+      SimplexId sum = 0;
+      for(size_t i = 0; i < counts.size(); i++) {
+        const SimplexId c = counts[i];
+        counts[i] = sum;
+        sum += c;
+      }
+      return counts.empty() ? 0 : counts.back();
+    }
+
+    /// Fill the structure with \p entryNumber entries of \p arity items each.
+    /// All the items are initialized to \p value.
+    inline void setUniform(const SimplexId &entryNumber,
+                           const int &arity,
+                           const SimplexId &value = -1) {
+      offsets_.resize(entryNumber + 1);
+      for(SimplexId i = 0; i <= entryNumber; i++) {
+        offsets_[i] = i * arity;
+      }
+      data_.assign(static_cast<size_t>(entryNumber) * arity, value);
+    }
+
+    /// Mutable access to the items of the \p id-th entry (for builders
+    /// filling pre-sized entries, see setUniform()).
+    inline SimplexId *entry(const SimplexId &id) {
+      return data_.data() + offsets_[id];
+    }
+
+    /// Fill the structure by transposing a relation given item by item
+    /// (counting sort, two passes, no per-entry allocation).
+    /// \param entryNumber Number of entries of the output.
+    /// \param itemNumber Number of input items.
+    /// \param arity Number of (entry, value) pairs produced by each item.
+    /// \param entryOf Functor such that entryOf(i, k) is the entry receiving
+    /// the k-th pair of the i-th item (negative values are skipped).
+    /// \param valueOf Functor such that valueOf(i, k) is the value stored for
+    /// the k-th pair of the i-th item.
+    /// Within an entry, values are stored by increasing item identifier.
+    template <typename EntryFunctor, typename ValueFunctor>
+    inline void fillTransposed(const SimplexId &entryNumber,
+                               const SimplexId &itemNumber,
+                               const int &arity,
+                               const EntryFunctor &entryOf,
+                               const ValueFunctor &valueOf) {
+
+      std::vector<SimplexId> offsets(entryNumber + 1, 0);
+      for(SimplexId i = 0; i < itemNumber; i++) {
+        for(int k = 0; k < arity; k++) {
+          const SimplexId e = entryOf(i, k);
+          if(e >= 0)
+            offsets[e]++;
+        }
+      }
+
+      std::vector<SimplexId> data(countsToOffsets(offsets));
+      std::vector<SimplexId> cursor(offsets.begin(), offsets.end() - 1);
+      for(SimplexId i = 0; i < itemNumber; i++) {
+        for(int k = 0; k < arity; k++) {
+          const SimplexId e = entryOf(i, k);
+          if(e >= 0)
+            data[cursor[e]++] = valueOf(i, k);
+        }
+      }
+
+      setData(std::move(offsets), std::move(data));
+    }
+
+    inline void fillFrom(const std::vector<std::vector<SimplexId>> &table) {
+      offsets_.resize(table.size() + 1);
+      offsets_[0] = 0;
+      for(size_t i = 0; i < table.size(); i++) {
+        offsets_[i + 1] = offsets_[i] + table[i].size();
+      }
+      data_.resize(offsets_.back());
+      for(size_t i = 0; i < table.size(); i++) {
+        std::copy(table[i].begin(), table[i].end(), entry(i));
+      }
+    }
+
+    inline void copyTo(std::vector<std::vector<SimplexId>> &table) const {
+      table.resize(size());
+      for(size_t i = 0; i < table.size(); i++) {
+        const Slice s = (*this)[i];
+        table[i].assign(s.begin(), s.end());
+      }
+    }
+
+  protected:
+    std::vector<SimplexId> offsets_;
+    std::vector<SimplexId> data_;
+  };
+} // namespace ttk
+
+#endif // _FLATJAGGEDARRAY_H
@@ -69,6 +69,14 @@ namespace ttk {
     return 1;
   }
 
+  int OsCall::getProcessId() {
+#ifdef _WIN32
+    return (int)GetCurrentProcessId();
+#else
+    return (int)getpid();
+#endif
+  }
+
   double OsCall::getTimeStamp() {
 #ifdef _WIN32
     LARGE_INTEGER frequency;
@@ -72,6 +72,8 @@ namespace ttk {
 
     static int getNumberOfCores();
 
+    static int getProcessId();
+
     static double getTimeStamp();
 
     static std::vector<std::string>
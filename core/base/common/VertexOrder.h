@@ -0,0 +1,278 @@
+/// \ingroup base
+/// \class ttk::VertexOrder
+/// \date October 2019.
+///
+/// \brief Global order of the vertices of a scalar field.
+///
+/// %VertexOrder stores the vertices sorted by increasing (scalar, offset)
+/// values, along with the rank of each vertex in this order (the "mirror"
+/// array of the merge tree based packages). It is computed with a parallel
+/// LSD radix sort on order-preserving integer keys of the values, which is
+/// linear in the number of vertices and skips the digits shared by all the
+/// keys.
+///
+/// Ties on both the scalar and the offset values are broken by vertex
+/// identifier. Negative and positive zeros are considered equal.
+///
+/// Filters should not use this class directly but request the order of their
+/// input field with ttk::Triangulation::getVertexOrder(), which caches it.
+/// \sa ttk::Triangulation
+
+#ifndef _VERTEXORDER_H
+#define _VERTEXORDER_H
+
+#include <DataTypes.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+namespace ttk {
+
+  class VertexOrder {
+
+  public:
+    /// Unsigned integer key with the same order as the values of type T.
+    template <typename T, bool isFloat = std::is_floating_point<T>::value>
+    struct RadixKey {
+      typedef typename std::
+        conditional<(sizeof(T) > 4), std::uint64_t, std::uint32_t>::type type;
+
+      static inline type get(const T &value) {
+        // sign extension then flip of the sign bit for signed types
+        const type signBit
+          = std::is_signed<T>::value ? type(1) << (sizeof(type) * 8 - 1) : 0;
+        return static_cast<type>(value) ^ signBit;
+      }
+    };
+
+    template <typename T>
+    struct RadixKey<T, true> {
+      typedef typename std::
+        conditional<(sizeof(T) > 4), std::uint64_t, std::uint32_t>::type type;
+      static_assert(sizeof(T) == sizeof(type), "Unsupported floating type");
+
+      static inline type get(const T &value) {
+        const type signBit = type(1) << (sizeof(type) * 8 - 1);
+        // -0 and +0 compare equal
+        const T v = (value == 0) ? T(0) : value;
+        type bits;
+        std::memcpy(&bits, &v, sizeof(type));
+        return (bits & signBit) ? ~bits : (bits | signBit);
+      }
+    };
+
+    /// Sort the vertices of a scalar field.
+    /// \param vertexNumber Number of vertices.
+    /// \param scalars Scalar values (one per vertex).
+    /// \param offsets Offset values breaking the ties of the scalar values,
+    /// nullptr to use the vertex identifiers.
+    /// \param threadNumber Number of threads.
+    /// \return Returns 0 upon success, negative values otherwise.
+    template <typename scalarType, typename idType>
+    inline int compute(const SimplexId &vertexNumber,
+                       const scalarType *scalars,
+                       const idType *offsets,
+                       const int &threadNumber = 1) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(vertexNumber < 0 or (vertexNumber and !scalars))
+        return -1;
+#endif
+
+      source_ = scalars;
+      sortedVertices_.resize(vertexNumber);
+      std::iota(sortedVertices_.begin(), sortedVertices_.end(), 0);
+
+      // offsets equal to the vertex identifiers (generated offset fields)
+      // do not change the order of the identifiers
+      bool isIdentity = (offsets != nullptr);
+      if(offsets) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber) reduction(&& : isIdentity)
+#endif
+        for(SimplexId i = 0; i < vertexNumber; i++)
+          isIdentity = isIdentity && (offsets[i] == static_cast<idType>(i));
+      }
+
+      if(offsets and !isIdentity) {
+        typedef typename RadixKey<idType>::type offsetKey;
+        std::vector<offsetKey> keys(vertexNumber);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif
+        for(SimplexId i = 0; i < vertexNumber; i++)
+          keys[i] = RadixKey<idType>::get(offsets[i]);
+        radixSort(keys, sortedVertices_, threadNumber);
+      }
+
+      {
+        // stable: keeps the offset order among equal scalar values
+        typedef typename RadixKey<scalarType>::type scalarKey;
+        std::vector<scalarKey> keys(vertexNumber);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif
+        for(SimplexId i = 0; i < vertexNumber; i++)
+          keys[i] = RadixKey<scalarType>::get(scalars[sortedVertices_[i]]);
+        radixSort(keys, sortedVertices_, threadNumber);
+      }
+
+      vertexRanks_.resize(vertexNumber);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif
+      for(SimplexId i = 0; i < vertexNumber; i++)
+        vertexRanks_[sortedVertices_[i]] = i;
+
+      return 0;
+    }
+
+    /// Check that the order is still valid for the given field (for
+    /// instance after an in-place modification of the values), in linear
+    /// time.
+    template <typename scalarType, typename idType>
+    inline bool isValid(const SimplexId &vertexNumber,
+                        const scalarType *scalars,
+                        const idType *offsets,
+                        const int &threadNumber = 1) const {
+
+      if(vertexNumber != size())
+        return false;
+
+      bool isSorted = true;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber) reduction(&& : isSorted)
+#endif
+      for(SimplexId i = 1; i < vertexNumber; i++) {
+        const SimplexId a = sortedVertices_[i - 1];
+        const SimplexId b = sortedVertices_[i];
+        const auto ka = RadixKey<scalarType>::get(scalars[a]);
+        const auto kb = RadixKey<scalarType>::get(scalars[b]);
+        if(ka != kb) {
+          isSorted = isSorted && (ka < kb);
+        } else if(offsets) {
+          const auto oa = RadixKey<idType>::get(offsets[a]);
+          const auto ob = RadixKey<idType>::get(offsets[b]);
+          isSorted = isSorted && (oa < ob or (oa == ob and a < b));
+        } else {
+          isSorted = isSorted && (a < b);
+        }
+      }
+
+      return isSorted;
+    }
+
+    /// Field the order was computed from (identifies cache entries).
+    inline const void *getSource() const {
+      return source_;
+    }
+
+    /// Vertices sorted by increasing (scalar, offset) values.
+    inline const std::vector<SimplexId> &getSortedVertices() const {
+      return sortedVertices_;
+    }
+
+    /// Position of each vertex in the sorted list.
+    inline const std::vector<SimplexId> &getVertexRanks() const {
+      return vertexRanks_;
+    }
+
+    inline SimplexId size() const {
+      return sortedVertices_.size();
+    }
+
+    /// Memory used by the order, in bytes.
+    inline size_t footprint() const {
+      return sizeof(*this)
+             + (sortedVertices_.capacity() + vertexRanks_.capacity())
+                 * sizeof(SimplexId);
+    }
+
+    /// Stable LSD radix sort of \p ids by \p keys (one key per id), one byte
+    /// per pass. The bytes shared by all the keys are skipped. The keys are
+    /// permuted along with the ids.
+    template <typename keyType>
+    static inline void radixSort(std::vector<keyType> &keys,
+                                 std::vector<SimplexId> &ids,
+                                 const int &threadNumber = 1) {
+
+      const SimplexId n = ids.size();
+      const int chunkNumber = std::max(1, threadNumber);
+      const SimplexId chunkSize = (n + chunkNumber - 1) / chunkNumber;
+
+      // bits that differ among the keys
+      keyType allAnd = ~keyType(0), allOr = 0;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber) \
+  reduction(& : allAnd) reduction(| : allOr)
+#endif
+      for(SimplexId i = 0; i < n; i++) {
+        allAnd &= keys[i];
+        allOr |= keys[i];
+      }
+      const keyType variableBits = allAnd ^ allOr;
+
+      std::vector<keyType> keyBuffer;
+      std::vector<SimplexId> idBuffer;
+      std::vector<SimplexId> histograms(chunkNumber * 256);
+
+      for(size_t shift = 0; shift < sizeof(keyType) * 8; shift += 8) {
+        if(!((variableBits >> shift) & 0xff))
+          continue;
+
+        if(keyBuffer.empty()) {
+          keyBuffer.resize(n);
+          idBuffer.resize(n);
+        }
+
+        std::fill(histograms.begin(), histograms.end(), 0);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif
+        for(int c = 0; c < chunkNumber; c++) {
+          SimplexId *histogram = &histograms[c * 256];
+          const SimplexId end = std::min(n, (c + 1) * chunkSize);
+          for(SimplexId i = c * chunkSize; i < end; i++)
+            histogram[(keys[i] >> shift) & 0xff]++;
+        }
+
+        // exclusive prefix sum, digit major then chunk, for stability
+        SimplexId sum = 0;
+        for(int d = 0; d < 256; d++) {
+          for(int c = 0; c < chunkNumber; c++) {
+            const SimplexId count = histograms[c * 256 + d];
+            histograms[c * 256 + d] = sum;
+            sum += count;
+          }
+        }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif
+        for(int c = 0; c < chunkNumber; c++) {
+          SimplexId *cursor = &histograms[c * 256];
+          const SimplexId end = std::min(n, (c + 1) * chunkSize);
+          for(SimplexId i = c * chunkSize; i < end; i++) {
+            const SimplexId j = cursor[(keys[i] >> shift) & 0xff]++;
+            keyBuffer[j] = keys[i];
+            idBuffer[j] = ids[i];
+          }
+        }
+
+        keys.swap(keyBuffer);
+        ids.swap(idBuffer);
+      }
+    }
+
+  protected:
+    const void *source_{};
+    std::vector<SimplexId> sortedVertices_;
+    std::vector<SimplexId> vertexRanks_;
+  };
+} // namespace ttk
+
+#endif // _VERTEXORDER_H
@@ -21,6 +21,7 @@
 #include <Geometry.h>
 #include <Triangulation.h>
 #include <Wrapper.h>
+#include <limits>
 
 namespace ttk {
 
@@ -69,7 +69,8 @@ namespace ttk {
       // ---------
 
       DebugTimer timerSort;
-      sortInput<scalarType>();
+      if(sortInput<scalarType>())
+        return -1;
       printDebug(timerSort, "Sort scalars (+mirror)           ");
 
       // -------------------
@@ -284,6 +285,7 @@ namespace ttk {
       std::vector<std::vector<ExtendedUnionFind *>> &vect_baseUF_ST) {
       std::vector<float> timeSimplify(parallelParams_.nbPartitions, 0);
       std::vector<float> speedProcess(parallelParams_.nbPartitions * 2, 0);
+      std::vector<float> timePartition(parallelParams_.nbPartitions, 0);
 #ifdef TTK_ENABLE_CONTOUR_FORESTS_PARALLEL_SIMPLIFY
       SimplexId nbPairMerged = 0;
 #endif
@@ -478,8 +480,31 @@ namespace ttk {
       std::cout << "combine" << std::endl;
     }
   }
+
+  timePartition[i] = timerMergeTree.getElapsedTime();
 } // namespace ttk
 
+// -----------------------------
+// Print the partitions balance
+// -----------------------------
+
+if(params_->debugLevel >= infoMsg && parallelParams_.partitionNum == -1) {
+  std::stringstream msg;
+  msg << "[ContourForests] Partitions build time :";
+  float maxTime = 0, sumTime = 0;
+  for(idPartition i = 0; i < parallelParams_.nbPartitions; ++i) {
+    msg << " " << timePartition[i];
+    maxTime = std::max(maxTime, timePartition[i]);
+    sumTime += timePartition[i];
+  }
+  msg << std::endl;
+  // 1 for a perfect balance, nbPartitions when a partition has all the work
+  msg << "[ContourForests] Load imbalance (max / mean) : "
+      << (sumTime > 0 ? maxTime * parallelParams_.nbPartitions / sumTime : 1)
+      << std::endl;
+  dMsg(std::cout, msg.str(), infoMsg);
+}
+
 // -------------------------------------
 // Print process speed and simplify info
 // -------------------------------------
@@ -104,8 +104,9 @@ namespace ttk {
 
       /// \brief if sortedVertices_ is null, define and fill it
       /// Also fill the mirror std::vector
+      /// \return Returns 0 upon success, negative values otherwise.
       template <typename scalarType>
-      void sortInput(void);
+      int sortInput(void);
 
       /// \brief clear local data for new computation
       void flush(void) {
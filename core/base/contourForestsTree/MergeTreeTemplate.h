@@ -29,41 +29,28 @@ namespace ttk {
     // {
 
     template <typename scalarType>
-    void MergeTree::sortInput(void) {
-      const auto &nbVertices = scalars_->size;
+    int MergeTree::sortInput(void) {
       auto &sortedVect = scalars_->sortedVertices;
 
-      if(!sortedVect.size()) {
-        auto indirect_sort = [&](const size_t &a, const size_t &b) {
-          return isLower<scalarType>(a, b);
-        };
-
-        sortedVect.resize(nbVertices, 0);
-        iota(sortedVect.begin(), sortedVect.end(), 0);
+      if(!sortedVect.size() or !scalars_->mirrorVertices.size()) {
+        // shared with the other filters processing this field
+        const auto order = mesh_->getVertexOrder(
+          static_cast<const scalarType *>(scalars_->values),
+          scalars_->sosOffsets.data(), threadNumber_);
+
+        if(!order) {
+          std::stringstream msg;
+          msg << "[MergeTree] Could not sort the vertices." << std::endl;
+          dMsg(std::cerr, msg.str(), fatalMsg);
+          return -1;
+        }
 
-#ifdef TTK_ENABLE_OPENMP
-#ifdef _GLIBCXX_PARALLEL_FEATURES_H
-        // ensure this namespace exists
-        __gnu_parallel::sort(
-          sortedVect.begin(), sortedVect.end(), indirect_sort);
-#else
-        sort(sortedVect.begin(), sortedVect.end(), indirect_sort);
-#endif
-#else
-        sort(sortedVect.begin(), sortedVect.end(), indirect_sort);
-#endif
+        // the partitions of the contour forests own their arrays: copy
+        sortedVect = order->getSortedVertices();
+        scalars_->mirrorVertices = order->getVertexRanks();
       }
 
-      if(!scalars_->mirrorVertices.size()) {
-        scalars_->mirrorVertices.resize(nbVertices);
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for
-#endif
-        for(SimplexId i = 0; i < nbVertices; i++) {
-          scalars_->mirrorVertices[sortedVect[i]] = i;
-        }
-      }
+      return 0;
     }
     // }
 
@@ -218,7 +218,6 @@ int SubLevelSetTree::build() {
   vector<vector<int>> seedSuperArcs;
   vector<UnionFind *> vertexSeeds(vertexNumber_, (UnionFind *)NULL);
   vector<UnionFind *> starSets;
-  vector<bool> visitedVertices(vertexNumber_, false);
 
   SimplexId vertexId = -1, nId = -1;
   UnionFind *seed = NULL, *firstUf = NULL;
@@ -234,17 +233,19 @@ int SubLevelSetTree::build() {
     extremumList = maximumList_;
   }
 
-  set<
-    // is merging
-    pair<bool,
-         // function value
-         pair<double,
-              // vertex offset
-              pair<int,
-                   // vertex id
-                   int>>>,
-    filtrationCtCmp>
-    filtrationFront;
+  // the filtration sweeps the vertices by increasing (resp. decreasing)
+  // (scalar, offset) values: each vertex has a lower (resp. upper) neighbor
+  // or is an extremum, so this is the order in which a filtration front
+  // started at the extrema would reach them.
+  shared_ptr<const VertexOrder> vertexOrder = vertexOrder_;
+  if((!vertexOrder) || (vertexOrder->size() != vertexNumber_)
+     || (vertexOrder->getSource() != vertexScalars_->data())) {
+    shared_ptr<VertexOrder> order = make_shared<VertexOrder>();
+    order->compute(vertexNumber_, vertexScalars_->data(),
+                   vertexSoSoffsets_->data(), threadNumber_);
+    vertexOrder = order;
+  }
+  const vector<SimplexId> &sortedVertices = vertexOrder->getSortedVertices();
 
   seeds.resize(extremumList->size());
   seedSuperArcs.resize(seeds.size());
@@ -255,24 +256,27 @@ int SubLevelSetTree::build() {
 
     // open an arc
     seedSuperArcs[i].push_back(openSuperArc(makeNode((*extremumList)[i])));
+  }
 
-    // add each minimum to the filtration front
-    pair<bool, pair<double, pair<int, int>>> v;
-    v.first = isMergeTree;
-    v.second.first = (*vertexScalars_)[(*extremumList)[i]];
-    v.second.second.first = (*vertexSoSoffsets_)[(*extremumList)[i]];
-    v.second.second.second = (*extremumList)[i];
-
-    filtrationFront.insert(v);
+  // isolated vertices which are not extrema are never reached
+  int lastVertex = vertexNumber_ - 1;
+  while(lastVertex > 0) {
+    const int position
+      = isMergeTree ? lastVertex : vertexNumber_ - 1 - lastVertex;
+    vertexId = sortedVertices[position];
+    if((vertexSeeds[vertexId])
+       || (triangulation_->getVertexNeighborNumber(vertexId)))
+      break;
+    lastVertex--;
   }
 
   bool merge = false;
 
   // filtration loop
-  do {
+  for(int k = 0; k <= lastVertex; k++) {
 
-    vertexId = filtrationFront.begin()->second.second.second;
-    filtrationFront.erase(filtrationFront.begin());
+    vertexId = sortedVertices[isMergeTree ? k : vertexNumber_ - 1 - k];
+    const bool isLastVertex = (k == lastVertex);
 
     starSets.clear();
 
@@ -294,21 +298,9 @@ int SubLevelSetTree::build() {
         else if(seed != firstUf)
           merge = true;
       }
-
-      if(!visitedVertices[nId]) {
-
-        pair<bool, pair<double, pair<int, int>>> v;
-        v.first = isMergeTree;
-        v.second.first = (*vertexScalars_)[nId];
-        v.second.second.first = (*vertexSoSoffsets_)[nId];
-        v.second.second.second = nId;
-
-        filtrationFront.insert(v);
-        visitedVertices[nId] = true;
-      }
     }
 
-    if(!vertexSeeds[vertexId]) {
+    if((!vertexSeeds[vertexId]) && (starSets.size())) {
 
       vertexSeeds[vertexId] = makeUnion(starSets);
 
@@ -337,7 +329,7 @@ int SubLevelSetTree::build() {
         }
 
         int seedId = vertexSeeds[vertexId] - &(seeds[0]);
-        if(!filtrationFront.empty())
+        if(!isLastVertex)
           seedSuperArcs[seedId].push_back(openSuperArc(newNodeId));
       } else if(starSets.size()) {
         // we're dealing with a degree-2 node
@@ -345,7 +337,7 @@ int SubLevelSetTree::build() {
         int superArcId
           = seedSuperArcs[seedId][seedSuperArcs[seedId].size() - 1];
 
-        if(filtrationFront.empty()) {
+        if(isLastVertex) {
           // last vertex
           closeSuperArc(superArcId, newNodeId);
         } else {
@@ -354,10 +346,7 @@ int SubLevelSetTree::build() {
         }
       }
     }
-
-    visitedVertices[vertexId] = true;
-
-  } while(!filtrationFront.empty());
+  }
 
   {
     stringstream msg;
@@ -2425,6 +2414,11 @@ int ContourTree::build() {
       maximumList_->push_back(i);
   }
 
+  // both trees sweep the same vertex order
+  const shared_ptr<const VertexOrder> vertexOrder
+    = triangulation_->getVertexOrder(
+      vertexScalars_->data(), vertexSoSoffsets_->data(), threadNumber_);
+
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel sections
 #endif
@@ -2441,6 +2435,7 @@ int ContourTree::build() {
       mergeTree_.setVertexPositions(vertexPositions_);
       mergeTree_.setTriangulation(triangulation_);
       mergeTree_.setVertexSoSoffsets(vertexSoSoffsets_);
+      mergeTree_.setVertexOrder(vertexOrder);
       mergeTree_.build();
     }
 
@@ -2454,6 +2449,7 @@ int ContourTree::build() {
       splitTree_.setVertexScalars(vertexScalars_);
       splitTree_.setVertexPositions(vertexPositions_);
       splitTree_.setVertexSoSoffsets(vertexSoSoffsets_);
+      splitTree_.setVertexOrder(vertexOrder);
       splitTree_.setTriangulation(triangulation_);
       splitTree_.build();
     }
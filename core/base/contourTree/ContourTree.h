@@ -22,6 +22,7 @@
 
 #include <Triangulation.h>
 #include <UnionFind.h>
+#include <VertexOrder.h>
 
 #include <math.h>
 
@@ -518,6 +519,15 @@ namespace ttk {
       vertexSoSoffsets_ = vertexSoSoffsets;
     };
 
+    /// Set the order of the vertices by increasing (scalar, offset) values
+    /// swept by build(). Join and split trees of the same field can share
+    /// it. If none is set (or if it was computed for another field), build()
+    /// sorts the vertices itself.
+    inline void
+      setVertexOrder(const std::shared_ptr<const VertexOrder> &vertexOrder) {
+      vertexOrder_ = vertexOrder;
+    };
+
     virtual int simplify(const double &simplificationThreshold,
                          ContourTreeSimplificationMetric *metric = NULL);
 
@@ -563,6 +573,7 @@ namespace ttk {
     double minScalar_, maxScalar_;
     const std::vector<real> *vertexScalars_;
     std::vector<int> *vertexSoSoffsets_;
+    std::shared_ptr<const VertexOrder> vertexOrder_;
     Triangulation *triangulation_;
     std::vector<int> *minimumList_, *maximumList_;
     std::vector<Node> nodeList_, originalNodeList_;
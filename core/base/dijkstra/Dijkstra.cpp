@@ -1,6 +1,7 @@
 #include <Dijkstra.h>
 #include <array>
 #include <functional>
+#include <limits>
 #include <queue>
 
 template <typename T>
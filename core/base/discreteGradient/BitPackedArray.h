@@ -0,0 +1,156 @@
+/// \ingroup base
+/// \class ttk::dcg::BitPackedArray
+/// \date October 2019.
+///
+/// \brief Array of small integers packed in 64-bit words.
+///
+/// %BitPackedArray stores values in [-1, maxValue] with the smallest
+/// power-of-two number of bits (1 to 32) holding maxValue + 2 different
+/// values, so that an entry never spans two words. The value v is stored as
+/// v + 1, so that a zeroed word holds -1 entries.
+///
+/// Writes update the shared word atomically: distinct entries of the same
+/// word can be written concurrently by different threads. Concurrent writes
+/// on the same entry remain a race, as with a regular array.
+///
+/// It is used by ttk::dcg::DiscreteGradient to store the local index of the
+/// paired facet or cofacet of each cell (TTK_ENABLE_DCG_OPTIMIZE_MEMORY).
+/// \sa ttk::dcg::DiscreteGradient
+
+#ifndef _BITPACKEDARRAY_H
+#define _BITPACKEDARRAY_H
+
+#include <DataTypes.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ttk {
+  namespace dcg {
+
+    class BitPackedArray {
+
+    public:
+      typedef std::uint64_t wordType;
+
+      /// Proxy on an entry, for assignments through operator[].
+      class reference {
+      public:
+        reference(BitPackedArray &array, const SimplexId id)
+          : array_(array), id_(id) {
+        }
+
+        inline operator SimplexId() const {
+          return array_.get(id_);
+        }
+
+        inline reference &operator=(const SimplexId value) {
+          array_.set(id_, value);
+          return *this;
+        }
+
+        inline reference &operator=(const reference &rhs) {
+          array_.set(id_, static_cast<SimplexId>(rhs));
+          return *this;
+        }
+
+      private:
+        BitPackedArray &array_;
+        const SimplexId id_;
+      };
+
+      BitPackedArray()
+        : size_{0}, width_{1}, logEntryNumber_{6}, mask_{1}, words_{} {
+      }
+
+      /// Set the number of entries, all equal to -1.
+      /// \param size Number of entries.
+      /// \param maxValue Largest value to be stored.
+      inline void resize(const SimplexId size, const SimplexId maxValue) {
+        // bits needed for maxValue + 1, rounded up to a power of two
+        int bitNumber = 1;
+        while(bitNumber < 32
+              and (static_cast<wordType>(maxValue) + 1) >> bitNumber)
+          bitNumber++;
+        width_ = 1;
+        logEntryNumber_ = 6;
+        while(width_ < bitNumber) {
+          width_ *= 2;
+          logEntryNumber_--;
+        }
+        mask_ = (wordType(1) << width_) - 1;
+
+        size_ = size;
+        words_.assign(
+          (size + (SimplexId(1) << logEntryNumber_) - 1) >> logEntryNumber_, 0);
+      }
+
+      inline void clear() {
+        size_ = 0;
+        std::vector<wordType>().swap(words_);
+      }
+
+      inline SimplexId size() const {
+        return size_;
+      }
+
+      /// Number of bits per entry.
+      inline int getWidth() const {
+        return width_;
+      }
+
+      /// Memory used by the entries, in bytes.
+      inline size_t footprint() const {
+        return words_.capacity() * sizeof(wordType);
+      }
+
+      inline SimplexId get(const SimplexId id) const {
+        wordType word;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic read
+#endif
+        word = words_[id >> logEntryNumber_];
+        return static_cast<SimplexId>((word >> getShift(id)) & mask_) - 1;
+      }
+
+      inline void set(const SimplexId id, const SimplexId value) {
+        const int shift = getShift(id);
+        const wordType clearMask = ~(mask_ << shift);
+        const wordType bits = static_cast<wordType>(value + 1) << shift;
+        wordType &word = words_[id >> logEntryNumber_];
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic
+#endif
+        word &= clearMask;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic
+#endif
+        word |= bits;
+      }
+
+      inline SimplexId operator[](const SimplexId id) const {
+        return get(id);
+      }
+
+      inline reference operator[](const SimplexId id) {
+        return reference(*this, id);
+      }
+
+    protected:
+      inline int getShift(const SimplexId id) const {
+        return (id & ((SimplexId(1) << logEntryNumber_) - 1)) * width_;
+      }
+
+      SimplexId size_;
+      // bits per entry
+      int width_;
+      // log2 of the number of entries per word
+      int logEntryNumber_;
+      wordType mask_;
+      std::vector<wordType> words_;
+    };
+  } // namespace dcg
+} // namespace ttk
+
+#endif // _BITPACKEDARRAY_H
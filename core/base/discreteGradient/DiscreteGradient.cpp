@@ -82,6 +82,33 @@ SimplexId DiscreteGradient::getNumberOfCells(const int dimension) const {
   return -1;
 }
 
+#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
+SimplexId DiscreteGradient::getMaxCofacetNumber(const int dimension) const {
+  const SimplexId numberOfCells = getNumberOfCells(dimension);
+
+  SimplexId maxCofacetNumber{0};
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) \
+  reduction(max : maxCofacetNumber)
+#endif
+  for(SimplexId i = 0; i < numberOfCells; ++i) {
+    SimplexId cofacetNumber{0};
+    if(dimension == 0)
+      cofacetNumber = inputTriangulation_->getVertexEdgeNumber(i);
+    else if(dimension == 1 and dimensionality_ == 2)
+      cofacetNumber = inputTriangulation_->getEdgeStarNumber(i);
+    else if(dimension == 1)
+      cofacetNumber = inputTriangulation_->getEdgeTriangleNumber(i);
+    else if(dimension == 2 and dimensionality_ == 3)
+      cofacetNumber = inputTriangulation_->getTriangleStarNumber(i);
+
+    maxCofacetNumber = std::max(maxCofacetNumber, cofacetNumber);
+  }
+
+  return maxCofacetNumber;
+}
+#endif
+
 bool DiscreteGradient::isMinimum(const Cell &cell) const {
   if(cell.dim_ == 0)
     return (gradient_[0][0][cell.id_] == -1);
@@ -208,12 +235,17 @@ bool DiscreteGradient::isBoundary(const Cell &cell) const {
 SimplexId DiscreteGradient::getPairedCell(const Cell &cell,
                                           bool isReverse) const {
   SimplexId id{-1};
+#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
+  // -1 for unpaired cells
+  SimplexId localId;
+#endif
   if(dimensionality_ == 2) {
     switch(cell.dim_) {
       case 0:
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        inputTriangulation_->getVertexEdge(
-          cell.id_, gradient_[0][0][cell.id_], id);
+        localId = gradient_[0][0][cell.id_];
+        if(localId != -1)
+          inputTriangulation_->getVertexEdge(cell.id_, localId, id);
 #else
         return gradient_[0][0][cell.id_];
 #endif
@@ -222,8 +254,9 @@ SimplexId DiscreteGradient::getPairedCell(const Cell &cell,
       case 1:
         if(isReverse) {
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-          inputTriangulation_->getEdgeVertex(
-            cell.id_, gradient_[0][1][cell.id_], id);
+          localId = gradient_[0][1][cell.id_];
+          if(localId != -1)
+            inputTriangulation_->getEdgeVertex(cell.id_, localId, id);
           return id;
 #else
           return gradient_[0][1][cell.id_];
@@ -231,8 +264,9 @@ SimplexId DiscreteGradient::getPairedCell(const Cell &cell,
         }
 
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        inputTriangulation_->getEdgeStar(
-          cell.id_, gradient_[1][1][cell.id_], id);
+        localId = gradient_[1][1][cell.id_];
+        if(localId != -1)
+          inputTriangulation_->getEdgeStar(cell.id_, localId, id);
 #else
         return gradient_[1][1][cell.id_];
 #endif
@@ -241,8 +275,9 @@ SimplexId DiscreteGradient::getPairedCell(const Cell &cell,
       case 2:
         if(isReverse) {
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-          inputTriangulation_->getCellEdge(
-            cell.id_, gradient_[1][2][cell.id_], id);
+          localId = gradient_[1][2][cell.id_];
+          if(localId != -1)
+            inputTriangulation_->getCellEdge(cell.id_, localId, id);
           return id;
 #else
           return gradient_[1][2][cell.id_];
@@ -254,8 +289,9 @@ SimplexId DiscreteGradient::getPairedCell(const Cell &cell,
     switch(cell.dim_) {
       case 0:
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        inputTriangulation_->getVertexEdge(
-          cell.id_, gradient_[0][0][cell.id_], id);
+        localId = gradient_[0][0][cell.id_];
+        if(localId != -1)
+          inputTriangulation_->getVertexEdge(cell.id_, localId, id);
 #else
         return gradient_[0][0][cell.id_];
 #endif
@@ -264,8 +300,9 @@ SimplexId DiscreteGradient::getPairedCell(const Cell &cell,
       case 1:
         if(isReverse) {
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-          inputTriangulation_->getEdgeVertex(
-            cell.id_, gradient_[0][1][cell.id_], id);
+          localId = gradient_[0][1][cell.id_];
+          if(localId != -1)
+            inputTriangulation_->getEdgeVertex(cell.id_, localId, id);
           return id;
 #else
           return gradient_[0][1][cell.id_];
@@ -273,8 +310,9 @@ SimplexId DiscreteGradient::getPairedCell(const Cell &cell,
         }
 
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        inputTriangulation_->getEdgeTriangle(
-          cell.id_, gradient_[1][1][cell.id_], id);
+        localId = gradient_[1][1][cell.id_];
+        if(localId != -1)
+          inputTriangulation_->getEdgeTriangle(cell.id_, localId, id);
 #else
         return gradient_[1][1][cell.id_];
 #endif
@@ -283,8 +321,9 @@ SimplexId DiscreteGradient::getPairedCell(const Cell &cell,
       case 2:
         if(isReverse) {
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-          inputTriangulation_->getTriangleEdge(
-            cell.id_, gradient_[1][2][cell.id_], id);
+          localId = gradient_[1][2][cell.id_];
+          if(localId != -1)
+            inputTriangulation_->getTriangleEdge(cell.id_, localId, id);
           return id;
 #else
           return gradient_[1][2][cell.id_];
@@ -292,8 +331,9 @@ SimplexId DiscreteGradient::getPairedCell(const Cell &cell,
         }
 
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        inputTriangulation_->getTriangleStar(
-          cell.id_, gradient_[2][2][cell.id_], id);
+        localId = gradient_[2][2][cell.id_];
+        if(localId != -1)
+          inputTriangulation_->getTriangleStar(cell.id_, localId, id);
 #else
         return gradient_[2][2][cell.id_];
 #endif
@@ -302,8 +342,9 @@ SimplexId DiscreteGradient::getPairedCell(const Cell &cell,
       case 3:
         if(isReverse) {
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-          inputTriangulation_->getCellTriangle(
-            cell.id_, gradient_[2][3][cell.id_], id);
+          localId = gradient_[2][3][cell.id_];
+          if(localId != -1)
+            inputTriangulation_->getCellTriangle(cell.id_, localId, id);
           return id;
 #else
           return gradient_[2][3][cell.id_];
@@ -717,11 +758,15 @@ bool DiscreteGradient::getAscendingPathThroughWall(
   return false;
 }
 
-int DiscreteGradient::getDescendingWall(const wallId_t wallId,
-                                        const Cell &cell,
-                                        vector<wallId_t> &isVisited,
-                                        vector<Cell> *const wall,
-                                        set<SimplexId> *const saddles) const {
+int DiscreteGradient::getDescendingWall(
+  const wallId_t wallId,
+  const Cell &cell,
+  vector<wallId_t> &isVisited,
+  vector<Cell> *const wall,
+  vector<SimplexId> *const saddles) const {
+  if(saddles)
+    saddles->clear();
+
   if(dimensionality_ == 3) {
     if(cell.dim_ == 2) {
       // assume that cellId is a triangle
@@ -747,7 +792,7 @@ int DiscreteGradient::getDescendingWall(const wallId_t wallId,
             inputTriangulation_->getTriangleEdge(triangleId, j, edgeId);
 
             if(saddles and isSaddle1(Cell(1, edgeId)))
-              saddles->insert(edgeId);
+              saddles->push_back(edgeId);
 
             const SimplexId pairedCellId = getPairedCell(Cell(1, edgeId));
 
@@ -759,14 +804,24 @@ int DiscreteGradient::getDescendingWall(const wallId_t wallId,
     }
   }
 
+  if(saddles) {
+    sort(saddles->begin(), saddles->end());
+    const auto last = unique(saddles->begin(), saddles->end());
+    saddles->erase(last, saddles->end());
+  }
+
   return 0;
 }
 
-int DiscreteGradient::getAscendingWall(const wallId_t wallId,
-                                       const Cell &cell,
-                                       vector<wallId_t> &isVisited,
-                                       vector<Cell> *const wall,
-                                       set<SimplexId> *const saddles) const {
+int DiscreteGradient::getAscendingWall(
+  const wallId_t wallId,
+  const Cell &cell,
+  vector<wallId_t> &isVisited,
+  vector<Cell> *const wall,
+  vector<SimplexId> *const saddles) const {
+  if(saddles)
+    saddles->clear();
+
   if(dimensionality_ == 3) {
     if(cell.dim_ == 1) {
       // assume that cellId is an edge
@@ -794,7 +849,7 @@ int DiscreteGradient::getAscendingWall(const wallId_t wallId,
             inputTriangulation_->getEdgeTriangle(edgeId, j, triangleId);
 
             if(saddles and isSaddle2(Cell(2, triangleId)))
-              saddles->insert(triangleId);
+              saddles->push_back(triangleId);
 
             const SimplexId pairedCellId
               = getPairedCell(Cell(2, triangleId), true);
@@ -807,6 +862,12 @@ int DiscreteGradient::getAscendingWall(const wallId_t wallId,
     }
   }
 
+  if(saddles) {
+    sort(saddles->begin(), saddles->end());
+    const auto last = unique(saddles->begin(), saddles->end());
+    saddles->erase(last, saddles->end());
+  }
+
   return 0;
 }
 
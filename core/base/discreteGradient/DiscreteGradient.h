@@ -15,8 +15,10 @@
 #define _DISCRETEGRADIENT_H
 
 // base code includes
+#include <BitPackedArray.h>
 #include <FTMTree.h>
 #include <Geometry.h>
+#include <IndexedHeap.h>
 #include <ScalarFieldCriticalPoints.h>
 #include <Triangulation.h>
 #include <Wrapper.h>
@@ -275,55 +277,6 @@ namespace ttk {
       SimplexId numberOfSlots_;
     };
 
-    /**
-     * Comparator of VPaths, first compare persistence values then vpaths'
-     * identifiers.
-     */
-    template <typename dataType>
-    struct SaddleMaximumVPathComparator {
-      bool operator()(const std::pair<dataType, SimplexId> &v1,
-                      const std::pair<dataType, SimplexId> &v2) const {
-        const dataType persistence1 = v1.first;
-        const dataType persistence2 = v2.first;
-
-        const SimplexId vpathId1 = v1.second;
-        const SimplexId vpathId2 = v2.second;
-
-        if(persistence1 != persistence2)
-          return (persistence1 < persistence2);
-
-        return (vpathId1 < vpathId2);
-      };
-    };
-
-    /**
-     * Comparator of saddle-connectors, first compare persistence values then
-     * saddle identifiers and finally vpaths' identifiers.
-     */
-    template <typename dataType>
-    struct SaddleSaddleVPathComparator {
-      bool
-        operator()(const std::tuple<dataType, SimplexId, SimplexId> &v1,
-                   const std::tuple<dataType, SimplexId, SimplexId> &v2) const {
-        const dataType persistence1 = std::get<0>(v1);
-        const dataType persistence2 = std::get<0>(v2);
-
-        const SimplexId vpathId1 = std::get<1>(v1);
-        const SimplexId vpathId2 = std::get<1>(v2);
-
-        const SimplexId saddleId1 = std::get<2>(v1);
-        const SimplexId saddleId2 = std::get<2>(v2);
-
-        if(persistence1 != persistence2)
-          return (persistence1 < persistence2);
-
-        if(saddleId1 != saddleId2)
-          return (saddleId1 < saddleId2);
-
-        return (vpathId1 < vpathId2);
-      };
-    };
-
     /**
      * Compute and manage a discrete gradient of a function on a triangulation.
      * TTK assumes that the input dataset is made of only one connected
@@ -430,7 +383,7 @@ given dimension.
                          const dataType *const scalars,
                          const idType *const offsets,
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-                         std::vector<std::vector<char>> &gradient) const;
+                         std::vector<BitPackedArray> &gradient) const;
 #else
                          std::vector<std::vector<SimplexId>> &gradient) const;
 #endif
@@ -447,7 +400,7 @@ unpaired cells.
                           const dataType *const scalars,
                           const idType *const offsets,
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-                          std::vector<std::vector<char>> &gradient) const;
+                          std::vector<BitPackedArray> &gradient) const;
 #else
                           std::vector<std::vector<SimplexId>> &gradient) const;
 #endif
@@ -463,7 +416,7 @@ triangulation only).
                           const dataType *const scalars,
                           const idType *const offsets,
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-                          std::vector<std::vector<char>> &gradient) const;
+                          std::vector<BitPackedArray> &gradient) const;
 #else
                           std::vector<std::vector<SimplexId>> &gradient) const;
 #endif
@@ -540,8 +493,7 @@ triangulation only).
       template <typename dataType>
       int orderSaddleMaximumConnections(
         const std::vector<VPath> &vpaths,
-        std::set<std::pair<dataType, SimplexId>,
-                 SaddleMaximumVPathComparator<dataType>> &S);
+        IndexedHeap<dataType> &S);
 
       /**
        * Compute simple algebra on the vpaths to minimize the number of gradient
@@ -567,8 +519,7 @@ to be reversed.
         const std::vector<char> &isPL,
         const bool allowBoundary,
         const bool allowBruteForce,
-        std::set<std::pair<dataType, SimplexId>,
-                 SaddleMaximumVPathComparator<dataType>> &S,
+        IndexedHeap<dataType> &S,
         std::vector<SimplexId> &pl2dmt_saddle,
         std::vector<SimplexId> &pl2dmt_maximum,
         std::vector<Segment> &segments,
@@ -617,8 +568,7 @@ the discrete gradient.
       int orderSaddleSaddleConnections1(
         const std::vector<VPath> &vpaths,
         std::vector<CriticalPoint> &criticalPoints,
-        std::set<std::tuple<dataType, SimplexId, SimplexId>,
-                 SaddleSaddleVPathComparator<dataType>> &S);
+        IndexedHeap<std::pair<dataType, SimplexId>> &S);
 
       /**
        * Core of the simplification process, modify the gradient and
@@ -631,8 +581,7 @@ the discrete gradient.
         const bool allowBoundary,
         const bool allowBruteForce,
         const bool returnSaddleConnectors,
-        std::set<std::tuple<dataType, SimplexId, SimplexId>,
-                 SaddleSaddleVPathComparator<dataType>> &S,
+        IndexedHeap<std::pair<dataType, SimplexId>> &S,
         std::vector<SimplexId> &pl2dmt_saddle1,
         std::vector<SimplexId> &pl2dmt_saddle2,
         std::vector<char> &isRemovableSaddle1,
@@ -677,8 +626,7 @@ the discrete gradient.
       int orderSaddleSaddleConnections2(
         const std::vector<VPath> &vpaths,
         std::vector<CriticalPoint> &criticalPoints,
-        std::set<std::tuple<dataType, SimplexId, SimplexId>,
-                 SaddleSaddleVPathComparator<dataType>> &S);
+        IndexedHeap<std::pair<dataType, SimplexId>> &S);
 
       /**
        * Core of the simplification process, modify the gradient and
@@ -691,8 +639,7 @@ the discrete gradient.
         const bool allowBoundary,
         const bool allowBruteForce,
         const bool returnSaddleConnectors,
-        std::set<std::tuple<dataType, SimplexId, SimplexId>,
-                 SaddleSaddleVPathComparator<dataType>> &S,
+        IndexedHeap<std::pair<dataType, SimplexId>> &S,
         std::vector<SimplexId> &pl2dmt_saddle1,
         std::vector<SimplexId> &pl2dmt_saddle2,
         std::vector<char> &isRemovableSaddle1,
@@ -863,6 +810,15 @@ triangulation (equal to dimensionality+1).
        */
       SimplexId getNumberOfCells(const int dimension) const;
 
+#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
+      /**
+       * Get the largest number of cofacets of a cell of the given dimension
+(the cofacets paired by the gradient: edges of the vertices, triangles or
+stars of the edges, stars of the triangles).
+       */
+      SimplexId getMaxCofacetNumber(const int dimension) const;
+#endif
+
       /**
        * Return true if the given cell is a minimum regarding the discrete
 gradient, false otherwise.
@@ -948,21 +904,25 @@ in the gradient.
 
       /**
        * Return the 2-separatrice terminating at the given 2-saddle.
+       * The 1-saddles found on the wall are sorted, without duplicates.
        */
-      int getDescendingWall(const wallId_t wallId,
-                            const Cell &cell,
-                            std::vector<wallId_t> &isVisited,
-                            std::vector<Cell> *const wall = nullptr,
-                            std::set<SimplexId> *const saddles = nullptr) const;
+      int getDescendingWall(
+        const wallId_t wallId,
+        const Cell &cell,
+        std::vector<wallId_t> &isVisited,
+        std::vector<Cell> *const wall = nullptr,
+        std::vector<SimplexId> *const saddles = nullptr) const;
 
       /**
        * Return the 2-separatrice coming from the given 1-saddle.
+       * The 2-saddles found on the wall are sorted, without duplicates.
        */
-      int getAscendingWall(const wallId_t wallId,
-                           const Cell &cell,
-                           std::vector<wallId_t> &isVisited,
-                           std::vector<Cell> *const wall = nullptr,
-                           std::set<SimplexId> *const saddles = nullptr) const;
+      int getAscendingWall(
+        const wallId_t wallId,
+        const Cell &cell,
+        std::vector<wallId_t> &isVisited,
+        std::vector<Cell> *const wall = nullptr,
+        std::vector<SimplexId> *const saddles = nullptr) const;
 
       /**
        * Reverse the given ascending VPath.
@@ -1049,7 +1009,8 @@ tetra identifier.
       int dimensionality_;
       SimplexId numberOfVertices_;
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-      std::vector<std::vector<std::vector<char>>> gradient_;
+      // local index of the paired cell, bit-packed
+      std::vector<std::vector<BitPackedArray>> gradient_;
 #else
       std::vector<std::vector<std::vector<SimplexId>>> gradient_;
 #endif
@@ -183,7 +183,7 @@ int DiscreteGradient::assignGradient(
   const dataType *const scalars,
   const idType *const offsets,
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-  std::vector<std::vector<char>> &gradient) const {
+  std::vector<BitPackedArray> &gradient) const {
 #else
   std::vector<std::vector<SimplexId>> &gradient) const {
 #endif
@@ -206,7 +206,7 @@ int DiscreteGradient::assignGradient(
       if(alphaDim == 0) {
         SimplexId minEdgeId{-1};
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        char minEdgeLocalId{-1};
+        SimplexId minEdgeLocalId{-1};
 #endif
         SimplexId minVertexId{-1};
         const SimplexId edgeNumber
@@ -240,7 +240,7 @@ int DiscreteGradient::assignGradient(
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
           gradient[alphaDim][alpha] = minEdgeLocalId;
 
-          char minAlphaLocalId{-1};
+          SimplexId minAlphaLocalId{-1};
           for(SimplexId k = 0; k < 2; ++k) {
             SimplexId tmp;
             inputTriangulation_->getEdgeVertex(minEdgeId, k, tmp);
@@ -264,7 +264,7 @@ int DiscreteGradient::assignGradient(
 
         SimplexId minStarId{-1};
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        char minStarLocalId{-1};
+        SimplexId minStarLocalId{-1};
 #endif
         SimplexId minVertexId{-1};
         const SimplexId starNumber
@@ -300,7 +300,7 @@ int DiscreteGradient::assignGradient(
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
           gradient[alphaDim][alpha] = minStarLocalId;
 
-          char minAlphaLocalId{-1};
+          SimplexId minAlphaLocalId{-1};
           for(SimplexId k = 0; k < 3; ++k) {
             SimplexId tmp;
             inputTriangulation_->getCellEdge(minStarId, k, tmp);
@@ -326,7 +326,7 @@ int DiscreteGradient::assignGradient(
       if(alphaDim == 0) {
         SimplexId minEdgeId{-1};
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        char minEdgeLocalId{-1};
+        SimplexId minEdgeLocalId{-1};
 #endif
         SimplexId minVertexId{-1};
         const SimplexId edgeNumber
@@ -360,7 +360,7 @@ int DiscreteGradient::assignGradient(
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
           gradient[alphaDim][alpha] = minEdgeLocalId;
 
-          char minAlphaLocalId{-1};
+          SimplexId minAlphaLocalId{-1};
           for(SimplexId k = 0; k < 2; ++k) {
             SimplexId tmp;
             inputTriangulation_->getEdgeVertex(minEdgeId, k, tmp);
@@ -384,7 +384,7 @@ int DiscreteGradient::assignGradient(
 
         SimplexId minTriangleId{-1};
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        char minTriangleLocalId{-1};
+        SimplexId minTriangleLocalId{-1};
 #endif
         SimplexId minVertexId{-1};
         const SimplexId triangleNumber
@@ -420,7 +420,7 @@ int DiscreteGradient::assignGradient(
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
           gradient[alphaDim][alpha] = minTriangleLocalId;
 
-          char minAlphaLocalId{-1};
+          SimplexId minAlphaLocalId{-1};
           for(SimplexId k = 0; k < 3; ++k) {
             SimplexId tmp;
             inputTriangulation_->getTriangleEdge(minTriangleId, k, tmp);
@@ -446,7 +446,7 @@ int DiscreteGradient::assignGradient(
 
         SimplexId minStarId{-1};
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        char minStarLocalId{-1};
+        SimplexId minStarLocalId{-1};
 #endif
         SimplexId minVertexId{-1};
         const SimplexId starNumber
@@ -485,7 +485,7 @@ int DiscreteGradient::assignGradient(
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
           gradient[alphaDim][alpha] = minStarLocalId;
 
-          char minAlphaLocalId{-1};
+          SimplexId minAlphaLocalId{-1};
           for(SimplexId k = 0; k < 4; ++k) {
             SimplexId tmp;
             inputTriangulation_->getCellTriangle(minStarId, k, tmp);
@@ -514,7 +514,7 @@ int DiscreteGradient::assignGradient2(
   const dataType *const scalars,
   const idType *const offsets,
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-  std::vector<std::vector<char>> &gradient) const {
+  std::vector<BitPackedArray> &gradient) const {
 #else
   std::vector<std::vector<SimplexId>> &gradient) const {
 #endif
@@ -544,7 +544,7 @@ int DiscreteGradient::assignGradient2(
 
         SimplexId minStarId{-1};
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        char minStarLocalId{-1};
+        SimplexId minStarLocalId{-1};
 #endif
         SimplexId minVertexId{-1};
         const SimplexId starNumber
@@ -584,7 +584,7 @@ int DiscreteGradient::assignGradient2(
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
           gradient[alphaDim][alpha] = minStarLocalId;
 
-          char minAlphaLocalId{-1};
+          SimplexId minAlphaLocalId{-1};
           for(SimplexId k = 0; k < 3; ++k) {
             SimplexId tmp;
             inputTriangulation_->getCellEdge(minStarId, k, tmp);
@@ -617,7 +617,7 @@ int DiscreteGradient::assignGradient2(
 
           SimplexId minTriangleId{-1};
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-          char minTriangleLocalId{-1};
+          SimplexId minTriangleLocalId{-1};
 #endif
           SimplexId minVertexId{-1};
           const SimplexId triangleNumber
@@ -657,7 +657,7 @@ int DiscreteGradient::assignGradient2(
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
             gradient[alphaDim][alpha] = minTriangleLocalId;
 
-            char minAlphaLocalId{-1};
+            SimplexId minAlphaLocalId{-1};
             for(SimplexId k = 0; k < 3; ++k) {
               SimplexId tmp;
               inputTriangulation_->getTriangleEdge(minTriangleId, k, tmp);
@@ -694,7 +694,7 @@ int DiscreteGradient::assignGradient2(
 
           SimplexId minStarId{-1};
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-          char minStarLocalId{-1};
+          SimplexId minStarLocalId{-1};
 #endif
           SimplexId minVertexId{-1};
           const SimplexId starNumber
@@ -734,7 +734,7 @@ int DiscreteGradient::assignGradient2(
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
             gradient[alphaDim][alpha] = minStarLocalId;
 
-            char minAlphaLocalId{-1};
+            SimplexId minAlphaLocalId{-1};
             for(SimplexId k = 0; k < 4; ++k) {
               SimplexId tmp;
               inputTriangulation_->getCellTriangle(minStarId, k, tmp);
@@ -764,7 +764,7 @@ int DiscreteGradient::assignGradient3(
   const dataType *const scalars,
   const idType *const offsets,
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-  std::vector<std::vector<char>> &gradient) const {
+  std::vector<BitPackedArray> &gradient) const {
 #else
   std::vector<std::vector<SimplexId>> &gradient) const {
 #endif
@@ -805,7 +805,7 @@ int DiscreteGradient::assignGradient3(
 
         SimplexId minStarId{-1};
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-        char minStarLocalId{-1};
+        SimplexId minStarLocalId{-1};
 #endif
         SimplexId minVertexId{-1};
         const SimplexId starNumber
@@ -845,7 +845,7 @@ int DiscreteGradient::assignGradient3(
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
           gradient[alphaDim][alpha] = minStarLocalId;
 
-          char minAlphaLocalId{-1};
+          SimplexId minAlphaLocalId{-1};
           for(SimplexId k = 0; k < 4; ++k) {
             SimplexId tmp;
             inputTriangulation_->getCellTriangle(minStarId, k, tmp);
@@ -891,8 +891,15 @@ int DiscreteGradient::buildGradient() {
   for(int i = 0; i < dimensionality_; ++i) {
     // init gradient memory
     gradient_[i].resize(numberOfDimensions);
+#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
+    // local index of the paired cofacet of the i-cells and of the paired
+    // facet of the (i+1)-cells (among i+2), with as few bits as possible
+    gradient_[i][i].resize(numberOfCells[i], getMaxCofacetNumber(i) - 1);
+    gradient_[i][i + 1].resize(numberOfCells[i + 1], i + 1);
+#else
     gradient_[i][i].resize(numberOfCells[i], -1);
     gradient_[i][i + 1].resize(numberOfCells[i + 1], -1);
+#endif
 
     // compute gradient pairs
     assignGradient<dataType, idType>(i, scalars, offsets, gradient_[i]);
@@ -1434,8 +1441,7 @@ int DiscreteGradient::getRemovableSaddles2(
 template <typename dataType>
 int DiscreteGradient::orderSaddleMaximumConnections(
   const std::vector<VPath> &vpaths,
-  std::set<std::pair<dataType, SimplexId>,
-           SaddleMaximumVPathComparator<dataType>> &S) {
+  IndexedHeap<dataType> &S) {
   Timer t;
 
   const SimplexId numberOfVPaths = vpaths.size();
@@ -1443,7 +1449,7 @@ int DiscreteGradient::orderSaddleMaximumConnections(
     const VPath &vpath = vpaths[i];
 
     if(vpath.isValid_)
-      S.insert(std::make_pair(vpath.persistence_, i));
+      S.push(i, vpath.persistence_);
   }
 
   {
@@ -1774,8 +1780,7 @@ int DiscreteGradient::processSaddleMaximumConnections(
   const std::vector<char> &isPL,
   const bool allowBoundary,
   const bool allowBruteForce,
-  std::set<std::pair<dataType, SimplexId>,
-           SaddleMaximumVPathComparator<dataType>> &S,
+  IndexedHeap<dataType> &S,
   std::vector<SimplexId> &pl2dmt_saddle,
   std::vector<SimplexId> &pl2dmt_maximum,
   std::vector<Segment> &segments,
@@ -1806,9 +1811,7 @@ int DiscreteGradient::processSaddleMaximumConnections(
     if(iterationThreshold >= 0 and numberOfIterations >= iterationThreshold)
       break;
 
-    auto ptr = S.begin();
-    const SimplexId vpathId = ptr->second;
-    S.erase(ptr);
+    const SimplexId vpathId = S.pop();
     VPath &vpath = vpaths[vpathId];
 
     // filter by saddle condition
@@ -2055,15 +2058,12 @@ int DiscreteGradient::processSaddleMaximumConnections(
         CriticalPoint &newDestination = criticalPoints[newDestinationId];
         newDestination.vpaths_.push_back(newVPathId);
 
-        // erase newVPath
-        S.erase(std::make_pair(newVPath.persistence_, newVPathId));
-
         // update persistence
         newVPath.persistence_ = getPersistence<dataType>(
           newDestination.cell_, newSource.cell_, scalars);
 
-        // repush newVPath to confirm update
-        S.insert(std::make_pair(newVPath.persistence_, newVPathId));
+        // update the key of newVPath
+        S.push(newVPathId, newVPath.persistence_);
       }
 
       // invalid source.vpaths
@@ -2130,10 +2130,8 @@ int DiscreteGradient::simplifySaddleMaximumConnections(
 
   // Part 2 : push the vpaths into a set to order them by persistence
   // value - lower to higher (gradient is not modified).
-  SaddleMaximumVPathComparator<dataType> cmp_f;
-  std::set<std::pair<dataType, SimplexId>,
-           SaddleMaximumVPathComparator<dataType>>
-    S(cmp_f);
+  IndexedHeap<dataType> S;
+  S.reserve(vpaths.size());
   orderSaddleMaximumConnections<dataType>(vpaths, S);
 
   // Part 3 : iteratively process the vpaths, virtually reverse the
@@ -2211,12 +2209,13 @@ int DiscreteGradient::initializeSaddleSaddleConnections1(
   // apriori: by default construction, the vpaths and segments are not valid
   wallId_t descendingWallId = 1;
   std::vector<wallId_t> isVisited(numberOfSaddle2Candidates, 0);
+  // saddles of the walls, reused across the iterations
+  std::vector<SimplexId> saddles1;
   for(SimplexId i = 0; i < numberOf2Saddles; ++i) {
     const SimplexId destinationIndex = i;
     CriticalPoint &destination = criticalPoints[destinationIndex];
     const Cell &saddle2 = destination.cell_;
 
-    std::set<SimplexId> saddles1;
     const wallId_t savedDescendingWallId = descendingWallId;
     getDescendingWall(descendingWallId, saddle2, isVisited, nullptr, &saddles1);
     ++descendingWallId;
@@ -2295,8 +2294,7 @@ template <typename dataType>
 int DiscreteGradient::orderSaddleSaddleConnections1(
   const std::vector<VPath> &vpaths,
   std::vector<CriticalPoint> &criticalPoints,
-  std::set<std::tuple<dataType, SimplexId, SimplexId>,
-           SaddleSaddleVPathComparator<dataType>> &S) {
+  IndexedHeap<std::pair<dataType, SimplexId>> &S) {
   Timer t;
 
   const SimplexId numberOfVPaths = vpaths.size();
@@ -2305,7 +2303,7 @@ int DiscreteGradient::orderSaddleSaddleConnections1(
 
     if(vpath.isValid_) {
       const SimplexId saddleId = criticalPoints[vpath.destination_].cell_.id_;
-      S.insert(std::make_tuple(vpath.persistence_, i, saddleId));
+      S.push(i, std::make_pair(vpath.persistence_, saddleId));
     }
   }
 
@@ -2326,8 +2324,7 @@ int DiscreteGradient::processSaddleSaddleConnections1(
   const bool allowBoundary,
   const bool allowBruteForce,
   const bool returnSaddleConnectors,
-  std::set<std::tuple<dataType, SimplexId, SimplexId>,
-           SaddleSaddleVPathComparator<dataType>> &S,
+  IndexedHeap<std::pair<dataType, SimplexId>> &S,
   std::vector<SimplexId> &pl2dmt_saddle1,
   std::vector<SimplexId> &pl2dmt_saddle2,
   std::vector<char> &isRemovableSaddle1,
@@ -2347,15 +2344,15 @@ int DiscreteGradient::processSaddleSaddleConnections1(
   const SimplexId optimizedSize = std::max(numberOfEdges, numberOfTriangles);
   wallId_t wallId = 1;
   std::vector<wallId_t> isVisited(optimizedSize, 0);
+  // saddles of the walls, reused across the iterations
+  std::vector<SimplexId> saddles1, saddles2;
 
   int numberOfIterations{};
   while(!S.empty()) {
     if(iterationThreshold >= 0 and numberOfIterations >= iterationThreshold)
       break;
 
-    auto ptr = S.begin();
-    const SimplexId vpathId = std::get<1>(*ptr);
-    S.erase(ptr);
+    const SimplexId vpathId = S.pop();
     VPath &vpath = vpaths[vpathId];
 
     if(vpath.isValid_) {
@@ -2368,14 +2365,14 @@ int DiscreteGradient::processSaddleSaddleConnections1(
       const Cell &minSaddle1 = criticalPoints[vpath.source_].cell_;
       const Cell &minSaddle2 = criticalPoints[vpath.destination_].cell_;
 
-      std::set<SimplexId> saddles1;
       const wallId_t savedWallId = wallId;
       getDescendingWall(wallId, minSaddle2, isVisited, nullptr, &saddles1);
       ++wallId;
 
       // check if at least one connection exists
-      auto isFound = saddles1.find(minSaddle1.id_);
-      if(isFound == saddles1.end()) {
+      const bool isFound = std::binary_search(
+        saddles1.begin(), saddles1.end(), minSaddle1.id_);
+      if(!isFound) {
         ++numberOfIterations;
         continue;
       }
@@ -2579,7 +2576,6 @@ int DiscreteGradient::processSaddleSaddleConnections1(
         CriticalPoint &newDestination = criticalPoints[newDestinationId];
         const Cell &saddle2 = newDestination.cell_;
 
-        std::set<SimplexId> saddles1;
         const wallId_t savedWallId = wallId;
         getDescendingWall(wallId, saddle2, isVisited, nullptr, &saddles1);
         ++wallId;
@@ -2620,9 +2616,9 @@ int DiscreteGradient::processSaddleSaddleConnections1(
           newDestination.vpaths_.push_back(newVPathId);
           newSource.vpaths_.push_back(newVPathId);
 
-          // update set
-          S.insert(
-            std::make_tuple(persistence, newVPathId, newDestination.cell_.id_));
+          // update heap
+          S.push(
+            newVPathId, std::make_pair(persistence, newDestination.cell_.id_));
         }
       }
 
@@ -2631,7 +2627,6 @@ int DiscreteGradient::processSaddleSaddleConnections1(
         CriticalPoint &newSource = criticalPoints[newSourceId];
         const Cell &saddle1 = newSource.cell_;
 
-        std::set<SimplexId> saddles2;
         const wallId_t savedWallId = wallId;
         getAscendingWall(wallId, saddle1, isVisited, nullptr, &saddles2);
         ++wallId;
@@ -2680,9 +2675,9 @@ int DiscreteGradient::processSaddleSaddleConnections1(
           newDestination.vpaths_.push_back(newVPathId);
           newSource.vpaths_.push_back(newVPathId);
 
-          // update set
-          S.insert(
-            std::make_tuple(persistence, newVPathId, newDestination.cell_.id_));
+          // update heap
+          S.push(
+            newVPathId, std::make_pair(persistence, newDestination.cell_.id_));
         }
       }
     }
@@ -2730,10 +2725,8 @@ int DiscreteGradient::simplifySaddleSaddleConnections1(
     dmt_criticalPoints, saddle1Index, saddle2Index);
 
   // Part 2 : push the vpaths and order by persistence
-  SaddleSaddleVPathComparator<dataType> cmp_f;
-  std::set<std::tuple<dataType, SimplexId, SimplexId>,
-           SaddleSaddleVPathComparator<dataType>>
-    S(cmp_f);
+  IndexedHeap<std::pair<dataType, SimplexId>> S;
+  S.reserve(vpaths.size());
   orderSaddleSaddleConnections1<dataType>(vpaths, dmt_criticalPoints, S);
 
   // Part 3 : process the vpaths
@@ -2806,12 +2799,13 @@ int DiscreteGradient::initializeSaddleSaddleConnections2(
   // apriori: by default construction, the vpaths and segments are not valid
   wallId_t ascendingWallId = 1;
   std::vector<wallId_t> isVisited(numberOfSaddle1Candidates, 0);
+  // saddles of the walls, reused across the iterations
+  std::vector<SimplexId> saddles2;
   for(SimplexId i = 0; i < numberOf1Saddles; ++i) {
     const SimplexId sourceIndex = i;
     CriticalPoint &source = criticalPoints[sourceIndex];
     const Cell &saddle1 = source.cell_;
 
-    std::set<SimplexId> saddles2;
     const wallId_t savedAscendingWallId = ascendingWallId;
     getAscendingWall(ascendingWallId, saddle1, isVisited, nullptr, &saddles2);
     ++ascendingWallId;
@@ -2889,8 +2883,7 @@ template <typename dataType>
 int DiscreteGradient::orderSaddleSaddleConnections2(
   const std::vector<VPath> &vpaths,
   std::vector<CriticalPoint> &criticalPoints,
-  std::set<std::tuple<dataType, SimplexId, SimplexId>,
-           SaddleSaddleVPathComparator<dataType>> &S) {
+  IndexedHeap<std::pair<dataType, SimplexId>> &S) {
   Timer t;
 
   const SimplexId numberOfVPaths = vpaths.size();
@@ -2899,7 +2892,7 @@ int DiscreteGradient::orderSaddleSaddleConnections2(
 
     if(vpath.isValid_) {
       const SimplexId saddleId = criticalPoints[vpath.source_].cell_.id_;
-      S.insert(std::make_tuple(vpath.persistence_, i, saddleId));
+      S.push(i, std::make_pair(vpath.persistence_, saddleId));
     }
   }
 
@@ -2920,8 +2913,7 @@ int DiscreteGradient::processSaddleSaddleConnections2(
   const bool allowBoundary,
   const bool allowBruteForce,
   const bool returnSaddleConnectors,
-  std::set<std::tuple<dataType, SimplexId, SimplexId>,
-           SaddleSaddleVPathComparator<dataType>> &S,
+  IndexedHeap<std::pair<dataType, SimplexId>> &S,
   std::vector<SimplexId> &pl2dmt_saddle1,
   std::vector<SimplexId> &pl2dmt_saddle2,
   std::vector<char> &isRemovableSaddle1,
@@ -2948,15 +2940,15 @@ int DiscreteGradient::processSaddleSaddleConnections2(
   const SimplexId optimizedSize = std::max(numberOfEdges, numberOfTriangles);
   wallId_t wallId = 1;
   std::vector<wallId_t> isVisited(optimizedSize, 0);
+  // saddles of the walls, reused across the iterations
+  std::vector<SimplexId> saddles1, saddles2;
 
   int numberOfIterations{};
   while(!S.empty()) {
     if(iterationThreshold >= 0 and numberOfIterations >= iterationThreshold)
       break;
 
-    auto ptr = S.begin();
-    const SimplexId vpathId = std::get<1>(*ptr);
-    S.erase(ptr);
+    const SimplexId vpathId = S.pop();
     VPath &vpath = vpaths[vpathId];
 
     if(vpath.isValid_) {
@@ -2969,14 +2961,14 @@ int DiscreteGradient::processSaddleSaddleConnections2(
       const Cell &minSaddle1 = criticalPoints[vpath.source_].cell_;
       const Cell &minSaddle2 = criticalPoints[vpath.destination_].cell_;
 
-      std::set<SimplexId> saddles2;
       const wallId_t savedWallId = wallId;
       getAscendingWall(wallId, minSaddle1, isVisited, nullptr, &saddles2);
       ++wallId;
 
       // check if at least one connection exists
-      auto isFound = saddles2.find(minSaddle2.id_);
-      if(isFound == saddles2.end()) {
+      const bool isFound = std::binary_search(
+        saddles2.begin(), saddles2.end(), minSaddle2.id_);
+      if(!isFound) {
         ++numberOfIterations;
         continue;
       }
@@ -3178,7 +3170,6 @@ int DiscreteGradient::processSaddleSaddleConnections2(
         CriticalPoint &newSource = criticalPoints[newSourceId];
         const Cell &saddle1 = newSource.cell_;
 
-        std::set<SimplexId> saddles2;
         const wallId_t savedWallId = wallId;
         getAscendingWall(wallId, saddle1, isVisited, nullptr, &saddles2);
         ++wallId;
@@ -3219,9 +3210,8 @@ int DiscreteGradient::processSaddleSaddleConnections2(
           newDestination.vpaths_.push_back(newVPathId);
           newSource.vpaths_.push_back(newVPathId);
 
-          // update set
-          S.insert(
-            std::make_tuple(persistence, newVPathId, newSource.cell_.id_));
+          // update heap
+          S.push(newVPathId, std::make_pair(persistence, newSource.cell_.id_));
         }
       }
 
@@ -3230,7 +3220,6 @@ int DiscreteGradient::processSaddleSaddleConnections2(
         CriticalPoint &newDestination = criticalPoints[newDestinationId];
         const Cell &saddle2 = newDestination.cell_;
 
-        std::set<SimplexId> saddles1;
         const wallId_t savedWallId = wallId;
         getDescendingWall(wallId, saddle2, isVisited, nullptr, &saddles1);
         ++wallId;
@@ -3278,9 +3267,8 @@ int DiscreteGradient::processSaddleSaddleConnections2(
           newDestination.vpaths_.push_back(newVPathId);
           newSource.vpaths_.push_back(newVPathId);
 
-          // update set
-          S.insert(
-            std::make_tuple(persistence, newVPathId, newSource.cell_.id_));
+          // update heap
+          S.push(newVPathId, std::make_pair(persistence, newSource.cell_.id_));
         }
       }
     }
@@ -3329,10 +3317,8 @@ int DiscreteGradient::simplifySaddleSaddleConnections2(
     dmt_criticalPoints, saddle1Index, saddle2Index);
 
   // Part 2 : push the vpaths and order by persistence
-  SaddleSaddleVPathComparator<dataType> cmp_f;
-  std::set<std::tuple<dataType, SimplexId, SimplexId>,
-           SaddleSaddleVPathComparator<dataType>>
-    S(cmp_f);
+  IndexedHeap<std::pair<dataType, SimplexId>> S;
+  S.reserve(vpaths.size());
   orderSaddleSaddleConnections2<dataType>(vpaths, dmt_criticalPoints, S);
 
   // Part 3 : process the vpaths
@@ -3397,7 +3383,8 @@ int DiscreteGradient::filterSaddleConnectors(const bool allowBoundary) {
   contourTree.setVertexSoSoffsets(offsets);
   contourTree.setThreadNumber(threadNumber_);
   contourTree.setSegmentation(false);
-  contourTree.build<dataType, SimplexId>();
+  if(contourTree.build<dataType, SimplexId>())
+    return -1;
   ftm::FTMTree_MT *tree = contourTree.getTree(ftm::TreeType::Contour);
 
   const SimplexId numberOfNodes = tree->getNumberOfNodes();
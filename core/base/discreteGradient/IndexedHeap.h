@@ -0,0 +1,165 @@
+/// \ingroup base
+/// \class ttk::dcg::IndexedHeap
+/// \date October 2019.
+///
+/// \brief Binary min-heap of identifiers with updatable keys.
+///
+/// %IndexedHeap orders identifiers in [0, n) by increasing key, ties being
+/// broken by increasing identifier, which is the order of a std::set of
+/// (key, identifier) pairs. The position of each identifier in the heap is
+/// stored, so that its key can be updated or removed in logarithmic time
+/// without searching. The arrays grow with the largest identifier and are
+/// reused across pushes and pops, so that no allocation happens per
+/// element.
+///
+/// It is used by ttk::dcg::DiscreteGradient to order the v-paths by
+/// persistence during the simplification.
+/// \sa ttk::dcg::DiscreteGradient
+
+#ifndef _INDEXEDHEAP_H
+#define _INDEXEDHEAP_H
+
+#include <DataTypes.h>
+
+#include <vector>
+
+namespace ttk {
+  namespace dcg {
+
+    template <typename keyType>
+    class IndexedHeap {
+
+    public:
+      inline bool empty() const {
+        return heap_.empty();
+      }
+
+      inline SimplexId size() const {
+        return heap_.size();
+      }
+
+      inline void clear() {
+        heap_.clear();
+        keys_.clear();
+        positions_.clear();
+      }
+
+      /// Allocate the arrays for the identifiers in [0, n).
+      inline void reserve(const SimplexId n) {
+        heap_.reserve(n);
+        keys_.reserve(n);
+        positions_.reserve(n);
+      }
+
+      inline bool contains(const SimplexId id) const {
+        return id < static_cast<SimplexId>(positions_.size())
+               and positions_[id] != -1;
+      }
+
+      /// Insert \p id with the given key, or update its key if it is already
+      /// in the heap.
+      inline void push(const SimplexId id, const keyType &key) {
+        if(id >= static_cast<SimplexId>(positions_.size())) {
+          positions_.resize(id + 1, -1);
+          keys_.resize(id + 1);
+        }
+
+        keys_[id] = key;
+        if(positions_[id] == -1) {
+          positions_[id] = heap_.size();
+          heap_.push_back(id);
+          siftUp(positions_[id]);
+        } else {
+          siftUp(positions_[id]);
+          siftDown(positions_[id]);
+        }
+      }
+
+      /// Identifier with the lowest key.
+      inline SimplexId top() const {
+        return heap_[0];
+      }
+
+      inline const keyType &getKey(const SimplexId id) const {
+        return keys_[id];
+      }
+
+      /// Remove and return the identifier with the lowest key.
+      inline SimplexId pop() {
+        const SimplexId id = heap_[0];
+        erase(id);
+        return id;
+      }
+
+      /// Remove \p id from the heap, if present.
+      inline void erase(const SimplexId id) {
+        if(!contains(id))
+          return;
+
+        const SimplexId position = positions_[id];
+        const SimplexId last = heap_.back();
+        heap_.pop_back();
+        positions_[id] = -1;
+
+        if(last != id) {
+          heap_[position] = last;
+          positions_[last] = position;
+          siftUp(position);
+          siftDown(positions_[last]);
+        }
+      }
+
+    protected:
+      inline bool isLower(const SimplexId a, const SimplexId b) const {
+        if(keys_[a] < keys_[b])
+          return true;
+        if(keys_[b] < keys_[a])
+          return false;
+        return a < b;
+      }
+
+      inline void place(const SimplexId position, const SimplexId id) {
+        heap_[position] = id;
+        positions_[id] = position;
+      }
+
+      inline void siftUp(SimplexId position) {
+        const SimplexId id = heap_[position];
+        while(position > 0) {
+          const SimplexId parent = (position - 1) / 2;
+          if(!isLower(id, heap_[parent]))
+            break;
+          place(position, heap_[parent]);
+          position = parent;
+        }
+        place(position, id);
+      }
+
+      inline void siftDown(SimplexId position) {
+        const SimplexId id = heap_[position];
+        const SimplexId n = heap_.size();
+        while(true) {
+          SimplexId child = 2 * position + 1;
+          if(child >= n)
+            break;
+          if(child + 1 < n and isLower(heap_[child + 1], heap_[child]))
+            ++child;
+          if(!isLower(heap_[child], id))
+            break;
+          place(position, heap_[child]);
+          position = child;
+        }
+        place(position, id);
+      }
+
+      // identifiers, heap ordered
+      std::vector<SimplexId> heap_;
+      // key of each identifier
+      std::vector<keyType> keys_;
+      // position of each identifier in heap_ (-1 if absent)
+      std::vector<SimplexId> positions_;
+    };
+  } // namespace dcg
+} // namespace ttk
+
+#endif // _INDEXEDHEAP_H
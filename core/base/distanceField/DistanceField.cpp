@@ -6,7 +6,7 @@ using namespace ttk;
 DistanceField::DistanceField()
   : vertexNumber_{}, sourceNumber_{}, triangulation_{},
     vertexIdentifierScalarFieldPointer_{}, outputScalarFieldPointer_{},
-    outputIdentifiers_{}, outputSegmentation_{} {
+    outputIdentifiers_{}, outputSegmentation_{}, deltaStepping_{} {
 }
 
 DistanceField::~DistanceField() {
@@ -10,6 +10,10 @@
 /// identifiers attached to them) and produces a distance field to the closest
 /// source.
 ///
+/// The distances to all the sources are propagated at once (multi-source
+/// Dijkstra, or optionally delta-stepping for large meshes), hence the memory
+/// footprint only depends on the number of vertices.
+///
 /// \b Related \b publication \n
 /// "A note on two problems in connexion with graphs" \n
 /// Edsger W. Dijkstra \n
@@ -21,13 +25,15 @@
 #define _DISTANCEFIELD_H
 
 // base code includes
-#include <Dijkstra.h>
 #include <Geometry.h>
 #include <Triangulation.h>
 #include <Wrapper.h>
 
 // std includes
+#include <algorithm>
+#include <functional>
 #include <limits>
+#include <queue>
 #include <set>
 
 namespace ttk {
@@ -82,7 +88,44 @@ namespace ttk {
       return 0;
     }
 
+    /// Use the (parallel) delta-stepping algorithm with buckets of width
+    /// \p delta instead of Dijkstra's algorithm (0 to disable).
+    /// \note The buckets are stored in a circular array of
+    /// (longest edge / \p delta + 2) entries, hence \p delta is raised to
+    /// keep this number under maxBucketNumber_.
+    inline int setDeltaStepping(const double &delta) {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(!(delta >= 0))
+        return -1;
+#endif
+      deltaStepping_ = delta;
+      return 0;
+    }
+
   protected:
+    template <typename dataType>
+    struct Request {
+      SimplexId vertexId;
+      dataType distance;
+      SimplexId seed;
+    };
+
+    template <typename dataType>
+    int relaxNeighbors(const SimplexId vertexId,
+                       dataType *dist,
+                       SimplexId *seg,
+                       std::vector<Request<dataType>> &requests) const;
+
+    template <typename dataType>
+    int multiSourceDijkstra(const std::vector<SimplexId> &sources,
+                            dataType *dist,
+                            SimplexId *seg) const;
+
+    template <typename dataType>
+    int deltaStepping(const std::vector<SimplexId> &sources,
+                      dataType *dist,
+                      SimplexId *seg) const;
+
     SimplexId vertexNumber_;
     SimplexId sourceNumber_;
     Triangulation *triangulation_;
@@ -90,9 +133,177 @@ namespace ttk {
     void *outputScalarFieldPointer_;
     void *outputIdentifiers_;
     void *outputSegmentation_;
+    double deltaStepping_;
+    static const size_t maxBucketNumber_ = 65536;
   };
 } // namespace ttk
 
+template <typename dataType>
+int ttk::DistanceField::relaxNeighbors(
+  const SimplexId vertexId,
+  dataType *dist,
+  SimplexId *seg,
+  std::vector<Request<dataType>> &requests) const {
+
+  float p[3];
+  triangulation_->getVertexPoint(vertexId, p[0], p[1], p[2]);
+
+  const SimplexId neighborNumber
+    = triangulation_->getVertexNeighborNumber(vertexId);
+  for(SimplexId i = 0; i < neighborNumber; ++i) {
+    SimplexId neighborId;
+    triangulation_->getVertexNeighbor(vertexId, i, neighborId);
+
+    float q[3];
+    triangulation_->getVertexPoint(neighborId, q[0], q[1], q[2]);
+
+    const dataType d = dist[vertexId] + Geometry::distance(p, q);
+    // ties are broken by source index
+    if(d < dist[neighborId]
+       or (d == dist[neighborId] and seg[vertexId] < seg[neighborId]))
+      requests.push_back({neighborId, d, seg[vertexId]});
+  }
+
+  return 0;
+}
+
+template <typename dataType>
+int ttk::DistanceField::multiSourceDijkstra(
+  const std::vector<SimplexId> &sources, dataType *dist, SimplexId *seg) const {
+
+  using pq_t = std::pair<dataType, SimplexId>;
+  std::priority_queue<pq_t, std::vector<pq_t>, std::greater<pq_t>> pq;
+
+  for(SimplexId i = 0; i < (SimplexId)sources.size(); ++i) {
+    dist[sources[i]] = 0;
+    seg[sources[i]] = i;
+    pq.push(std::make_pair(dataType(0), sources[i]));
+  }
+
+  std::vector<Request<dataType>> requests;
+
+  while(!pq.empty()) {
+    const pq_t elem = pq.top();
+    pq.pop();
+
+    // outdated entry
+    if(elem.first > dist[elem.second])
+      continue;
+
+    requests.clear();
+    relaxNeighbors(elem.second, dist, seg, requests);
+
+    for(const auto &r : requests) {
+      dist[r.vertexId] = r.distance;
+      seg[r.vertexId] = r.seed;
+      pq.push(std::make_pair(r.distance, r.vertexId));
+    }
+  }
+
+  return 0;
+}
+
+template <typename dataType>
+int ttk::DistanceField::deltaStepping(const std::vector<SimplexId> &sources,
+                                      dataType *dist,
+                                      SimplexId *seg) const {
+
+  // longest edge of the mesh
+  double maxEdgeLength = 0;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) \
+  reduction(max : maxEdgeLength)
+#endif
+  for(SimplexId i = 0; i < vertexNumber_; ++i) {
+    float p[3], q[3];
+    triangulation_->getVertexPoint(i, p[0], p[1], p[2]);
+    const SimplexId neighborNumber = triangulation_->getVertexNeighborNumber(i);
+    for(SimplexId j = 0; j < neighborNumber; ++j) {
+      SimplexId neighborId{-1};
+      triangulation_->getVertexNeighbor(i, j, neighborId);
+      triangulation_->getVertexPoint(neighborId, q[0], q[1], q[2]);
+      maxEdgeLength
+        = std::max(maxEdgeLength, (double)Geometry::distance(p, q));
+    }
+  }
+
+  // when a vertex of the bucket k is relaxed, its neighbors land in the
+  // buckets k to k + maxEdgeLength / delta + 1: a circular array of
+  // buckets is enough
+  const double delta = std::max(
+    deltaStepping_, maxEdgeLength / (double)(maxBucketNumber_ - 2));
+  const size_t bucketNumber = (size_t)(maxEdgeLength / delta) + 2;
+
+  if(delta > deltaStepping_) {
+    std::stringstream msg;
+    msg << "[DistanceField] Delta raised to " << delta << " (at most "
+        << maxBucketNumber_ << " buckets)." << std::endl;
+    dMsg(std::cout, msg.str(), detailedInfoMsg);
+  }
+
+  // buckets[k % bucketNumber] holds (possibly outdated) vertices whose
+  // distance lies in [k * delta, (k + 1) * delta)
+  std::vector<std::vector<SimplexId>> buckets(bucketNumber);
+  size_t entryNumber = 0;
+  const auto insert = [&](const SimplexId vertexId) {
+    const size_t k = dist[vertexId] / delta;
+    buckets[k % bucketNumber].push_back(vertexId);
+    entryNumber++;
+  };
+
+  for(SimplexId i = 0; i < (SimplexId)sources.size(); ++i) {
+    dist[sources[i]] = 0;
+    seg[sources[i]] = i;
+    insert(sources[i]);
+  }
+
+  // per-thread relaxation requests, applied sequentially
+  std::vector<std::vector<Request<dataType>>> requests(threadNumber_);
+  std::vector<SimplexId> frontier;
+
+  for(size_t k = 0; entryNumber > 0; ++k) {
+    std::vector<SimplexId> &bucket = buckets[k % bucketNumber];
+    // vertices of the current bucket may be re-inserted (and processed
+    // again) until the bucket is settled
+    while(!bucket.empty()) {
+      frontier.clear();
+      frontier.swap(bucket);
+      entryNumber -= frontier.size();
+      std::sort(frontier.begin(), frontier.end());
+      frontier.erase(
+        std::unique(frontier.begin(), frontier.end()), frontier.end());
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic, 64)
+#endif
+      for(SimplexId i = 0; i < (SimplexId)frontier.size(); ++i) {
+        ThreadId threadId = 0;
+#ifdef TTK_ENABLE_OPENMP
+        threadId = omp_get_thread_num();
+#endif
+        // outdated entry (moved to a lower bucket)
+        if((size_t)(dist[frontier[i]] / delta) != k)
+          continue;
+        relaxNeighbors(frontier[i], dist, seg, requests[threadId]);
+      }
+
+      for(auto &threadRequests : requests) {
+        for(const auto &r : threadRequests) {
+          if(r.distance < dist[r.vertexId]
+             or (r.distance == dist[r.vertexId] and r.seed < seg[r.vertexId])) {
+            dist[r.vertexId] = r.distance;
+            seg[r.vertexId] = r.seed;
+            insert(r.vertexId);
+          }
+        }
+        threadRequests.clear();
+      }
+    }
+  }
+
+  return 0;
+}
+
 template <typename dataType>
 int ttk::DistanceField::execute() const {
   SimplexId *identifiers
@@ -103,8 +314,10 @@ int ttk::DistanceField::execute() const {
 
   Timer t;
 
-  std::fill(dist, dist + vertexNumber_, std::numeric_limits<dataType>::max());
+  std::fill(
+    dist, dist + vertexNumber_, std::numeric_limits<dataType>::infinity());
   std::fill(origin, origin + vertexNumber_, -1);
+  std::fill(seg, seg + vertexNumber_, -1);
 
   // get the sources
   std::set<SimplexId> isSource;
@@ -115,27 +328,18 @@ int ttk::DistanceField::execute() const {
     sources.push_back(s);
   isSource.clear();
 
-  // prepare output
-  std::vector<std::vector<dataType>> scalars(sources.size());
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif
-  for(SimplexId i = 0; i < (SimplexId)sources.size(); ++i) {
-    Dijkstra::shortestPath<dataType>(sources[i], *triangulation_, scalars[i]);
-  }
+  // single propagation from all the sources at once
+  if(deltaStepping_ > 0)
+    deltaStepping<dataType>(sources, dist, seg);
+  else
+    multiSourceDijkstra<dataType>(sources, dist, seg);
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
   for(SimplexId k = 0; k < vertexNumber_; ++k) {
-    for(SimplexId i = 0; i < (SimplexId)sources.size(); ++i) {
-      if(i == 0 or dist[k] > scalars[i][k]) {
-        dist[k] = scalars[i][k];
-        origin[k] = sources[i];
-        seg[k] = i;
-      }
-    }
+    if(seg[k] != -1)
+      origin[k] = sources[seg[k]];
   }
 
   {
@@ -1,10 +1,40 @@
 #include <ExplicitTriangulation.h>
 
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+
 using namespace std;
 using namespace ttk;
 
+// header of the cache files
+static const char cacheMagic[8] = {'T', 'T', 'K', 'C', 'A', 'C', 'H', '1'};
+
+// version of the file layout and of the simplex numbering of the skeleton
+// classes: to increment whenever one of them changes, so that the tables
+// written by previous versions are ignored.
+static const unsigned long long cacheVersion = 2;
+
+struct CacheHeader {
+  char magic[8];
+  unsigned long long version;
+  unsigned long long key;
+  unsigned long long idSize;
+  unsigned long long entryNumber;
+  unsigned long long itemNumber;
+};
+
 ExplicitTriangulation::ExplicitTriangulation() {
 
+  hasCacheKey_ = false;
+  cacheKey_ = 0;
+
+  const char *cacheDirectory = getenv("TTK_TRIANGULATION_CACHE_DIR");
+  if(cacheDirectory)
+    cacheDirectory_ = cacheDirectory;
+
   clear();
 }
 
@@ -17,6 +47,25 @@ int ExplicitTriangulation::clear() {
   cellNumber_ = 0;
   doublePrecision_ = false;
 
+  cellEdgeData_.clear();
+  cellNeighborData_.clear();
+  cellTriangleData_.clear();
+  edgeLinkData_.clear();
+  edgeStarData_.clear();
+  edgeTriangleData_.clear();
+  triangleVertexData_.clear();
+  triangleEdgeData_.clear();
+  triangleLinkData_.clear();
+  triangleStarData_.clear();
+  vertexEdgeData_.clear();
+  vertexLinkData_.clear();
+  vertexNeighborData_.clear();
+  vertexStarData_.clear();
+  vertexTriangleData_.clear();
+
+  hasCacheKey_ = false;
+  cachedTables_.clear();
+
   {
     stringstream msg;
     msg << "[ExplicitTriangulation] Triangulation cleared." << endl;
@@ -25,3 +74,426 @@ int ExplicitTriangulation::clear() {
 
   return AbstractTriangulation::clear();
 }
+
+size_t ExplicitTriangulation::flatFootprint(const FlatJaggedArray &table,
+                                            const string &tableName,
+                                            stringstream &msg) const {
+
+  if(table.size()) {
+    msg << "[ExplicitTriangulation] " << tableName << ": " << table.footprint()
+        << " bytes" << endl;
+  }
+
+  return table.footprint();
+}
+
+size_t ExplicitTriangulation::footprint() const {
+
+  // legacy tables (edge list, boundary flags and materialized relations)
+  size_t size = AbstractTriangulation::footprint();
+  stringstream msg;
+
+  size += flatFootprint(cellEdgeData_, "cellEdgeData_", msg);
+  size += flatFootprint(cellNeighborData_, "cellNeighborData_", msg);
+  size += flatFootprint(cellTriangleData_, "cellTriangleData_", msg);
+  size += flatFootprint(edgeLinkData_, "edgeLinkData_", msg);
+  size += flatFootprint(edgeStarData_, "edgeStarData_", msg);
+  size += flatFootprint(edgeTriangleData_, "edgeTriangleData_", msg);
+  size += flatFootprint(triangleVertexData_, "triangleVertexData_", msg);
+  size += flatFootprint(triangleEdgeData_, "triangleEdgeData_", msg);
+  size += flatFootprint(triangleLinkData_, "triangleLinkData_", msg);
+  size += flatFootprint(triangleStarData_, "triangleStarData_", msg);
+  size += flatFootprint(vertexEdgeData_, "vertexEdgeData_", msg);
+  size += flatFootprint(vertexLinkData_, "vertexLinkData_", msg);
+  size += flatFootprint(vertexNeighborData_, "vertexNeighborData_", msg);
+  size += flatFootprint(vertexStarData_, "vertexStarData_", msg);
+  size += flatFootprint(vertexTriangleData_, "vertexTriangleData_", msg);
+
+  msg << "[ExplicitTriangulation] Total footprint: " << (size / 1024) / 1024
+      << " MB." << endl;
+
+  dMsg(cout, msg.str(), memoryMsg);
+
+  return size;
+}
+
+string ExplicitTriangulation::getCacheFileName(const string &tableName) {
+
+  if((cacheDirectory_.empty()) || (!cellArray_) || (!cellNumber_))
+    return "";
+
+  if(!hasCacheKey_) {
+    // FNV-1a hash of the input cells (and of the vertex number)
+    const unsigned long long prime = 1099511628211ULL;
+    unsigned long long key = 14695981039346656037ULL;
+
+    key = (key ^ (unsigned long long)vertexNumber_) * prime;
+    key = (key ^ (unsigned long long)cellNumber_) * prime;
+
+    LongSimplexId position = 0;
+    for(SimplexId i = 0; i < cellNumber_; i++) {
+      const LongSimplexId vertexPerCell = cellArray_[position];
+      for(LongSimplexId j = 0; j <= vertexPerCell; j++) {
+        key = (key ^ (unsigned long long)cellArray_[position + j]) * prime;
+      }
+      position += vertexPerCell + 1;
+    }
+
+    cacheKey_ = key;
+    hasCacheKey_ = true;
+  }
+
+  char keyString[32];
+  sprintf(keyString, "%016llx", cacheKey_);
+
+  return cacheDirectory_ + "/ttkTriangulation_" + keyString + "_"
+         + tableName + ".bin";
+}
+
+// read the header of a cache file and check it against the size of the
+// file, returns the file upon success
+static FILE *openCacheFile(const string &fileName,
+                           const unsigned long long &key,
+                           const bool &hasOffsets,
+                           CacheHeader &header) {
+
+  if(fileName.empty())
+    return NULL;
+
+  FILE *f = fopen(fileName.data(), "rb");
+  if(!f)
+    return NULL;
+
+  if((fread(&header, sizeof(header), 1, f) != 1)
+     || (memcmp(header.magic, cacheMagic, sizeof(cacheMagic)))
+     || (header.version != cacheVersion) || (header.key != key)
+     || (header.idSize != sizeof(SimplexId))) {
+    fclose(f);
+    return NULL;
+  }
+
+  // the identifiers following the header
+  const long start = ftell(f);
+  if((start < 0) || (fseek(f, 0, SEEK_END))) {
+    fclose(f);
+    return NULL;
+  }
+  const long end = ftell(f);
+  if((end < start) || (fseek(f, start, SEEK_SET))) {
+    fclose(f);
+    return NULL;
+  }
+  const unsigned long long idNumber
+    = (unsigned long long)(end - start) / sizeof(SimplexId);
+
+  // checked before any allocation (a corrupted header would otherwise
+  // trigger huge ones)
+  const unsigned long long maxId = numeric_limits<SimplexId>::max();
+  if((header.entryNumber >= maxId) || (header.itemNumber > maxId)
+     || (header.entryNumber + hasOffsets > idNumber)
+     || (header.itemNumber != idNumber - hasOffsets * (header.entryNumber + 1))
+     || ((unsigned long long)(end - start) != idNumber * sizeof(SimplexId))) {
+    fclose(f);
+    return NULL;
+  }
+
+  return f;
+}
+
+// write a cache file (through a temporary file, to avoid exposing partial
+// files to concurrent processes)
+static int writeCacheFile(const string &fileName,
+                          const unsigned long long &key,
+                          const size_t &entryNumber,
+                          const SimplexId *offsets,
+                          const size_t &itemNumber,
+                          const SimplexId *items) {
+
+  // unique per process (several processes may preprocess the same mesh)
+  random_device randomDevice;
+  const string tmpFileName = fileName + ".tmp"
+                             + to_string(OsCall::getProcessId()) + "_"
+                             + to_string(randomDevice());
+
+  FILE *f = fopen(tmpFileName.data(), "wb");
+  if(!f)
+    return -1;
+
+  CacheHeader header;
+  memcpy(header.magic, cacheMagic, sizeof(cacheMagic));
+  header.version = cacheVersion;
+  header.key = key;
+  header.idSize = sizeof(SimplexId);
+  header.entryNumber = entryNumber;
+  header.itemNumber = itemNumber;
+
+  bool isOk = (fwrite(&header, sizeof(header), 1, f) == 1);
+  if((isOk) && (offsets))
+    isOk = (fwrite(offsets, sizeof(SimplexId), entryNumber + 1, f)
+            == entryNumber + 1);
+  if((isOk) && (itemNumber))
+    isOk = (fwrite(items, sizeof(SimplexId), itemNumber, f) == itemNumber);
+
+  if((fclose(f)) || (!isOk)) {
+    remove(tmpFileName.data());
+    return -2;
+  }
+
+  if(rename(tmpFileName.data(), fileName.data())) {
+    remove(tmpFileName.data());
+    return -3;
+  }
+
+  return 0;
+}
+
+// number of faces of a given dimension of a simplex
+static SimplexId getFaceNumber(const int &simplexDimension,
+                               const int &faceDimension) {
+  SimplexId faceNumber = 1;
+  for(int i = 0; i <= faceDimension; i++)
+    faceNumber = faceNumber * (simplexDimension + 1 - i) / (i + 1);
+  return faceNumber;
+}
+
+static bool endsWith(const string &tableName, const string &suffix) {
+  return (tableName.size() >= suffix.size())
+         && (!tableName.compare(
+           tableName.size() - suffix.size(), suffix.size(), suffix));
+}
+
+int ExplicitTriangulation::readCachedTable(const string &tableName,
+                                           FlatJaggedArray &table) {
+
+  const int dimension = getDimensionality();
+  const bool isTriangleList = (tableName == "triangles");
+
+  // dimension of the simplices the entries and the items of the table refer
+  // to (-1 for the cells)
+  int entryDimension = -1;
+  if(!tableName.compare(0, 6, "vertex"))
+    entryDimension = 0;
+  else if(!tableName.compare(0, 4, "edge"))
+    entryDimension = 1;
+  else if(!tableName.compare(0, 8, "triangle"))
+    entryDimension = 2;
+
+  int itemDimension = -1;
+  if((isTriangleList) || (tableName == "vertexNeighbors")
+     || (tableName == "triangleLinks"))
+    itemDimension = 0;
+  else if(tableName == "edgeLinks")
+    itemDimension = dimension - 2;
+  else if(tableName == "vertexLinks")
+    itemDimension = dimension - 1;
+  else if(endsWith(tableName, "Edges"))
+    itemDimension = 1;
+  else if(endsWith(tableName, "Triangles"))
+    itemDimension = 2;
+
+  // the tables referring to edges or triangles come along with the
+  // corresponding lists, as when they are computed
+  if(((entryDimension == 1) || (itemDimension == 1)) && (edgeList_.empty())
+     && (readCachedTable("edges", edgeList_)))
+    return -1;
+  if((((entryDimension == 2) && (!isTriangleList)) || (itemDimension == 2))
+     && (triangleVertexData_.empty())
+     && (readCachedTable("triangles", triangleVertexData_)))
+    return -1;
+
+  const SimplexId simplexNumbers[4]
+    = {vertexNumber_, (SimplexId)edgeList_.size(),
+       (SimplexId)triangleVertexData_.size(), cellNumber_};
+  const SimplexId itemBound
+    = simplexNumbers[itemDimension == -1 ? 3 : itemDimension];
+
+  const string fileName = getCacheFileName(tableName);
+  CacheHeader header;
+  FILE *f = openCacheFile(fileName, cacheKey_, true, header);
+  if(!f)
+    return -1;
+
+  // expected number of entries (bounded for the triangle list, which
+  // defines it)
+  const unsigned long long maxTriangleNumber
+    = (unsigned long long)cellNumber_ * getFaceNumber(dimension, 2);
+  bool isOk = true;
+  if(isTriangleList)
+    isOk = (header.itemNumber == 3 * header.entryNumber)
+           && (header.entryNumber <= maxTriangleNumber);
+  else
+    isOk = (header.entryNumber
+            == (size_t)simplexNumbers[entryDimension == -1 ? 3
+                                                           : entryDimension]);
+
+  if(!isOk) {
+    fclose(f);
+    return -2;
+  }
+
+  Timer t;
+
+  vector<SimplexId> offsets(header.entryNumber + 1);
+  vector<SimplexId> items(header.itemNumber);
+
+  isOk = (fread(offsets.data(), sizeof(SimplexId), offsets.size(), f)
+          == offsets.size())
+         && (fread(items.data(), sizeof(SimplexId), items.size(), f)
+             == items.size());
+  fclose(f);
+
+  // the offsets delimit valid slices of the item array, which only holds
+  // identifiers of existing simplices
+  isOk = isOk && (offsets[0] == 0)
+         && (offsets.back() == (SimplexId)header.itemNumber);
+  for(size_t i = 1; (isOk) && (i < offsets.size()); i++)
+    isOk = (offsets[i - 1] <= offsets[i]);
+  for(size_t i = 0; (isOk) && (i < items.size()); i++)
+    isOk = (items[i] >= 0) && (items[i] < itemBound);
+
+  if(!isOk) {
+    stringstream msg;
+    msg << "[ExplicitTriangulation] Invalid cache file for `" << tableName
+        << "', ignoring it." << endl;
+    dMsg(cerr, msg.str(), infoMsg);
+    return -2;
+  }
+
+  table.setData(std::move(offsets), std::move(items));
+  cachedTables_.insert(tableName);
+
+  {
+    stringstream msg;
+    msg << "[ExplicitTriangulation] Table `" << tableName
+        << "' read from cache in " << t.getElapsedTime() << " s." << endl;
+    dMsg(cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
+int ExplicitTriangulation::readCachedTable(
+  const string &tableName, vector<pair<SimplexId, SimplexId>> &table) {
+
+  const string fileName = getCacheFileName(tableName);
+  CacheHeader header;
+  FILE *f = openCacheFile(fileName, cacheKey_, false, header);
+  if(!f)
+    return -1;
+
+  Timer t;
+
+  // each cell has at most getFaceNumber(dimension, 1) edges
+  if((header.itemNumber != 2 * header.entryNumber)
+     || (header.entryNumber
+         > (unsigned long long)cellNumber_
+             * getFaceNumber(getDimensionality(), 1))) {
+    fclose(f);
+    return -2;
+  }
+
+  vector<pair<SimplexId, SimplexId>> edges(header.entryNumber);
+  bool isOk = (fread(edges.data(), 2 * sizeof(SimplexId), edges.size(), f)
+               == edges.size());
+  fclose(f);
+
+  for(size_t i = 0; (isOk) && (i < edges.size()); i++)
+    isOk = (edges[i].first >= 0) && (edges[i].first <= edges[i].second)
+           && (edges[i].second < vertexNumber_);
+
+  if(!isOk) {
+    stringstream msg;
+    msg << "[ExplicitTriangulation] Invalid cache file for `" << tableName
+        << "', ignoring it." << endl;
+    dMsg(cerr, msg.str(), infoMsg);
+    return -3;
+  }
+
+  table = std::move(edges);
+  cachedTables_.insert(tableName);
+
+  {
+    stringstream msg;
+    msg << "[ExplicitTriangulation] Table `" << tableName
+        << "' read from cache in " << t.getElapsedTime() << " s." << endl;
+    dMsg(cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
+int ExplicitTriangulation::writeCachedTables() {
+
+  if(cacheDirectory_.empty())
+    return 0;
+
+  Timer t;
+
+  const vector<pair<string, const FlatJaggedArray *>> tables{
+    {"cellEdges", &cellEdgeData_},
+    {"cellNeighbors", &cellNeighborData_},
+    {"cellTriangles", &cellTriangleData_},
+    {"edgeLinks", &edgeLinkData_},
+    {"edgeStars", &edgeStarData_},
+    {"edgeTriangles", &edgeTriangleData_},
+    {"triangles", &triangleVertexData_},
+    {"triangleEdges", &triangleEdgeData_},
+    {"triangleLinks", &triangleLinkData_},
+    {"triangleStars", &triangleStarData_},
+    {"vertexEdges", &vertexEdgeData_},
+    {"vertexLinks", &vertexLinkData_},
+    {"vertexNeighbors", &vertexNeighborData_},
+    {"vertexStars", &vertexStarData_},
+    {"vertexTriangles", &vertexTriangleData_}};
+
+  int writtenTables = 0;
+
+  for(const auto &table : tables) {
+    if((table.second->empty()) || (cachedTables_.count(table.first)))
+      continue;
+
+    const string fileName = getCacheFileName(table.first);
+    if(fileName.empty())
+      return -1;
+
+    if(writeCacheFile(fileName, cacheKey_, table.second->size(),
+                      table.second->getOffsets().data(),
+                      table.second->dataSize(),
+                      table.second->getData().data())) {
+      stringstream msg;
+      msg << "[ExplicitTriangulation] Could not write `" << fileName << "'."
+          << endl;
+      dMsg(cerr, msg.str(), infoMsg);
+      return -2;
+    }
+    cachedTables_.insert(table.first);
+    writtenTables++;
+  }
+
+  if((!edgeList_.empty()) && (!cachedTables_.count("edges"))) {
+    const string fileName = getCacheFileName("edges");
+    if(fileName.empty())
+      return -1;
+
+    if(writeCacheFile(fileName, cacheKey_, edgeList_.size(), NULL,
+                      2 * edgeList_.size(), &(edgeList_[0].first))) {
+      stringstream msg;
+      msg << "[ExplicitTriangulation] Could not write `" << fileName << "'."
+          << endl;
+      dMsg(cerr, msg.str(), infoMsg);
+      return -2;
+    }
+    cachedTables_.insert("edges");
+    writtenTables++;
+  }
+
+  if(writtenTables) {
+    stringstream msg;
+    msg << "[ExplicitTriangulation] " << writtenTables
+        << " table(s) written to cache in " << t.getElapsedTime() << " s."
+        << endl;
+    dMsg(cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
@@ -5,6 +5,16 @@
 ///
 /// \brief ExplicitTriangulation is a class that provides time efficient
 /// traversal methods on triangulations of piecewise linear manifolds.
+///
+/// The preprocessed tables can optionally be cached on disk (see
+/// setCacheDirectory()), so that subsequent runs on the same mesh skip the
+/// preprocessing.
+///
+/// The relations are stored in compressed (offsets + data) form only: they
+/// are traversed with the per-simplex getters or the relation views (see
+/// AbstractTriangulation::RelationView), the std::vector<std::vector>
+/// whole-relation getters are not available. Edge identifiers are sorted by
+/// increasing (first, second) vertex identifiers.
 /// \sa Triangulation
 
 #ifndef _EXPLICITTRIANGULATION_H
@@ -12,11 +22,15 @@
 
 // base code includes
 #include <AbstractTriangulation.h>
+#include <FlatJaggedArray.h>
 #include <OneSkeleton.h>
 #include <ThreeSkeleton.h>
 #include <TwoSkeleton.h>
 #include <ZeroSkeleton.h>
 
+#include <set>
+#include <string>
+
 namespace ttk {
 
   class ExplicitTriangulation final : public AbstractTriangulation {
@@ -26,60 +40,52 @@ namespace ttk {
 
     ~ExplicitTriangulation();
 
+    size_t footprint() const override;
+
     inline int getCellEdge(const SimplexId &cellId,
                            const int &localEdgeId,
                            SimplexId &edgeId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellEdgeList_.size()))
+      if((cellId < 0) || (cellId >= (SimplexId)cellEdgeData_.size()))
         return -1;
       if((localEdgeId < 0)
-         || (localEdgeId >= (SimplexId)cellEdgeList_[cellId].size()))
+         || (localEdgeId >= cellEdgeData_.size(cellId)))
         return -2;
 #endif
-      edgeId = cellEdgeList_[cellId][localEdgeId];
+      edgeId = cellEdgeData_.get(cellId, localEdgeId);
       return 0;
     }
 
     inline SimplexId getCellEdgeNumber(const SimplexId &cellId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellEdgeList_.size()))
+      if((cellId < 0) || (cellId >= (SimplexId)cellEdgeData_.size()))
         return -1;
 #endif
-      return cellEdgeList_[cellId].size();
-    }
-
-    inline const std::vector<std::vector<SimplexId>> *getCellEdges() override {
-
-      return &cellEdgeList_;
+      return cellEdgeData_.size(cellId);
     }
 
     inline int getCellNeighbor(const SimplexId &cellId,
                                const int &localNeighborId,
                                SimplexId &neighborId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellNeighborList_.size()))
+      if((cellId < 0) || (cellId >= (SimplexId)cellNeighborData_.size()))
         return -1;
       if((localNeighborId < 0)
-         || (localNeighborId >= (SimplexId)cellNeighborList_[cellId].size()))
+         || (localNeighborId >= cellNeighborData_.size(cellId)))
         return -2;
 #endif
-      neighborId = cellNeighborList_[cellId][localNeighborId];
+      neighborId = cellNeighborData_.get(cellId, localNeighborId);
       return 0;
     }
 
     inline SimplexId
       getCellNeighborNumber(const SimplexId &cellId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellNeighborList_.size()))
+      if((cellId < 0) || (cellId >= (SimplexId)cellNeighborData_.size()))
         return -1;
 #endif
-      return cellNeighborList_[cellId].size();
-    }
-
-    inline const std::vector<std::vector<SimplexId>> *
-      getCellNeighbors() override {
-      return &cellNeighborList_;
+      return cellNeighborData_.size(cellId);
     }
 
     inline int getCellTriangle(const SimplexId &cellId,
@@ -87,13 +93,13 @@ namespace ttk {
                                SimplexId &triangleId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellTriangleList_.size()))
+      if((cellId < 0) || (cellId >= (SimplexId)cellTriangleData_.size()))
         return -1;
       if((localTriangleId < 0)
-         || (localTriangleId >= (SimplexId)cellTriangleList_[cellId].size()))
+         || (localTriangleId >= cellTriangleData_.size(cellId)))
         return -2;
 #endif
-      triangleId = cellTriangleList_[cellId][localTriangleId];
+      triangleId = cellTriangleData_.get(cellId, localTriangleId);
 
       return 0;
     }
@@ -102,17 +108,11 @@ namespace ttk {
       getCellTriangleNumber(const SimplexId &cellId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((cellId < 0) || (cellId >= (SimplexId)cellTriangleList_.size()))
+      if((cellId < 0) || (cellId >= (SimplexId)cellTriangleData_.size()))
         return -1;
 #endif
 
-      return cellTriangleList_[cellId].size();
-    }
-
-    inline const std::vector<std::vector<SimplexId>> *
-      getCellTriangles() override {
-
-      return &cellTriangleList_;
+      return cellTriangleData_.size(cellId);
     }
 
     inline int getCellVertex(const SimplexId &cellId,
@@ -157,53 +157,44 @@ namespace ttk {
                            const int &localLinkId,
                            SimplexId &linkId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeLinkList_.size()))
+      if((edgeId < 0) || (edgeId >= (SimplexId)edgeLinkData_.size()))
         return -1;
       if((localLinkId < 0)
-         || (localLinkId >= (SimplexId)edgeLinkList_[edgeId].size()))
+         || (localLinkId >= edgeLinkData_.size(edgeId)))
         return -2;
 #endif
-      linkId = edgeLinkList_[edgeId][localLinkId];
+      linkId = edgeLinkData_.get(edgeId, localLinkId);
       return 0;
     }
 
     inline SimplexId getEdgeLinkNumber(const SimplexId &edgeId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeLinkList_.size()))
+      if((edgeId < 0) || (edgeId >= (SimplexId)edgeLinkData_.size()))
         return -1;
 #endif
-      return edgeLinkList_[edgeId].size();
-    }
-
-    inline const std::vector<std::vector<SimplexId>> *getEdgeLinks() override {
-
-      return &edgeLinkList_;
+      return edgeLinkData_.size(edgeId);
     }
 
     inline int getEdgeStar(const SimplexId &edgeId,
                            const int &localStarId,
                            SimplexId &starId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeStarList_.size()))
+      if((edgeId < 0) || (edgeId >= (SimplexId)edgeStarData_.size()))
         return -1;
       if((localStarId < 0)
-         || (localStarId >= (SimplexId)edgeStarList_[edgeId].size()))
+         || (localStarId >= edgeStarData_.size(edgeId)))
         return -2;
 #endif
-      starId = edgeStarList_[edgeId][localStarId];
+      starId = edgeStarData_.get(edgeId, localStarId);
       return 0;
     }
 
     inline SimplexId getEdgeStarNumber(const SimplexId &edgeId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeStarList_.size()))
+      if((edgeId < 0) || (edgeId >= (SimplexId)edgeStarData_.size()))
         return -1;
 #endif
-      return edgeStarList_[edgeId].size();
-    }
-
-    inline const std::vector<std::vector<SimplexId>> *getEdgeStars() override {
-      return &edgeStarList_;
+      return edgeStarData_.size(edgeId);
     }
 
     inline int getEdgeTriangle(const SimplexId &edgeId,
@@ -211,14 +202,14 @@ namespace ttk {
                                SimplexId &triangleId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeTriangleList_.size()))
+      if((edgeId < 0) || (edgeId >= (SimplexId)edgeTriangleData_.size()))
         return -1;
       if((localTriangleId < 0)
-         || (localTriangleId >= (SimplexId)edgeTriangleList_[edgeId].size()))
+         || (localTriangleId >= edgeTriangleData_.size(edgeId)))
         return -2;
 #endif
 
-      triangleId = edgeTriangleList_[edgeId][localTriangleId];
+      triangleId = edgeTriangleData_.get(edgeId, localTriangleId);
 
       return 0;
     }
@@ -227,17 +218,11 @@ namespace ttk {
       getEdgeTriangleNumber(const SimplexId &edgeId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((edgeId < 0) || (edgeId >= (SimplexId)edgeTriangleList_.size()))
+      if((edgeId < 0) || (edgeId >= (SimplexId)edgeTriangleData_.size()))
         return -1;
 #endif
 
-      return edgeTriangleList_[edgeId].size();
-    }
-
-    inline const std::vector<std::vector<SimplexId>> *
-      getEdgeTriangles() override {
-
-      return &edgeTriangleList_;
+      return edgeTriangleData_.size(edgeId);
     }
 
     inline int getEdgeVertex(const SimplexId &edgeId,
@@ -265,30 +250,26 @@ namespace ttk {
     }
 
     inline SimplexId getNumberOfTriangles() const override {
-      return triangleList_.size();
+      return triangleVertexData_.size();
     }
 
     inline SimplexId getNumberOfVertices() const override {
       return vertexNumber_;
     }
 
-    inline const std::vector<std::vector<SimplexId>> *getTriangles() override {
-      return &triangleList_;
-    }
-
     inline int getTriangleEdge(const SimplexId &triangleId,
                                const int &localEdgeId,
                                SimplexId &edgeId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
       if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleEdgeList_.size()))
+         || (triangleId >= (SimplexId)triangleEdgeData_.size()))
         return -1;
       if((localEdgeId < 0) || (localEdgeId > 2))
         return -2;
 #endif
 
-      edgeId = triangleEdgeList_[triangleId][localEdgeId];
+      edgeId = triangleEdgeData_.get(triangleId, localEdgeId);
 
       return 0;
     }
@@ -298,17 +279,11 @@ namespace ttk {
 
 #ifndef TTK_ENABLE_KAMIKAZE
       if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleEdgeList_.size()))
+         || (triangleId >= (SimplexId)triangleEdgeData_.size()))
         return -1;
 #endif
 
-      return triangleEdgeList_[triangleId].size();
-    }
-
-    inline const std::vector<std::vector<SimplexId>> *
-      getTriangleEdges() override {
-
-      return &triangleEdgeList_;
+      return triangleEdgeData_.size(triangleId);
     }
 
     inline int getTriangleLink(const SimplexId &triangleId,
@@ -316,13 +291,13 @@ namespace ttk {
                                SimplexId &linkId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
       if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleLinkList_.size()))
+         || (triangleId >= (SimplexId)triangleLinkData_.size()))
         return -1;
       if((localLinkId < 0)
-         || (localLinkId >= (SimplexId)triangleLinkList_[triangleId].size()))
+         || (localLinkId >= triangleLinkData_.size(triangleId)))
         return -2;
 #endif
-      linkId = triangleLinkList_[triangleId][localLinkId];
+      linkId = triangleLinkData_.get(triangleId, localLinkId);
       return 0;
     }
 
@@ -330,15 +305,10 @@ namespace ttk {
       getTriangleLinkNumber(const SimplexId &triangleId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
       if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleLinkList_.size()))
+         || (triangleId >= (SimplexId)triangleLinkData_.size()))
         return -1;
 #endif
-      return triangleLinkList_[triangleId].size();
-    }
-
-    inline const std::vector<std::vector<SimplexId>> *
-      getTriangleLinks() override {
-      return &triangleLinkList_;
+      return triangleLinkData_.size(triangleId);
     }
 
     inline int getTriangleStar(const SimplexId &triangleId,
@@ -346,13 +316,13 @@ namespace ttk {
                                SimplexId &starId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
       if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleStarList_.size()))
+         || (triangleId >= (SimplexId)triangleStarData_.size()))
         return -1;
       if((localStarId < 0)
-         || (localStarId >= (SimplexId)triangleStarList_[triangleId].size()))
+         || (localStarId >= triangleStarData_.size(triangleId)))
         return -2;
 #endif
-      starId = triangleStarList_[triangleId][localStarId];
+      starId = triangleStarData_.get(triangleId, localStarId);
       return 0;
     }
 
@@ -360,28 +330,24 @@ namespace ttk {
       getTriangleStarNumber(const SimplexId &triangleId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
       if((triangleId < 0)
-         || (triangleId >= (SimplexId)triangleStarList_.size()))
+         || (triangleId >= (SimplexId)triangleStarData_.size()))
         return -1;
 #endif
-      return triangleStarList_[triangleId].size();
-    }
-
-    inline const std::vector<std::vector<SimplexId>> *
-      getTriangleStars() override {
-      return &triangleStarList_;
+      return triangleStarData_.size(triangleId);
     }
 
     inline int getTriangleVertex(const SimplexId &triangleId,
                                  const int &localVertexId,
                                  SimplexId &vertexId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((triangleId < 0) || (triangleId >= (SimplexId)triangleList_.size()))
+      if((triangleId < 0)
+         || (triangleId >= (SimplexId)triangleVertexData_.size()))
         return -1;
       if((localVertexId < 0)
-         || (localVertexId >= (SimplexId)triangleList_[triangleId].size()))
+         || (localVertexId >= triangleVertexData_.size(triangleId)))
         return -2;
 #endif
-      vertexId = triangleList_[triangleId][localVertexId];
+      vertexId = triangleVertexData_.get(triangleId, localVertexId);
       return 0;
     }
 
@@ -389,13 +355,13 @@ namespace ttk {
                              const int &localEdgeId,
                              SimplexId &edgeId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexEdgeList_.size()))
+      if((vertexId < 0) || (vertexId >= (SimplexId)vertexEdgeData_.size()))
         return -1;
       if((localEdgeId < 0)
-         || (localEdgeId >= (SimplexId)vertexEdgeList_[vertexId].size()))
+         || (localEdgeId >= vertexEdgeData_.size(vertexId)))
         return -2;
 #endif
-      edgeId = vertexEdgeList_[vertexId][localEdgeId];
+      edgeId = vertexEdgeData_.get(vertexId, localEdgeId);
       return 0;
     }
 
@@ -403,15 +369,10 @@ namespace ttk {
       getVertexEdgeNumber(const SimplexId &vertexId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexEdgeList_.size()))
+      if((vertexId < 0) || (vertexId >= (SimplexId)vertexEdgeData_.size()))
         return -1;
 #endif
-      return vertexEdgeList_[vertexId].size();
-    }
-
-    inline const std::vector<std::vector<SimplexId>> *
-      getVertexEdges() override {
-      return &vertexEdgeList_;
+      return vertexEdgeData_.size(vertexId);
     }
 
     inline int getVertexLink(const SimplexId &vertexId,
@@ -419,13 +380,13 @@ namespace ttk {
                              SimplexId &linkId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexLinkList_.size()))
+      if((vertexId < 0) || (vertexId >= (SimplexId)vertexLinkData_.size()))
         return -1;
       if((localLinkId < 0)
-         || (localLinkId >= (SimplexId)vertexLinkList_[vertexId].size()))
+         || (localLinkId >= vertexLinkData_.size(vertexId)))
         return -2;
 #endif
-      linkId = vertexLinkList_[vertexId][localLinkId];
+      linkId = vertexLinkData_.get(vertexId, localLinkId);
 
       return 0;
     }
@@ -433,29 +394,24 @@ namespace ttk {
     inline SimplexId
       getVertexLinkNumber(const SimplexId &vertexId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexLinkList_.size()))
+      if((vertexId < 0) || (vertexId >= (SimplexId)vertexLinkData_.size()))
         return -1;
 #endif
-      return vertexLinkList_[vertexId].size();
-    }
-
-    inline const std::vector<std::vector<SimplexId>> *
-      getVertexLinks() override {
-      return &vertexLinkList_;
+      return vertexLinkData_.size(vertexId);
     }
 
     inline int getVertexNeighbor(const SimplexId &vertexId,
                                  const int &localNeighborId,
                                  SimplexId &neighborId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexNeighborList_.size()))
+      if((vertexId < 0) || (vertexId >= (SimplexId)vertexNeighborData_.size()))
         return -1;
       if((localNeighborId < 0)
          || (localNeighborId
-             >= (SimplexId)vertexNeighborList_[vertexId].size()))
+             >= vertexNeighborData_.size(vertexId)))
         return -2;
 #endif
-      neighborId = vertexNeighborList_[vertexId][localNeighborId];
+      neighborId = vertexNeighborData_.get(vertexId, localNeighborId);
       return 0;
     }
 
@@ -465,12 +421,7 @@ namespace ttk {
       if((vertexId < 0) || (vertexId >= vertexNumber_))
         return -1;
 #endif
-      return vertexNeighborList_[vertexId].size();
-    }
-
-    inline const std::vector<std::vector<SimplexId>> *
-      getVertexNeighbors() override {
-      return &vertexNeighborList_;
+      return vertexNeighborData_.size(vertexId);
     }
 
     inline int getVertexPoint(const SimplexId &vertexId,
@@ -500,28 +451,23 @@ namespace ttk {
                              const int &localStarId,
                              SimplexId &starId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexStarList_.size()))
+      if((vertexId < 0) || (vertexId >= (SimplexId)vertexStarData_.size()))
         return -1;
       if((localStarId < 0)
-         || (localStarId >= (SimplexId)vertexStarList_[vertexId].size()))
+         || (localStarId >= vertexStarData_.size(vertexId)))
         return -2;
 #endif
-      starId = vertexStarList_[vertexId][localStarId];
+      starId = vertexStarData_.get(vertexId, localStarId);
       return 0;
     }
 
     inline SimplexId
       getVertexStarNumber(const SimplexId &vertexId) const override {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexStarList_.size()))
+      if((vertexId < 0) || (vertexId >= (SimplexId)vertexStarData_.size()))
         return -1;
 #endif
-      return vertexStarList_[vertexId].size();
-    }
-
-    inline const std::vector<std::vector<SimplexId>> *
-      getVertexStars() override {
-      return &vertexStarList_;
+      return vertexStarData_.size(vertexId);
     }
 
     inline int getVertexTriangle(const SimplexId &vertexId,
@@ -529,14 +475,14 @@ namespace ttk {
                                  SimplexId &triangleId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexTriangleList_.size()))
+      if((vertexId < 0) || (vertexId >= (SimplexId)vertexTriangleData_.size()))
         return -1;
       if((localTriangleId < 0)
          || (localTriangleId
-             >= (SimplexId)vertexTriangleList_[vertexId].size()))
+             >= vertexTriangleData_.size(vertexId)))
         return -2;
 #endif
-      triangleId = vertexTriangleList_[vertexId][localTriangleId];
+      triangleId = vertexTriangleData_.get(vertexId, localTriangleId);
       return 0;
     }
 
@@ -544,16 +490,10 @@ namespace ttk {
       getVertexTriangleNumber(const SimplexId &vertexId) const override {
 
 #ifndef TTK_ENABLE_KAMIKAZE
-      if((vertexId < 0) || (vertexId >= (SimplexId)vertexTriangleList_.size()))
+      if((vertexId < 0) || (vertexId >= (SimplexId)vertexTriangleData_.size()))
         return -1;
 #endif
-      return vertexTriangleList_[vertexId].size();
-    }
-
-    inline const std::vector<std::vector<SimplexId>> *
-      getVertexTriangles() override {
-
-      return &vertexTriangleList_;
+      return vertexTriangleData_.size(vertexId);
     }
 
     inline bool hasPreprocessedBoundaryEdges() const override {
@@ -573,15 +513,15 @@ namespace ttk {
     }
 
     inline bool hasPreprocessedCellEdges() const override {
-      return (cellEdgeList_.size() != 0);
+      return (cellEdgeData_.size() != 0);
     }
 
     inline bool hasPreprocessedCellNeighbors() const override {
-      return (cellNeighborList_.size() != 0);
+      return (cellNeighborData_.size() != 0);
     }
 
     inline bool hasPreprocessedCellTriangles() const override {
-      return (cellTriangleList_.size() != 0);
+      return (cellTriangleData_.size() != 0);
     }
 
     inline bool hasPreprocessedEdges() const override {
@@ -589,51 +529,51 @@ namespace ttk {
     }
 
     inline bool hasPreprocessedEdgeLinks() const override {
-      return (edgeLinkList_.size() != 0);
+      return (edgeLinkData_.size() != 0);
     }
 
     inline bool hasPreprocessedEdgeStars() const override {
-      return (edgeStarList_.size() != 0);
+      return (edgeStarData_.size() != 0);
     }
 
     inline bool hasPreprocessedEdgeTriangles() const override {
-      return (edgeTriangleList_.size() != 0);
+      return (edgeTriangleData_.size() != 0);
     }
 
     inline bool hasPreprocessedTriangles() const override {
-      return (triangleList_.size() != 0);
+      return (triangleVertexData_.size() != 0);
     }
 
     inline bool hasPreprocessedTriangleEdges() const override {
-      return (triangleEdgeList_.size() != 0);
+      return (triangleEdgeData_.size() != 0);
     }
 
     inline bool hasPreprocessedTriangleLinks() const override {
-      return (triangleLinkList_.size() != 0);
+      return (triangleLinkData_.size() != 0);
     }
 
     inline bool hasPreprocessedTriangleStars() const override {
-      return (triangleStarList_.size() != 0);
+      return (triangleStarData_.size() != 0);
     }
 
     inline bool hasPreprocessedVertexEdges() const override {
-      return (vertexEdgeList_.size() != 0);
+      return (vertexEdgeData_.size() != 0);
     }
 
     inline bool hasPreprocessedVertexLinks() const override {
-      return (vertexLinkList_.size() != 0);
+      return (vertexLinkData_.size() != 0);
     }
 
     inline bool hasPreprocessedVertexNeighbors() const override {
-      return (vertexNeighborList_.size() != 0);
+      return (vertexNeighborData_.size() != 0);
     }
 
     inline bool hasPreprocessedVertexStars() const override {
-      return (vertexStarList_.size() != 0);
+      return (vertexStarData_.size() != 0);
     }
 
     inline bool hasPreprocessedVertexTriangles() const override {
-      return (vertexTriangleList_.size() != 0);
+      return (vertexTriangleData_.size() != 0);
     }
 
     inline bool isEdgeOnBoundary(const SimplexId &edgeId) const override {
@@ -678,8 +618,8 @@ namespace ttk {
 
       if(getDimensionality() == 2) {
         preprocessEdgeStars();
-        for(SimplexId i = 0; i < (SimplexId)edgeStarList_.size(); i++) {
-          if(edgeStarList_[i].size() == 1) {
+        for(SimplexId i = 0; i < (SimplexId)edgeStarData_.size(); i++) {
+          if(edgeStarData_.size(i) == 1) {
             boundaryEdges_[i] = true;
           }
         }
@@ -687,10 +627,10 @@ namespace ttk {
         preprocessTriangleStars();
         preprocessTriangleEdges();
 
-        for(SimplexId i = 0; i < (SimplexId)triangleStarList_.size(); i++) {
-          if(triangleStarList_[i].size() == 1) {
+        for(SimplexId i = 0; i < (SimplexId)triangleStarData_.size(); i++) {
+          if(triangleStarData_.size(i) == 1) {
             for(int j = 0; j < 3; j++) {
-              boundaryEdges_[triangleEdgeList_[i][j]] = true;
+              boundaryEdges_[triangleEdgeData_.get(i, j)] = true;
             }
           }
         }
@@ -712,18 +652,18 @@ namespace ttk {
         return 0;
 
       if((!boundaryTriangles_.empty())
-         && (boundaryTriangles_.size() == triangleList_.size())) {
+         && (boundaryTriangles_.size() == triangleVertexData_.size())) {
         return 0;
       }
 
       preprocessTriangles();
-      boundaryTriangles_.resize(triangleList_.size(), false);
+      boundaryTriangles_.resize(triangleVertexData_.size(), false);
 
       if(getDimensionality() == 3) {
         preprocessTriangleStars();
 
-        for(SimplexId i = 0; i < (SimplexId)triangleStarList_.size(); i++) {
-          if(triangleStarList_[i].size() == 1) {
+        for(SimplexId i = 0; i < (SimplexId)triangleStarData_.size(); i++) {
+          if(triangleStarData_.size(i) == 1) {
             boundaryTriangles_[i] = true;
           }
         }
@@ -752,8 +692,8 @@ namespace ttk {
       // look for singletons
       if(getDimensionality() == 1) {
         preprocessVertexStars();
-        for(SimplexId i = 0; i < (SimplexId)vertexStarList_.size(); i++) {
-          if(vertexStarList_[i].size() == 1) {
+        for(SimplexId i = 0; i < (SimplexId)vertexStarData_.size(); i++) {
+          if(vertexStarData_.size(i) == 1) {
             boundaryVertices_[i] = true;
           }
         }
@@ -761,8 +701,8 @@ namespace ttk {
         preprocessEdges();
         preprocessEdgeStars();
 
-        for(SimplexId i = 0; i < (SimplexId)edgeStarList_.size(); i++) {
-          if(edgeStarList_[i].size() == 1) {
+        for(SimplexId i = 0; i < (SimplexId)edgeStarData_.size(); i++) {
+          if(edgeStarData_.size(i) == 1) {
             boundaryVertices_[edgeList_[i].first] = true;
             boundaryVertices_[edgeList_[i].second] = true;
           }
@@ -771,11 +711,11 @@ namespace ttk {
         preprocessTriangles();
         preprocessTriangleStars();
 
-        for(SimplexId i = 0; i < (SimplexId)triangleStarList_.size(); i++) {
-          if(triangleStarList_[i].size() == 1) {
-            boundaryVertices_[triangleList_[i][0]] = true;
-            boundaryVertices_[triangleList_[i][1]] = true;
-            boundaryVertices_[triangleList_[i][2]] = true;
+        for(SimplexId i = 0; i < (SimplexId)triangleStarData_.size(); i++) {
+          if(triangleStarData_.size(i) == 1) {
+            boundaryVertices_[triangleVertexData_.get(i, 0)] = true;
+            boundaryVertices_[triangleVertexData_.get(i, 1)] = true;
+            boundaryVertices_[triangleVertexData_.get(i, 2)] = true;
           }
         }
       } else {
@@ -792,14 +732,18 @@ namespace ttk {
 
     inline int preprocessCellEdges() override {
 
-      if(!cellEdgeList_.size()) {
+      if(!cellEdgeData_.size()) {
+
+        if(!readCachedTable("cellEdges", cellEdgeData_))
+          return 0;
 
         ThreeSkeleton threeSkeleton;
         threeSkeleton.setWrapper(this);
 
         threeSkeleton.buildCellEdges(vertexNumber_, cellNumber_, cellArray_,
-                                     cellEdgeList_, &edgeList_,
-                                     &vertexEdgeList_);
+                                     cellEdgeData_, &edgeList_,
+                                     &vertexEdgeData_);
+        writeCachedTables();
       }
 
       return 0;
@@ -807,14 +751,19 @@ namespace ttk {
 
     inline int preprocessCellNeighbors() override {
 
-      if(!cellNeighborList_.size()) {
+      if(!cellNeighborData_.size()) {
+
+        if(!readCachedTable("cellNeighbors", cellNeighborData_))
+          return 0;
+
         ThreeSkeleton threeSkeleton;
         threeSkeleton.setWrapper(this);
 
         // choice here (for the more likely)
         threeSkeleton.buildCellNeighborsFromVertices(
-          vertexNumber_, cellNumber_, cellArray_, cellNeighborList_,
-          &vertexStarList_);
+          vertexNumber_, cellNumber_, cellArray_, cellNeighborData_,
+          &vertexStarData_);
+        writeCachedTables();
       }
 
       return 0;
@@ -822,38 +771,44 @@ namespace ttk {
 
     inline int preprocessCellTriangles() override {
 
-      if(!cellTriangleList_.size()) {
+      if(!cellTriangleData_.size()) {
+
+        if(!readCachedTable("cellTriangles", cellTriangleData_))
+          return 0;
 
         TwoSkeleton twoSkeleton;
         twoSkeleton.setWrapper(this);
 
-        if(triangleList_.size()) {
+        int ret = 0;
+        if(triangleVertexData_.size()) {
           // we already computed this guy, let's just get the cell triangles
-          if(triangleStarList_.size()) {
-            return twoSkeleton.buildTriangleList(vertexNumber_, cellNumber_,
-                                                 cellArray_, NULL, NULL,
-                                                 &cellTriangleList_);
+          if(triangleStarData_.size()) {
+            ret = twoSkeleton.buildTriangleList(vertexNumber_, cellNumber_,
+                                                cellArray_, NULL, NULL,
+                                                &cellTriangleData_);
           } else {
             // let's compute the triangle star while we're at it...
             // it's just a tiny overhead.
-            return twoSkeleton.buildTriangleList(
-              vertexNumber_, cellNumber_, cellArray_, NULL, &triangleStarList_,
-              &cellTriangleList_);
+            ret = twoSkeleton.buildTriangleList(
+              vertexNumber_, cellNumber_, cellArray_, NULL, &triangleStarData_,
+              &cellTriangleData_);
           }
         } else {
           // we have not computed this guy, let's do it while we're at it
-          if(triangleStarList_.size()) {
-            return twoSkeleton.buildTriangleList(vertexNumber_, cellNumber_,
-                                                 cellArray_, &triangleList_,
-                                                 NULL, &cellTriangleList_);
+          if(triangleStarData_.size()) {
+            ret = twoSkeleton.buildTriangleList(
+              vertexNumber_, cellNumber_, cellArray_, &triangleVertexData_,
+              NULL, &cellTriangleData_);
           } else {
             // let's compute the triangle star while we're at it...
             // it's just a tiny overhead.
-            return twoSkeleton.buildTriangleList(
-              vertexNumber_, cellNumber_, cellArray_, &triangleList_,
-              &triangleStarList_, &cellTriangleList_);
+            ret = twoSkeleton.buildTriangleList(
+              vertexNumber_, cellNumber_, cellArray_, &triangleVertexData_,
+              &triangleStarData_, &cellTriangleData_);
           }
         }
+        writeCachedTables();
+        return ret;
       }
 
       return 0;
@@ -862,10 +817,16 @@ namespace ttk {
     inline int preprocessEdges() override {
 
       if(!edgeList_.size()) {
+
+        if(!readCachedTable("edges", edgeList_))
+          return 0;
+
         OneSkeleton oneSkeleton;
         oneSkeleton.setWrapper(this);
-        return oneSkeleton.buildEdgeList(
+        int ret = oneSkeleton.buildEdgeList(
           vertexNumber_, cellNumber_, cellArray_, edgeList_);
+        writeCachedTables();
+        return ret;
       }
 
       return 0;
@@ -873,7 +834,10 @@ namespace ttk {
 
     inline int preprocessEdgeLinks() override {
 
-      if(!edgeLinkList_.size()) {
+      if(!edgeLinkData_.size()) {
+
+        if(!readCachedTable("edgeLinks", edgeLinkData_))
+          return 0;
 
         if(getDimensionality() == 2) {
           preprocessEdges();
@@ -881,8 +845,10 @@ namespace ttk {
 
           OneSkeleton oneSkeleton;
           oneSkeleton.setWrapper(this);
-          return oneSkeleton.buildEdgeLinks(
-            edgeList_, edgeStarList_, cellArray_, edgeLinkList_);
+          int ret = oneSkeleton.buildEdgeLinks(
+            edgeList_, edgeStarData_, cellArray_, edgeLinkData_);
+          writeCachedTables();
+          return ret;
         } else if(getDimensionality() == 3) {
           preprocessEdges();
           preprocessEdgeStars();
@@ -890,8 +856,10 @@ namespace ttk {
 
           OneSkeleton oneSkeleton;
           oneSkeleton.setWrapper(this);
-          return oneSkeleton.buildEdgeLinks(
-            edgeList_, edgeStarList_, cellEdgeList_, edgeLinkList_);
+          int ret = oneSkeleton.buildEdgeLinks(
+            edgeList_, edgeStarData_, cellEdgeData_, edgeLinkData_);
+          writeCachedTables();
+          return ret;
         } else {
           // unsupported dimension
           std::stringstream msg;
@@ -907,31 +875,45 @@ namespace ttk {
 
     inline int preprocessEdgeStars() override {
 
-      if(!edgeStarList_.size()) {
+      if(!edgeStarData_.size()) {
+
+        if(!readCachedTable("edgeStars", edgeStarData_))
+          return 0;
+
+        // the edge stars refer to the edge identifiers
+        preprocessEdges();
+
         OneSkeleton oneSkeleton;
         oneSkeleton.setWrapper(this);
-        return oneSkeleton.buildEdgeStars(vertexNumber_, cellNumber_,
-                                          cellArray_, edgeStarList_, &edgeList_,
-                                          &vertexStarList_);
+        int ret = oneSkeleton.buildEdgeStars(vertexNumber_, cellNumber_,
+                                             cellArray_, edgeStarData_,
+                                             &edgeList_, &vertexStarData_);
+        writeCachedTables();
+        return ret;
       }
       return 0;
     }
 
     inline int preprocessEdgeTriangles() override {
 
-      if(!edgeTriangleList_.size()) {
+      if(!edgeTriangleData_.size()) {
 
         // WARNING
         // here vertexStarList and triangleStarList will be computed (for
         // free) although they are not requireed to get the edgeTriangleList.
         // if memory usage is an issue, please change these pointers by NULL.
 
+        if(!readCachedTable("edgeTriangles", edgeTriangleData_))
+          return 0;
+
         TwoSkeleton twoSkeleton;
         twoSkeleton.setWrapper(this);
-        return twoSkeleton.buildEdgeTriangles(
-          vertexNumber_, cellNumber_, cellArray_, edgeTriangleList_,
-          &vertexStarList_, &edgeList_, &edgeStarList_, &triangleList_,
-          &triangleStarList_, &cellTriangleList_);
+        int ret = twoSkeleton.buildEdgeTriangles(
+          vertexNumber_, cellNumber_, cellArray_, edgeTriangleData_,
+          &vertexStarData_, &edgeList_, &edgeStarData_, &triangleVertexData_,
+          &triangleStarData_, &cellTriangleData_);
+        writeCachedTables();
+        return ret;
       }
 
       return 0;
@@ -939,14 +921,18 @@ namespace ttk {
 
     inline int preprocessTriangles() override {
 
-      if(!triangleList_.size()) {
+      if(!triangleVertexData_.size()) {
+
+        if(!readCachedTable("triangles", triangleVertexData_))
+          return 0;
 
         TwoSkeleton twoSkeleton;
         twoSkeleton.setWrapper(this);
 
         twoSkeleton.buildTriangleList(vertexNumber_, cellNumber_, cellArray_,
-                                      &triangleList_, &triangleStarList_,
-                                      &cellTriangleList_);
+                                      &triangleVertexData_, &triangleStarData_,
+                                      &cellTriangleData_);
+        writeCachedTables();
       }
 
       return 0;
@@ -954,20 +940,25 @@ namespace ttk {
 
     inline int preprocessTriangleEdges() override {
 
-      if(!triangleEdgeList_.size()) {
+      if(!triangleEdgeData_.size()) {
 
         // WARNING
         // here triangleStarList and cellTriangleList will be computed (for
         // free) although they are not requireed to get the edgeTriangleList.
         // if memory usage is an issue, please change these pointers by NULL.
 
+        if(!readCachedTable("triangleEdges", triangleEdgeData_))
+          return 0;
+
         TwoSkeleton twoSkeleton;
         twoSkeleton.setWrapper(this);
 
-        return twoSkeleton.buildTriangleEdgeList(
-          vertexNumber_, cellNumber_, cellArray_, triangleEdgeList_,
-          &vertexEdgeList_, &edgeList_, &triangleList_, &triangleStarList_,
-          &cellTriangleList_);
+        int ret = twoSkeleton.buildTriangleEdgeList(
+          vertexNumber_, cellNumber_, cellArray_, triangleEdgeData_,
+          &vertexEdgeData_, &edgeList_, &triangleVertexData_,
+          &triangleStarData_, &cellTriangleData_);
+        writeCachedTables();
+        return ret;
       }
 
       return 0;
@@ -975,14 +966,21 @@ namespace ttk {
 
     inline int preprocessTriangleLinks() override {
 
-      if(!triangleLinkList_.size()) {
+      if(!triangleLinkData_.size()) {
 
+        if(!readCachedTable("triangleLinks", triangleLinkData_))
+          return 0;
+
+        preprocessTriangles();
         preprocessTriangleStars();
 
         TwoSkeleton twoSkeleton;
         twoSkeleton.setWrapper(this);
-        return twoSkeleton.buildTriangleLinks(
-          triangleList_, triangleStarList_, cellArray_, triangleLinkList_);
+        int ret = twoSkeleton.buildTriangleLinks(
+          triangleVertexData_, triangleStarData_, cellArray_,
+          triangleLinkData_);
+        writeCachedTables();
+        return ret;
       }
 
       return 0;
@@ -990,13 +988,19 @@ namespace ttk {
 
     inline int preprocessTriangleStars() override {
 
-      if(!triangleStarList_.size()) {
+      if(!triangleStarData_.size()) {
+
+        if(!readCachedTable("triangleStars", triangleStarData_))
+          return 0;
 
         TwoSkeleton twoSkeleton;
         twoSkeleton.setWrapper(this);
-        return twoSkeleton.buildTriangleList(vertexNumber_, cellNumber_,
-                                             cellArray_, &triangleList_,
-                                             &triangleStarList_);
+        int ret = twoSkeleton.buildTriangleList(
+          vertexNumber_, cellNumber_, cellArray_,
+          triangleVertexData_.size() ? NULL : &triangleVertexData_,
+          &triangleStarData_);
+        writeCachedTables();
+        return ret;
       }
 
       return 0;
@@ -1004,43 +1008,54 @@ namespace ttk {
 
     inline int preprocessVertexEdges() override {
 
-      if((SimplexId)vertexEdgeList_.size() != vertexNumber_) {
+      if((SimplexId)vertexEdgeData_.size() != vertexNumber_) {
+
+        if(!readCachedTable("vertexEdges", vertexEdgeData_))
+          return 0;
+
         ZeroSkeleton zeroSkeleton;
 
-        if(!edgeList_.size()) {
-          OneSkeleton oneSkeleton;
-          oneSkeleton.setWrapper(this);
-          oneSkeleton.buildEdgeList(
-            vertexNumber_, cellNumber_, cellArray_, edgeList_);
-        }
+        preprocessEdges();
 
         zeroSkeleton.setWrapper(this);
-        return zeroSkeleton.buildVertexEdges(
-          vertexNumber_, edgeList_, vertexEdgeList_);
+        int ret = zeroSkeleton.buildVertexEdges(
+          vertexNumber_, edgeList_, vertexEdgeData_);
+        writeCachedTables();
+        return ret;
       }
       return 0;
     }
 
     inline int preprocessVertexLinks() override {
 
-      if((SimplexId)vertexLinkList_.size() != vertexNumber_) {
+      if((SimplexId)vertexLinkData_.size() != vertexNumber_) {
+
+        if(!readCachedTable("vertexLinks", vertexLinkData_))
+          return 0;
 
         if(getDimensionality() == 2) {
           preprocessVertexStars();
+          preprocessEdges();
           preprocessCellEdges();
 
           ZeroSkeleton zeroSkeleton;
           zeroSkeleton.setWrapper(this);
-          return zeroSkeleton.buildVertexLinks(
-            vertexStarList_, cellEdgeList_, edgeList_, vertexLinkList_);
+          int ret = zeroSkeleton.buildVertexLinks(
+            vertexStarData_, cellEdgeData_, edgeList_, vertexLinkData_);
+          writeCachedTables();
+          return ret;
         } else if(getDimensionality() == 3) {
           preprocessVertexStars();
+          preprocessTriangles();
           preprocessCellTriangles();
 
           ZeroSkeleton zeroSkeleton;
           zeroSkeleton.setWrapper(this);
-          return zeroSkeleton.buildVertexLinks(
-            vertexStarList_, cellTriangleList_, triangleList_, vertexLinkList_);
+          int ret = zeroSkeleton.buildVertexLinks(
+            vertexStarData_, cellTriangleData_, triangleVertexData_,
+            vertexLinkData_);
+          writeCachedTables();
+          return ret;
         } else {
           // unsupported dimension
           std::stringstream msg;
@@ -1055,31 +1070,46 @@ namespace ttk {
 
     inline int preprocessVertexNeighbors() override {
 
-      if((SimplexId)vertexNeighborList_.size() != vertexNumber_) {
+      if((SimplexId)vertexNeighborData_.size() != vertexNumber_) {
+
+        if(!readCachedTable("vertexNeighbors", vertexNeighborData_))
+          return 0;
+
         ZeroSkeleton zeroSkeleton;
         zeroSkeleton.setWrapper(this);
-        return zeroSkeleton.buildVertexNeighbors(
-          vertexNumber_, cellNumber_, cellArray_, vertexNeighborList_,
+        int ret = zeroSkeleton.buildVertexNeighbors(
+          vertexNumber_, cellNumber_, cellArray_, vertexNeighborData_,
           &edgeList_);
+        writeCachedTables();
+        return ret;
       }
       return 0;
     }
 
     inline int preprocessVertexStars() override {
 
-      if((SimplexId)vertexStarList_.size() != vertexNumber_) {
+      if((SimplexId)vertexStarData_.size() != vertexNumber_) {
+
+        if(!readCachedTable("vertexStars", vertexStarData_))
+          return 0;
+
         ZeroSkeleton zeroSkeleton;
         zeroSkeleton.setWrapper(this);
 
-        return zeroSkeleton.buildVertexStars(
-          vertexNumber_, cellNumber_, cellArray_, vertexStarList_);
+        int ret = zeroSkeleton.buildVertexStars(
+          vertexNumber_, cellNumber_, cellArray_, vertexStarData_);
+        writeCachedTables();
+        return ret;
       }
       return 0;
     }
 
     inline int preprocessVertexTriangles() override {
 
-      if((SimplexId)vertexTriangleList_.size() != vertexNumber_) {
+      if((SimplexId)vertexTriangleData_.size() != vertexNumber_) {
+
+        if(!readCachedTable("vertexTriangles", vertexTriangleData_))
+          return 0;
 
         preprocessTriangles();
 
@@ -1087,12 +1117,29 @@ namespace ttk {
         twoSkeleton.setWrapper(this);
 
         twoSkeleton.buildVertexTriangles(
-          vertexNumber_, triangleList_, vertexTriangleList_);
+          vertexNumber_, triangleVertexData_, vertexTriangleData_);
+        writeCachedTables();
       }
 
       return 0;
     }
 
+    /// Enable the on-disk cache of the preprocessed tables.
+    ///
+    /// The tables are stored in \p cacheDirectory (which must exist), in
+    /// files named after a hash of the input cells. An empty string disables
+    /// the cache (default, unless the environment variable
+    /// TTK_TRIANGULATION_CACHE_DIR is set).
+    ///
+    /// \warning The cache is only keyed by the input cells: modifying a
+    /// cached mesh in place without changing its connectivity is fine, but
+    /// the files of a directory should not be edited by hand.
+    inline int setCacheDirectory(const std::string &cacheDirectory) {
+      cacheDirectory_ = cacheDirectory;
+      cachedTables_.clear();
+      return 0;
+    }
+
     inline int setInputCells(const SimplexId &cellNumber,
                              const LongSimplexId *cellArray) {
 
@@ -1101,6 +1148,8 @@ namespace ttk {
 
       cellNumber_ = cellNumber;
       cellArray_ = cellArray;
+      hasCacheKey_ = false;
+      cachedTables_.clear();
 
       return 0;
     }
@@ -1121,10 +1170,45 @@ namespace ttk {
   protected:
     int clear();
 
+    size_t flatFootprint(const FlatJaggedArray &table,
+                         const std::string &tableName,
+                         std::stringstream &msg) const;
+
+    /// Name of the cache file of a given table (empty if the cache is
+    /// disabled).
+    std::string getCacheFileName(const std::string &tableName);
+
+    /// Load a preprocessed table from the cache directory. Files whose
+    /// header, size or offsets are not consistent with the current mesh
+    /// are ignored.
+    /// \return Returns 0 upon success, negative values otherwise (cache
+    /// disabled, table not cached yet or invalid file).
+    int readCachedTable(const std::string &tableName, FlatJaggedArray &table);
+    int readCachedTable(const std::string &tableName,
+                        std::vector<std::pair<SimplexId, SimplexId>> &table);
+
+    /// Write to the cache directory all the preprocessed tables which are
+    /// not cached yet.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int writeCachedTables();
+
     bool doublePrecision_;
     SimplexId cellNumber_, vertexNumber_;
     const void *pointSet_;
     const LongSimplexId *cellArray_;
+
+    // on-disk cache of the preprocessed tables
+    std::string cacheDirectory_;
+    bool hasCacheKey_;
+    unsigned long long cacheKey_;
+    std::set<std::string> cachedTables_;
+
+    // adjacency relations, in compressed (offsets + data) form
+    FlatJaggedArray cellEdgeData_, cellNeighborData_, cellTriangleData_,
+      edgeLinkData_, edgeStarData_, edgeTriangleData_, triangleVertexData_,
+      triangleEdgeData_, triangleLinkData_, triangleStarData_,
+      vertexEdgeData_, vertexLinkData_, vertexNeighborData_, vertexStarData_,
+      vertexTriangleData_;
   };
 } // namespace ttk
 
@@ -28,6 +28,9 @@ namespace ttk {
     struct Params {
       TreeType treeType;
       bool segm = true;
+      // per-vertex segmentation read from vert2tree, without the per-arc
+      // lists of regular vertices
+      bool directSegm = false;
       bool normalize = true;
       bool advStats = true;
       int samplingLvl = 0;
@@ -47,7 +50,10 @@ namespace ttk {
       void *values;
       void *offsets;
 
-      std::shared_ptr<std::vector<SimplexId>> sortedVertices, mirrorVertices;
+      // aliases on the arrays of the vertex order cached by the
+      // triangulation (see Triangulation::getVertexOrder()), not copied
+      std::shared_ptr<const std::vector<SimplexId>> sortedVertices,
+        mirrorVertices;
 
       // Need vertices to be sorted : use mirrorVertices.
 
@@ -46,8 +46,9 @@ namespace ttk {
 
       // Initialize structures then build tree
       // Need triangulation, scalars and all params set before call
+      // Returns 0 upon success, negative values otherwise.
       template <typename scalarType, typename idType>
-      void build(void);
+      int build(void);
     };
 
 #include "FTMTree_Template.h"
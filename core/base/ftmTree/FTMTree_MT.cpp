@@ -1008,6 +1008,117 @@ void FTMTree_MT::normalizeIds(void) {
   printTime(normTime, "[FTM] normalize ids", -1, 4);
 }
 
+CriticalType FTMTree_MT::getNodeType(const idNode nodeId) {
+  // the degrees are swapped unless a join tree or a contour tree is
+  // requested
+  const Node *node = getNode(nodeId);
+  idSuperArc upDegree = node->getNumberOfUpSuperArcs();
+  idSuperArc downDegree = node->getNumberOfDownSuperArcs();
+  if(params_->treeType != TreeType::Join
+     && params_->treeType != TreeType::Contour) {
+    swap(upDegree, downDegree);
+  }
+
+  if(upDegree + downDegree > 1) {
+    if(upDegree == 2 && downDegree == 1)
+      return CriticalType::Saddle2;
+    else if(upDegree == 1 && downDegree == 2)
+      return CriticalType::Saddle1;
+    else if(upDegree == 1 && downDegree == 1)
+      return CriticalType::Regular;
+    else
+      return CriticalType::Degenerate;
+  }
+
+  return upDegree ? CriticalType::Local_minimum : CriticalType::Local_maximum;
+}
+
+ArcType FTMTree_MT::getArcType(const idSuperArc arcId) {
+  const SuperArc *arc = getSuperArc(arcId);
+  const CriticalType upNodeType = getNodeType(arc->getUpNodeId());
+  const CriticalType downNodeType = getNodeType(arc->getDownNodeId());
+
+  if(upNodeType == CriticalType::Local_minimum
+     || downNodeType == CriticalType::Local_minimum) {
+    return ArcType::Min_arc;
+  } else if(upNodeType == CriticalType::Local_maximum
+            || downNodeType == CriticalType::Local_maximum) {
+    return ArcType::Max_arc;
+  } else if(upNodeType == CriticalType::Saddle1
+            && downNodeType == CriticalType::Saddle1) {
+    return ArcType::Saddle1_arc;
+  } else if(upNodeType == CriticalType::Saddle2
+            && downNodeType == CriticalType::Saddle2) {
+    return ArcType::Saddle2_arc;
+  }
+  return ArcType::Saddle1_saddle2_arc;
+}
+
+void FTMTree_MT::getVertexSegmentation(SimplexId *arcIds,
+                                       char *regionTypes,
+                                       vector<SimplexId> *regionSizes) {
+  DebugTimer segmTime;
+
+  // per-arc output values, indexed by arc id
+  const idSuperArc nbArcs = getNumberOfSuperArcs();
+  vector<SimplexId> segmIds(nbArcs);
+  vector<char> arcTypes(nbArcs);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(idSuperArc a = 0; a < nbArcs; ++a) {
+    segmIds[a] = params_->normalize ? getSuperArc(a)->getNormalizedId() : a;
+    arcTypes[a] = static_cast<char>(getArcType(a));
+  }
+
+  if(regionSizes) {
+    regionSizes->assign(nbArcs, 0);
+  }
+
+  const SimplexId nbVert = scalars_->size;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId v = 0; v < nbVert; ++v) {
+    idSuperArc arcId = nullSuperArc;
+    if(isCorrespondingArc(v)) {
+      arcId = getCorrespondingSuperArcId(v);
+      if(regionSizes) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic update
+#endif
+        ++(*regionSizes)[segmIds[arcId]];
+      }
+    } else if(isCorrespondingNode(v)) {
+      // same choice as filling the arcs one after the other: the last arc
+      // reaching this node wins
+      const Node *node = getNode(getCorrespondingNodeId(v));
+      for(idSuperArc i = 0; i < node->getNumberOfUpSuperArcs(); ++i) {
+        const idSuperArc a = node->getUpSuperArcId(i);
+        if(arcId == nullSuperArc || a > arcId)
+          arcId = a;
+      }
+      for(idSuperArc i = 0; i < node->getNumberOfDownSuperArcs(); ++i) {
+        const idSuperArc a = node->getDownSuperArcId(i);
+        if(arcId == nullSuperArc || a > arcId)
+          arcId = a;
+      }
+    }
+
+    if(arcId == nullSuperArc) {
+      // isolated vertex
+      arcIds[v] = -1;
+      regionTypes[v] = -1;
+    } else {
+      arcIds[v] = segmIds[arcId];
+      regionTypes[v] = arcTypes[arcId];
+    }
+  }
+
+  printTime(segmTime, "[FTM] direct segmentation", nbVert, 4);
+}
+
 idSuperArc FTMTree_MT::openSuperArc(idNode downNodeId) {
 #ifndef TTK_ENABLE_KAMIKAZE
   if(downNodeId < 0 || (size_t)downNodeId >= getNumberOfNodes()) {
@@ -170,10 +170,11 @@ namespace ttk {
         return comp_.vertLower(a, b);
       }
 
-      /// \brief if sortedVertices_ is null, define and fill it
-      /// Also fill the mirror vector
+      /// \brief share the sorted vertices and the mirror vector of the
+      /// vertex order cached by the triangulation
+      /// \return Returns 0 upon success, negative values otherwise.
       template <typename scalarType, typename idType>
-      void sortInput(void);
+      int sortInput(void);
 
       /// \brief clear local data for new computation
       void makeAlloc(void) {
@@ -282,6 +283,27 @@ namespace ttk {
 
       void normalizeIds();
 
+      /// \brief Critical type of the node nodeId, from its degree in this
+      /// tree. Up and down degrees are swapped unless the requested tree
+      /// type is Join or Contour.
+      CriticalType getNodeType(const idNode nodeId);
+
+      /// \brief Region type of the arc arcId, from the critical type of its
+      /// extremities.
+      ArcType getArcType(const idSuperArc arcId);
+
+      /// \brief Direct segmentation: write in the per-vertex arrays arcIds
+      /// and regionTypes the arc (normalized id if computed) of each vertex
+      /// and its ArcType, read from vert2tree. Does not need the per-arc
+      /// lists of buildSegmentation / finalizeSegmentation. A critical vertex
+      /// takes its adjacent arc of highest id. If given, regionSizes receives
+      /// the number of regular vertices of each segmentation id. Isolated
+      /// vertices get -1 in both arrays.
+      void getVertexSegmentation(SimplexId *arcIds,
+                                 char *regionTypes,
+                                 std::vector<SimplexId> *regionSizes
+                                 = nullptr);
+
       // -------------
       // ACCESSOR
       // ------------
@@ -332,6 +354,10 @@ namespace ttk {
         params_->segm = segm;
       }
 
+      inline void setDirectSegmentation(const bool direct) {
+        params_->directSegm = direct;
+      }
+
       inline void setNormalizeIds(const bool normalize) {
         params_->normalize = normalize;
       }
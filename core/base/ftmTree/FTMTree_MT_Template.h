@@ -31,58 +31,27 @@ namespace ttk {
   namespace ftm {
 
     template <typename scalarType, typename idType>
-    void ftm::FTMTree_MT::sortInput(void) {
-      const auto &nbVertices = scalars_->size;
-
-      auto *sortedVect = scalars_->sortedVertices.get();
-      if(sortedVect == nullptr) {
-        sortedVect = new std::vector<SimplexId>(0);
-        scalars_->sortedVertices.reset(sortedVect);
-      } else {
-        sortedVect->clear();
+    int ftm::FTMTree_MT::sortInput(void) {
+
+      // shared with the other filters processing this field
+      const auto order = mesh_->getVertexOrder(
+        static_cast<const scalarType *>(scalars_->values),
+        static_cast<const idType *>(scalars_->offsets), threadNumber_);
+
+      if(!order) {
+        std::stringstream msg;
+        msg << "[FTM] Could not sort the vertices." << std::endl;
+        dMsg(std::cerr, msg.str(), fatalMsg);
+        return -1;
       }
 
-      auto indirect_sort = [&](const size_t &a, const size_t &b) {
-        return isLower<scalarType, idType>(a, b);
-      };
-
-      sortedVect->resize(nbVertices, 0);
-      std::iota(
-        sortedVect->begin(), sortedVect->end(), static_cast<SimplexId>(0));
-
-      // #pragma omp parallel
-      // #pragma omp single
-      //    scalars_->qsort<SimplexId>(sortedVect->data(), 0, scalars_->size -1,
-      //    indirect_sort);
-
-#ifdef TTK_ENABLE_OPENMP
-#ifdef __clang__
-      std::cout << "Caution, outside GCC, sequential sort" << std::endl;
-      std::sort(sortedVect->begin(), sortedVect->end(), indirect_sort);
-#else
-      __gnu_parallel::sort(
-        sortedVect->begin(), sortedVect->end(), indirect_sort);
-#endif
-#else
-      std::sort(sortedVect->begin(), sortedVect->end(), indirect_sort);
-#endif
+      // the arrays keep the order alive, no copy
+      scalars_->sortedVertices = std::shared_ptr<const std::vector<SimplexId>>(
+        order, &order->getSortedVertices());
+      scalars_->mirrorVertices = std::shared_ptr<const std::vector<SimplexId>>(
+        order, &order->getVertexRanks());
 
-      auto *mirrorVert = scalars_->mirrorVertices.get();
-      if(mirrorVert == nullptr) {
-        mirrorVert = new std::vector<SimplexId>(0);
-        scalars_->mirrorVertices.reset(mirrorVert);
-      } else {
-        mirrorVert->clear();
-      }
-
-      scalars_->mirrorVertices->resize(nbVertices);
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for
-#endif
-      for(SimplexId i = 0; i < nbVertices; i++) {
-        (*scalars_->mirrorVertices)[(*sortedVect)[i]] = i;
-      }
+      return 0;
     }
 
   } // namespace ftm
@@ -28,7 +28,7 @@
 // -------
 
 template <typename scalarType, typename idType>
-void ttk::ftm::FTMTree::build(void) {
+int ttk::ftm::FTMTree::build(void) {
   // -----
   // INPUT
   // -----
@@ -123,7 +123,8 @@ void ttk::ftm::FTMTree::build(void) {
   // and regions / segmentation
   DebugTimer sortTime;
   initSoS<idType>();
-  sortInput<scalarType, idType>();
+  if(sortInput<scalarType, idType>())
+    return -1;
   printTime(sortTime, "[FTM] sort step", -1, 3);
 
   // -----
@@ -141,7 +142,8 @@ void ttk::ftm::FTMTree::build(void) {
 #endif
 
   // Build the list of regular vertices of the arc
-  if(params_->segm) {
+  // (not needed by the direct segmentation, read from vert2tree)
+  if(params_->segm && !params_->directSegm) {
     switch(params_->treeType) {
       case TreeType::Join:
         getJoinTree()->buildSegmentation();
@@ -202,6 +204,8 @@ void ttk::ftm::FTMTree::build(void) {
         printTree2();
     }
   }
+
+  return 0;
 }
 
 #endif /* end of include guard: FTMTREE_TPL_H */
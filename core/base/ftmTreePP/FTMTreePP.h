@@ -31,16 +31,22 @@ namespace ttk {
       FTMTreePP();
       virtual ~FTMTreePP();
 
+      /// Compute the persistence pairs of the join (\p jt true) or split
+      /// tree, sorted by persistence. The pairs of persistence lower than
+      /// \p threshold are not stored, except the pair of the global
+      /// extrema.
       template <typename scalarType>
       void computePersistencePairs(
         std::vector<std::tuple<SimplexId, SimplexId, scalarType>> &pairs,
-        const bool jt);
+        const bool jt,
+        const double threshold = 0);
 
     protected:
       template <typename scalarType>
       void computePairs(
         ftm::FTMTree_MT *tree,
-        std::vector<std::tuple<SimplexId, SimplexId, scalarType>> &pairs);
+        std::vector<std::tuple<SimplexId, SimplexId, scalarType>> &pairs,
+        const double threshold);
 
       template <typename scalarType>
       void sortPairs(
@@ -82,7 +88,8 @@ namespace ttk {
         const idNode current,
         std::vector<std::tuple<SimplexId, SimplexId, scalarType>> &pairs,
         ftm::FTMTree_MT *tree,
-        const SimplexId mp) {
+        const SimplexId mp,
+        const double threshold) {
         AtomicUF *uf = nodesUF_[current]->find();
         const SimplexId curVert = tree->getNode(current)->getVertexId();
         const scalarType curVal = getValue<scalarType>(curVert);
@@ -92,11 +99,12 @@ namespace ttk {
           AtomicUF::makeUnion(uf, nodesUF_[nodeid]);
           if(tmpVert != mp) {
             const scalarType tmpVal = getValue<scalarType>(tmpVert);
-            if(scalars_->isLower(tmpVert, curVert)) {
-              pairs.emplace_back(tmpVert, curVert, curVal - tmpVal);
-            } else {
-              pairs.emplace_back(tmpVert, curVert, tmpVal - curVal);
-            }
+            const scalarType persistence = scalars_->isLower(tmpVert, curVert)
+                                             ? curVal - tmpVal
+                                             : tmpVal - curVal;
+            // the pairs closed at the root (mp == nullVertex) are kept
+            if(mp == ftm::nullVertex or persistence >= threshold)
+              pairs.emplace_back(tmpVert, curVert, persistence);
           }
         }
       }
@@ -107,7 +115,8 @@ namespace ttk {
 template <typename scalarType>
 void ttk::ftm::FTMTreePP::computePersistencePairs(
   std::vector<std::tuple<SimplexId, SimplexId, scalarType>> &pairs,
-  const bool jt) {
+  const bool jt,
+  const double threshold) {
   ftm::FTMTree_MT *tree = jt ? getJoinTree() : getSplitTree();
 
   nodesUF_.clear();
@@ -120,7 +129,7 @@ void ttk::ftm::FTMTreePP::computePersistencePairs(
     nodesUF_[nid] = new AtomicUF(tree->getNode(nid)->getVertexId());
   }
 
-  computePairs<scalarType>(tree, pairs);
+  computePairs<scalarType>(tree, pairs, threshold);
 
   sortPairs<scalarType>(tree, pairs);
 
@@ -134,7 +143,8 @@ void ttk::ftm::FTMTreePP::computePersistencePairs(
 template <typename scalarType>
 void ttk::ftm::FTMTreePP::computePairs(
   ftm::FTMTree_MT *tree,
-  std::vector<std::tuple<SimplexId, SimplexId, scalarType>> &pairs) {
+  std::vector<std::tuple<SimplexId, SimplexId, scalarType>> &pairs,
+  const double threshold) {
   auto getParentNode = [&](const idNode current) {
     const idSuperArc parentArc = tree->getNode(current)->getUpSuperArcId(0);
     return tree->getSuperArc(parentArc)->getUpNodeId();
@@ -153,7 +163,8 @@ void ttk::ftm::FTMTreePP::computePairs(
     toSee.pop();
 
     if(!tree->getNode(current)->getNumberOfUpSuperArcs()) {
-      createPairs<scalarType>(current, pairs, tree, ftm::nullVertex);
+      createPairs<scalarType>(
+        current, pairs, tree, ftm::nullVertex, threshold);
       clearPendingNodes(current);
       continue;
     } else {
@@ -167,7 +178,8 @@ void ttk::ftm::FTMTreePP::computePairs(
        == tree->getNode(parentNode)->getNumberOfDownSuperArcs()) {
       const SimplexId mostPersist
         = getMostPersistVert<scalarType>(parentNode, tree);
-      createPairs<scalarType>(parentNode, pairs, tree, mostPersist);
+      createPairs<scalarType>(
+        parentNode, pairs, tree, mostPersist, threshold);
       nodesUF_[parentNode]->find()->setExtrema(mostPersist);
       toSee.push(parentNode);
     }
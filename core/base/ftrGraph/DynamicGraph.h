@@ -7,7 +7,18 @@
 ///
 /// This class deal with dynamic graph part of the algorithm, thracking the
 /// number of contour on each vertex to deduce the Reeb graph. This is done
-/// using an ST-tree.
+/// using a link-cut tree: each tree of the forest is stored as a set of
+/// preferred paths, each path being a splay tree ordered by depth. Link, cut,
+/// evert and root queries cost O(log n) amortized instead of the depth of the
+/// tree. Edges are stored as extra nodes so that their weights follow the
+/// everts, allocated on demand: the forest only holds the edges of the
+/// current level sets.
+///
+/// The propagations sharing a graph update distinct trees (the level sets
+/// they sweep), so only the pool of edge nodes is protected. The root
+/// queries may look at the trees of other propagations: they do not splay,
+/// they walk up to the top of the splay trees and down to the first node of
+/// the path without modifying the forest.
 ///
 /// \sa ttk::FTRGraph
 
@@ -16,6 +27,7 @@
 
 #include "FTRCommon.h"
 
+#include <limits>
 #include <set>
 #include <vector>
 
@@ -30,7 +42,20 @@ namespace ttk {
     template <typename Type>
     class DynamicGraph : public Allocable {
     protected:
+      // nodes of the graph, ids in [0, nbElmt_), followed by the nodes
+      // storing the edges of the forest. The capacity is reserved for the
+      // largest forest so that the nodes never move, but only the edges
+      // created are constructed.
       std::vector<DynGraphNode<Type>> nodes_;
+      // the two nodes linked by each edge, from nbElmt_, and the next edge
+      // around each of them
+      struct EdgeEnds {
+        idEdge ends_[2];
+        idEdge next_[2];
+      };
+      std::vector<EdgeEnds> edgeEnds_;
+      // unused edge nodes
+      std::vector<idEdge> freeEdges_;
 
     public:
       DynamicGraph();
@@ -48,6 +73,7 @@ namespace ttk {
       /// \pre needs nbElmt_ to be set.
       void alloc() override;
 
+      /// disconnect all the nodes
       void init() override;
 
       // Dyn Graph functions
@@ -63,12 +89,12 @@ namespace ttk {
       }
 
       /// \brief get the id of the node: node
-      std::size_t getNodeId(DynGraphNode<Type> *node) {
+      std::size_t getNodeId(const DynGraphNode<Type> *node) const {
         return std::distance(&(nodes_[0]), node);
       }
 
       void setSubtreeArc(const std::size_t nid, const idSuperArc arc) {
-        getNode(nid)->findRoot()->setRootArc(arc);
+        nodes_[findRootId(nid)].setRootArc(arc);
       }
 
       void setCorArc(const std::size_t nid, idSuperArc arc) {
@@ -76,7 +102,7 @@ namespace ttk {
       }
 
       idSuperArc getSubtreeArc(const std::size_t nid) const {
-        return getNode(nid)->findRootArc();
+        return nodes_[findRootId(nid)].getCorArc();
       }
 
       idSuperArc getCorArc(const std::size_t nid) const {
@@ -85,22 +111,22 @@ namespace ttk {
 
       // check wether or not this node is connected to others
       bool isDisconnected(const DynGraphNode<Type> *const node) const {
-        return !node->hasParent();
+        return isDisconnected(getNodeId(node));
       }
 
       // check wether or not this node is connected to others
-      bool isDisconnected(const std::size_t nid) {
-        return !getNode(nid)->hasParent();
+      bool isDisconnected(const std::size_t nid) const {
+        return findRootId(nid) == static_cast<idEdge>(nid);
       }
 
       /// \brief recover the root of a node
       DynGraphNode<Type> *findRoot(const DynGraphNode<Type> *const node) {
-        return node->findRoot();
+        return findRoot(getNodeId(node));
       }
 
       /// \brief recover the root of a node using its id
       DynGraphNode<Type> *findRoot(const std::size_t nid) {
-        return findRoot(getNode(nid));
+        return getNode(findRootId(nid));
       }
 
       /// \brief recover the root of several nodes once, using
@@ -144,43 +170,43 @@ namespace ttk {
         return roots;
       }
 
+      /// Create a new edge between n1 and n2. The forest is kept maximal for
+      /// the weights: if n1 and n2 are already connected, the edge of minimal
+      /// weight on the path between them is replaced by the new one if it is
+      /// heavier.
       /// \ret true if we have merged two tree, false if it was just an intern
       /// operation
       bool insertEdge(DynGraphNode<Type> *const n1,
                       DynGraphNode<Type> *const n2,
                       const Type w,
                       const idSuperArc corArc) {
-        return n1->insertEdge(n2, w, corArc);
+        return insertEdge(getNodeId(n1), getNodeId(n2), w, corArc);
       }
 
       /// inert or replace existing edge between n1 and n2
       bool insertEdge(const std::size_t n1,
                       const std::size_t n2,
                       const Type w,
-                      const idSuperArc corArc) {
-        return insertEdge(getNode(n1), getNode(n2), w, corArc);
-      }
+                      const idSuperArc corArc);
 
       /// remove the link btwn n and its parent
       void removeEdge(DynGraphNode<Type> *const n) {
-        n->removeEdge();
+        removeEdge(getNodeId(n));
       }
 
       /// remove the link btwn n and its parent
-      void removeEdge(const std::size_t nid) {
-        removeEdge(getNode(nid));
-      }
+      void removeEdge(const std::size_t nid);
 
       /// remove the edge btwn n1 and n2
       /// \ret 0 if not an edge
       int removeEdge(DynGraphNode<Type> *const n1,
-                     DynGraphNode<Type> *const n2);
+                     DynGraphNode<Type> *const n2) {
+        return removeEdge(getNodeId(n1), getNodeId(n2));
+      }
 
       /// remove the edge btwn n1 and n2
       /// \ret 0 if not an edge
-      int removeEdge(const std::size_t nid1, const std::size_t nid2) {
-        return removeEdge(getNode(nid1), getNode(nid2));
-      }
+      int removeEdge(const std::size_t nid1, const std::size_t nid2);
 
       // Debug
 
@@ -191,6 +217,76 @@ namespace ttk {
       std::string printNbCC(void);
 
       void test(void);
+
+    protected:
+      // Link-cut tree
+      // -------------
+
+      /// root of the represented tree of nid, the forest is not modified
+      idEdge findRootId(const std::size_t nid) const;
+
+      /// parent of nid in the represented tree (nullEdge for a root)
+      idEdge getParent(const idEdge nid);
+
+      /// edge between nid and its parent (nullEdge for a root), at the root
+      /// of the splay tree storing the path from the root to nid
+      idEdge getParentEdge(const idEdge nid);
+
+      /// other node linked by an edge around nid
+      idEdge getEdgeEnd(const idEdge edge, const idEdge nid) const {
+        const auto &ends = edgeEnds_[edge - nbElmt_].ends_;
+        return ends[ends[0] == nid];
+      }
+
+      /// next edge around nid
+      idEdge getNextEdge(const idEdge edge, const idEdge nid) const {
+        const auto &ends = edgeEnds_[edge - nbElmt_];
+        return ends.next_[ends.ends_[0] != nid];
+      }
+
+      /// make nid the root of its tree, it takes the arc of the former root
+      void evert(const idEdge nid);
+
+      /// nid becomes a child of parent through a new edge
+      /// \pre nid is the root of its tree, parent is in another tree
+      void link(const idEdge nid, const idEdge parent, const Type weight);
+
+      /// remove an edge of the forest
+      /// \ret the node below the edge, now the root of its tree
+      idEdge cut(const idEdge edge);
+
+      /// move nid at the root of its splay tree, the splay tree of nid then
+      /// stores the path from the root of the represented tree to nid
+      void access(const idEdge nid);
+
+      /// last node of the path stored in the splay subtree of nid, moved at
+      /// the root of its splay tree
+      idEdge lastNode(const idEdge nid);
+
+      void splay(const idEdge nid);
+
+      /// rotate nid above its parent, only the parent is updated
+      void rotate(const idEdge nid, const bool parentIsRoot);
+
+      bool isSplayRoot(const idEdge nid) const {
+        const idEdge parent = nodes_[nid].parent_;
+        return parent == nullEdge
+               || (nodes_[parent].children_[0] != nid
+                   && nodes_[parent].children_[1] != nid);
+      }
+
+      /// reverse the path stored in the splay subtree of nid
+      void reverse(const idEdge nid);
+
+      /// apply the pending reversal of nid on its children
+      void push(const idEdge nid);
+
+      /// recompute the aggregated values of nid from its children
+      void update(const idEdge nid);
+
+      idEdge newEdgeNode(const Type weight);
+
+      void deleteEdgeNode(const idEdge nid);
     };
 
     // Same as dynamic graph but keep the number of subtrees at any time
@@ -217,12 +313,8 @@ namespace ttk {
       }
 
       void reset() {
-        for(auto &node : this->nodes_) {
-          node.parent_ = nullptr;
-          node.weight_ = 0;
-          std::ignore = node;
-        }
-        nbCC_ = this->nodes_.size();
+        super::init();
+        nbCC_ = this->nbElmt_;
       }
 
       /// \ret true if we have merged two tree, false if it was just an intern
@@ -285,54 +377,41 @@ namespace ttk {
       }
     };
 
-    /// \brief class representing a node
-    /// of a tree and the link to its parent if not the root
+    /// \brief class representing a node of the link-cut tree: either a node
+    /// of the graph or an edge of the forest
     template <typename Type>
     struct DynGraphNode {
-      DynGraphNode *parent_;
-      Type weight_;
+      // parent in the splay tree, or path-parent for the root of a splay tree
+      idEdge parent_;
+      idEdge children_[2];
+      // minimum weight of the edges in the splay subtree
+      Type minWeight_;
+      union {
+        // weight of an edge
+        Type weight_;
+        // first edge around a node of the graph
+        idEdge firstEdge_;
+      };
+
+      // the children are to be reversed
+      bool reversed_;
 
       idSuperArc corArc_;
 
       explicit DynGraphNode()
-        : parent_(nullptr), weight_(0), corArc_(nullSuperArc) {
-      }
-
-      DynGraphNode(const DynGraphNode &other) {
-        operator=(other);
-      }
-
-      DynGraphNode &operator=(const DynGraphNode &other) {
-        parent_ = other.parent_;
-        weight_ = other.weight_;
-        return *this;
+        : parent_(nullEdge), children_{nullEdge, nullEdge},
+          minWeight_(std::numeric_limits<Type>::max()), firstEdge_(nullEdge),
+          reversed_(false), corArc_(nullSuperArc) {
       }
 
       // Accessor functions
       // ------------------
 
+      /// weight of an edge of the forest
       Type getWeight(void) const {
         return weight_;
       }
 
-      bool hasParent(void) const {
-        return parent_;
-      }
-
-      // Graph functions
-      // ---------------
-
-      /// Make this node the root of its tree
-      // Various way to do that, test perfs ?
-      void evert(void);
-
-      /// Get representative node
-      DynGraphNode *findRoot(void) const;
-
-      /// Get the arcs corresponding to this subtree:
-      /// find the root before
-      idSuperArc findRootArc(void) const;
-
       /// Get the arcs corresponding to this subtree
       idSuperArc getCorArc() const {
         idSuperArc corArc;
@@ -343,24 +422,12 @@ namespace ttk {
         return corArc;
       }
 
-      void setRootArc(const idSuperArc arcId);
-
-      /// Get representative node and kepp track of
-      /// the node with the min weight on the path
-      /// \ret tuple<root, node with min weight>
-      std::tuple<DynGraphNode<Type> *, DynGraphNode<Type> *>
-        findMinWeightRoot() const;
-
-      /// Create a new edge between this node and the node n
-      /// \ret true if we have merged two tree, false if it was just an intern
-      /// operation
-      bool insertEdge(DynGraphNode *const n,
-                      const Type weight,
-                      const idSuperArc corArc);
-
-      /// Remove the link between this node and its parent, thus makeing a new
-      /// root
-      void removeEdge(void);
+      void setRootArc(const idSuperArc arcId) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic write
+#endif
+        corArc_ = arcId;
+      }
     };
   } // namespace ftr
 } // namespace ttk
@@ -20,27 +20,91 @@ namespace ttk {
 
     template <typename Type>
     void DynamicGraph<Type>::alloc() {
+      // a forest has less edges than nodes: the edge nodes never move while
+      // other propagations use them
+      nodes_.reserve(2 * nbElmt_);
       nodes_.resize(nbElmt_);
+      edgeEnds_.reserve(nbElmt_);
     }
 
     template <typename Type>
     void DynamicGraph<Type>::init() {
+      nodes_.resize(nbElmt_);
+      std::fill(nodes_.begin(), nodes_.end(), DynGraphNode<Type>());
+      edgeEnds_.clear();
+      freeEdges_.clear();
     }
 
     template <typename Type>
-    int DynamicGraph<Type>::removeEdge(DynGraphNode<Type> *const n1,
-                                       DynGraphNode<Type> *const n2) {
-      if(n1->parent_ == n2) {
-        removeEdge(n1);
-        return 1;
+    bool DynamicGraph<Type>::insertEdge(const std::size_t n1,
+                                        const std::size_t n2,
+                                        const Type w,
+                                        const idSuperArc corArc) {
+      evert(n1);
+      access(n2);
+
+      // n1 is in the splay tree of n2 if they are in the same tree
+      const bool merge = nodes_[n1].parent_ == nullEdge;
+      if(merge) {
+        link(n1, n2, w);
+        nodes_[n2].setRootArc(corArc);
+      } else if(w > nodes_[n2].minWeight_) {
+        // The splay tree of n2 stores the path from n1 to n2. We need replace
+        // the min edge by the new one as the current weight is higher (Parsa
+        // like). The min edge closest to n2 is removed.
+        const Type minWeight = nodes_[n2].minWeight_;
+        idEdge minEdge = n2;
+        while(true) {
+          push(minEdge);
+          const idEdge right = nodes_[minEdge].children_[1];
+          if(right != nullEdge && nodes_[right].minWeight_ == minWeight) {
+            minEdge = right;
+          } else if(minEdge >= nbElmt_
+                    && nodes_[minEdge].weight_ == minWeight) {
+            break;
+          } else {
+            minEdge = nodes_[minEdge].children_[0];
+          }
+        }
+
+        // remove old, add new
+        nodes_[cut(minEdge)].setRootArc(corArc);
+        link(n1, n2, w);
+      } else {
+        nodes_[n1].setRootArc(corArc);
       }
 
-      if(n2->parent_ == n1) {
-        removeEdge(n2);
-        return 2;
+      return merge;
+    }
+
+    template <typename Type>
+    void DynamicGraph<Type>::removeEdge(const std::size_t nid) {
+      const idEdge edge = getParentEdge(nid);
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(edge == nullEdge) {
+        std::cerr << "[FTR Graph]: DynGraph remove edge in root node"
+                  << std::endl;
+      } else
+#endif
+      {
+        cut(edge);
       }
+    }
 
-      return 0;
+    template <typename Type>
+    int DynamicGraph<Type>::removeEdge(const std::size_t nid1,
+                                       const std::size_t nid2) {
+      int res = 0;
+      // most calls are on nodes without forest edges, the others have few
+      idEdge edge = nodes_[nid1].firstEdge_;
+      while(edge != nullEdge
+            && getEdgeEnd(edge, nid1) != static_cast<idEdge>(nid2)) {
+        edge = getNextEdge(edge, nid1);
+      }
+      if(edge != nullEdge) {
+        res = cut(edge) == static_cast<idEdge>(nid1) ? 1 : 2;
+      }
+      return res;
     }
 
     template <typename Type>
@@ -49,19 +113,17 @@ namespace ttk {
 
       stringstream res;
 
-      for(const auto &node : nodes_) {
-        if(1 or node.parent_) {
-          res << "id: " << &node - &nodes_[0];
-          if(node.parent_) {
-            res << ", parent: " << node.parent_ - &nodes_[0];
-          } else {
-            res << ", parent: X";
-          }
-          res << " root: " << findRoot(&node) - &nodes_[0];
-          res << " weight: " << (float)node.weight_;
-          res << " cArc: " << node.corArc_;
-          res << endl;
+      for(idEdge i = 0; i < nbElmt_; ++i) {
+        const idEdge parent = getParent(i);
+        res << "id: " << i;
+        if(parent != nullEdge) {
+          res << ", parent: " << parent;
+        } else {
+          res << ", parent: X";
         }
+        res << " root: " << findRootId(i);
+        res << " cArc: " << nodes_[i].corArc_;
+        res << endl;
       }
       return res.str();
     }
@@ -73,16 +135,12 @@ namespace ttk {
 
       stringstream res;
 
-      for(const auto &node : nodes_) {
-        if(node.parent_) {
-          res << "id: " << printFunction(&node - &nodes_[0])
-              << " weight: " << (float)node.weight_;
-          if(node.parent_) {
-            res << ", parent: " << printFunction(node.parent_ - &nodes_[0]);
-          } else {
-            res << ", parent: X";
-          }
-          res << " root: " << printFunction(findRoot(&node) - &nodes_[0]);
+      for(idEdge i = 0; i < nbElmt_; ++i) {
+        const idEdge parent = getParent(i);
+        if(parent != nullEdge) {
+          res << "id: " << printFunction(i);
+          res << ", parent: " << printFunction(parent);
+          res << " root: " << printFunction(findRootId(i));
         }
       }
       return res.str();
@@ -92,151 +150,296 @@ namespace ttk {
     std::string DynamicGraph<Type>::printNbCC(void) {
       using namespace std;
       stringstream res;
-      std::vector<DynGraphNode<Type> *> roots;
-      roots.reserve(nodes_.size());
-      for(const auto &n : nodes_) {
-        roots.emplace_back(n.findRoot());
+      std::vector<idEdge> roots;
+      roots.reserve(nbElmt_);
+      for(idEdge i = 0; i < nbElmt_; ++i) {
+        roots.emplace_back(findRootId(i));
       }
       std::sort(roots.begin(), roots.end());
       const auto it = std::unique(roots.begin(), roots.end());
       roots.erase(it, roots.end());
-      res << "nb nodes " << nodes_.size() << std::endl;
+      res << "nb nodes " << nbElmt_ << std::endl;
       res << "nb cc " << roots.size() << std::endl;
       return res.str();
     }
 
-    // DynGraphNode ----------------------------------
+    // Link-cut tree ---------------------------------
 
     template <typename Type>
-    void DynGraphNode<Type>::evert(void) {
-      if(!parent_)
-        return;
+    idEdge DynamicGraph<Type>::findRootId(const std::size_t nid) const {
+      // the root of the represented tree is the first node of the path at the
+      // top: the splay tree of this path is the one without path-parent
+      idEdge curNode = nid;
+      while(nodes_[curNode].parent_ != nullEdge) {
+        curNode = nodes_[curNode].parent_;
+      }
 
-      DynGraphNode<Type> *curNode = this;
+      // the children of a node are to be swapped when an odd number of its
+      // ancestors have a pending reversal
+      bool reversed = false;
+      while(true) {
+        const idEdge left = nodes_[curNode].children_[reversed];
+        if(left == nullEdge)
+          break;
+        reversed = reversed != nodes_[curNode].reversed_;
+        curNode = left;
+      }
+      return curNode;
+    }
 
-      DynGraphNode<Type> *parentNode = curNode->parent_;
-      Type parentWeight = curNode->weight_;
+    template <typename Type>
+    idEdge DynamicGraph<Type>::getParent(const idEdge nid) {
+      const idEdge edge = getParentEdge(nid);
+      if(edge == nullEdge)
+        return nullEdge;
+      return getEdgeEnd(edge, nid);
+    }
 
-      DynGraphNode<Type> *gParentNode = parentNode->parent_;
-      Type gParentWeight = parentNode->weight_;
+    template <typename Type>
+    idEdge DynamicGraph<Type>::getParentEdge(const idEdge nid) {
+      // quick exit for the roots alone in their splay tree (most of the
+      // disconnected nodes)
+      if(nodes_[nid].parent_ == nullEdge
+         && nodes_[nid].children_[0] == nullEdge)
+        return nullEdge;
+
+      access(nid);
+      const idEdge above = nodes_[nid].children_[0];
+      if(above == nullEdge)
+        return nullEdge;
+
+      // the edge to the parent is the last node of the path above nid
+      return lastNode(above);
+    }
 
-      curNode->parent_ = nullptr;
+    template <typename Type>
+    void DynamicGraph<Type>::evert(const idEdge nid) {
+      access(nid);
+      if(nodes_[nid].children_[0] == nullEdge)
+        return;
 
-      // Reverse all the node until the root
+      // keep same arc than the current root, the first node of the path
+      idEdge root = nodes_[nid].children_[0];
       while(true) {
-        parentNode->parent_ = curNode;
-        parentNode->weight_ = parentWeight;
-
-        curNode = parentNode;
-        parentNode = gParentNode;
-        parentWeight = gParentWeight;
-
-        if(gParentNode) {
-          gParentWeight = gParentNode->weight_;
-          gParentNode = gParentNode->parent_;
-        } else {
-          // keep same arc than the current root
-          // if cur > this ?
-          corArc_ = curNode->corArc_;
+        push(root);
+        const idEdge left = nodes_[root].children_[0];
+        if(left == nullEdge)
           break;
-        }
+        root = left;
       }
+      nodes_[nid].setRootArc(nodes_[root].corArc_);
+      reverse(nid);
     }
 
     template <typename Type>
-    DynGraphNode<Type> *DynGraphNode<Type>::findRoot(void) const {
-      // the lastNode trick is used so we are sure to have a non null
-      // return even if another thread is touching these nodes.
-      DynGraphNode *curNode = const_cast<DynGraphNode<Type> *>(this);
-      DynGraphNode *lastNode = curNode;
-      while(curNode) {
-        lastNode = curNode;
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic read
-#endif
-        curNode = curNode->parent_;
+    void DynamicGraph<Type>::link(const idEdge nid,
+                                  const idEdge parent,
+                                  const Type weight) {
+      // nid hangs from the edge: as the root of its tree, it is the first
+      // node of its path once at the root of its splay tree
+      if(!isSplayRoot(nid)) {
+        access(nid);
       }
-      return lastNode;
+      const idEdge edge = newEdgeNode(weight);
+      nodes_[edge].parent_ = parent;
+      nodes_[nid].parent_ = edge;
+
+      auto &ends = edgeEnds_[edge - nbElmt_];
+      ends.ends_[0] = nid;
+      ends.ends_[1] = parent;
+      ends.next_[0] = nodes_[nid].firstEdge_;
+      ends.next_[1] = nodes_[parent].firstEdge_;
+      nodes_[nid].firstEdge_ = edge;
+      nodes_[parent].firstEdge_ = edge;
     }
 
     template <typename Type>
-    idSuperArc DynGraphNode<Type>::findRootArc(void) const {
-      return findRoot()->corArc_;
+    idEdge DynamicGraph<Type>::cut(const idEdge edge) {
+      // the splay tree of the edge stores the path from the root to its
+      // parent node, the path of the child node hangs from the edge
+      access(edge);
+      const idEdge above = nodes_[edge].children_[0];
+      nodes_[above].parent_ = nullEdge;
+
+      const auto &ends = edgeEnds_[edge - nbElmt_].ends_;
+      idEdge child = ends[0];
+      splay(child);
+      if(nodes_[child].parent_ != edge) {
+        child = ends[1];
+        splay(child);
+      }
+      nodes_[child].parent_ = nullEdge;
+
+      // unlink the edge around its nodes
+      for(const idEdge nid : ends) {
+        idEdge *prev = &nodes_[nid].firstEdge_;
+        while(*prev != edge) {
+          auto &prevEnds = edgeEnds_[*prev - nbElmt_];
+          prev = &prevEnds.next_[prevEnds.ends_[0] != nid];
+        }
+        *prev = getNextEdge(edge, nid);
+      }
+      deleteEdgeNode(edge);
+      return child;
     }
 
     template <typename Type>
-    void DynGraphNode<Type>::setRootArc(const idSuperArc arcId) {
-      corArc_ = arcId;
+    void DynamicGraph<Type>::access(const idEdge nid) {
+      idEdge last = nullEdge;
+      for(idEdge curNode = nid; curNode != nullEdge;
+          curNode = nodes_[curNode].parent_) {
+        splay(curNode);
+        // the deeper part of the path becomes a path of its own
+        nodes_[curNode].children_[1] = last;
+        update(curNode);
+        last = curNode;
+      }
+      splay(nid);
     }
 
     template <typename Type>
-    std::tuple<DynGraphNode<Type> *, DynGraphNode<Type> *>
-      DynGraphNode<Type>::findMinWeightRoot() const {
-
-      DynGraphNode *minNode = const_cast<DynGraphNode<Type> *>(this);
-      auto minW = minNode->weight_;
-      DynGraphNode *curNode = minNode->parent_;
+    idEdge DynamicGraph<Type>::lastNode(const idEdge nid) {
+      idEdge curNode = nid;
+      while(true) {
+        push(curNode);
+        const idEdge right = nodes_[curNode].children_[1];
+        if(right == nullEdge)
+          break;
+        curNode = right;
+      }
+      splay(curNode);
+      return curNode;
+    }
 
-      if(!curNode)
-        return std::make_tuple(curNode, minNode);
+    template <typename Type>
+    void DynamicGraph<Type>::splay(const idEdge nid) {
+      // path from nid to the root of its splay tree, one buffer per thread
+      // as the propagations update the graph concurrently
+      static thread_local std::vector<idEdge> path;
+
+      // apply the pending reversals from the root of the splay tree
+      path.clear();
+      path.emplace_back(nid);
+      while(!isSplayRoot(path.back())) {
+        path.emplace_back(nodes_[path.back()].parent_);
+      }
+      const std::size_t depth = path.size() - 1;
+      for(std::size_t i = 0; i <= depth; ++i) {
+        push(path[depth - i]);
+      }
+      if(!depth) {
+        return;
+      }
 
-      while(curNode->parent_) {
-        if(curNode->weight_ < minW) {
-          minNode = curNode;
-          minW = minNode->weight_;
+      // the ancestors of nid are known: path[i] is its parent then
+      // grand parent as it goes up
+      std::size_t i = 1;
+      for(; i + 1 <= depth; i += 2) {
+        const idEdge parent = path[i];
+        const idEdge gParent = path[i + 1];
+        const bool zigZig = (nodes_[gParent].children_[0] == parent)
+                            == (nodes_[parent].children_[0] == nid);
+        if(zigZig) {
+          rotate(parent, i + 1 == depth);
+          rotate(nid, i + 1 == depth);
+        } else {
+          rotate(nid, false);
+          rotate(nid, i + 1 == depth);
         }
-        curNode = curNode->parent_;
       }
-      return std::make_tuple(curNode, minNode);
+      if(i == depth) {
+        rotate(nid, true);
+      }
+      update(nid);
     }
 
     template <typename Type>
-    bool DynGraphNode<Type>::insertEdge(DynGraphNode<Type> *const n,
-                                        const Type weight,
-                                        const idSuperArc corArc) {
-      evert();
-      auto nNodes = n->findMinWeightRoot();
-
-      if(std::get<0>(nNodes) != this) {
-        // The two nodes are in two different trees
-        parent_ = n;
-        weight_ = weight;
-        n->corArc_ = corArc;
-        return true;
+    void DynamicGraph<Type>::rotate(const idEdge nid, const bool parentIsRoot) {
+      DynGraphNode<Type> &curNode = nodes_[nid];
+      const idEdge parent = curNode.parent_;
+      DynGraphNode<Type> &parentNode = nodes_[parent];
+      const idEdge gParent = parentNode.parent_;
+      const int side = parentNode.children_[1] == nid;
+      const idEdge inner = curNode.children_[1 - side];
+
+      if(!parentIsRoot) {
+        DynGraphNode<Type> &gParentNode = nodes_[gParent];
+        gParentNode.children_[gParentNode.children_[1] == parent] = nid;
       }
+      curNode.parent_ = gParent;
+      parentNode.children_[side] = inner;
+      if(inner != nullEdge) {
+        nodes_[inner].parent_ = parent;
+      }
+      curNode.children_[1 - side] = parent;
+      parentNode.parent_ = nid;
 
-      // here the nodes are in the same tree
-
-      if(weight > std::get<1>(nNodes)->weight_) {
-        // We need replace the min edge by the new one as the current weight is
-        // higher
+      update(parent);
+    }
 
-        // add arc (Parsa like)
-        parent_ = n;
-        weight_ = weight;
-        // corArc_ = corArc;
+    template <typename Type>
+    void DynamicGraph<Type>::reverse(const idEdge nid) {
+      DynGraphNode<Type> &curNode = nodes_[nid];
+      std::swap(curNode.children_[0], curNode.children_[1]);
+      curNode.reversed_ = !curNode.reversed_;
+    }
 
-        // remove old
-        std::get<1>(nNodes)->parent_ = 0;
-        std::get<1>(nNodes)->corArc_ = corArc;
-      } else {
-        corArc_ = corArc;
+    template <typename Type>
+    void DynamicGraph<Type>::push(const idEdge nid) {
+      DynGraphNode<Type> &curNode = nodes_[nid];
+      if(curNode.reversed_) {
+        for(const idEdge child : curNode.children_) {
+          if(child != nullEdge) {
+            reverse(child);
+          }
+        }
+        curNode.reversed_ = false;
       }
-
-      return false;
     }
 
     template <typename Type>
-    void DynGraphNode<Type>::removeEdge(void) {
-#ifndef TTK_ENABLE_KAMIKAZE
-      if(!parent_) {
-        std::cerr << "[FTR Graph]: DynGraph remove edge in root node"
-                  << std::endl;
-        return;
+    void DynamicGraph<Type>::update(const idEdge nid) {
+      DynGraphNode<Type> &curNode = nodes_[nid];
+      // the nodes of the graph do not bound the weights
+      curNode.minWeight_ = nid < nbElmt_ ? std::numeric_limits<Type>::max()
+                                         : curNode.weight_;
+      for(const idEdge child : curNode.children_) {
+        if(child != nullEdge) {
+          curNode.minWeight_
+            = std::min(curNode.minWeight_, nodes_[child].minWeight_);
+        }
       }
+    }
+
+    template <typename Type>
+    idEdge DynamicGraph<Type>::newEdgeNode(const Type weight) {
+      idEdge edge;
+      // the pool is shared by the propagations
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp critical(ttkDynamicGraphEdgeNodes)
 #endif
+      {
+        if(freeEdges_.empty()) {
+          edge = nodes_.size();
+          nodes_.emplace_back();
+          edgeEnds_.emplace_back();
+        } else {
+          edge = freeEdges_.back();
+          freeEdges_.pop_back();
+        }
+      }
+      nodes_[edge].weight_ = weight;
+      nodes_[edge].minWeight_ = weight;
+      return edge;
+    }
 
-      parent_ = nullptr;
+    template <typename Type>
+    void DynamicGraph<Type>::deleteEdgeNode(const idEdge nid) {
+      nodes_[nid] = DynGraphNode<Type>();
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp critical(ttkDynamicGraphEdgeNodes)
+#endif
+      freeEdges_.push_back(nid);
     }
 
   } // namespace ftr
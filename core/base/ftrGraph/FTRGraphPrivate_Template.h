@@ -143,7 +143,7 @@ namespace ttk {
         } else {
           // locally apply the lazy one the current growing arc
           for(const idEdge e : star.lower) {
-            const idSuperArc a = dynGraph(localProp).getNode(e)->findRootArc();
+            const idSuperArc a = dynGraph(localProp).getSubtreeArc(e);
             if(a != nullSuperArc && graph_.getArc(a).isVisible()
                && graph_.getArc(a).getPropagation()->getId()
                     == localProp->getId()) {
@@ -442,7 +442,7 @@ namespace ttk {
 
           // locally aply the lazy one the current growing arc
           for(const idEdge e : star.lower) {
-            const idSuperArc a = dynGraph(localProp).getNode(e)->findRootArc();
+            const idSuperArc a = dynGraph(localProp).getSubtreeArc(e);
             if(!lazy_.isEmpty(a)) {
               // process lazy
               // sort both list
@@ -87,7 +87,10 @@ namespace ttk {
 #endif
 
       DebugTimer timeSort;
-      scalars_->sort();
+      if(scalars_->sort(mesh_.getTriangulation())) {
+        std::cerr << "[FTR Graph]: could not sort the vertices" << std::endl;
+        return;
+      }
       printTime(timeSort, "[FTR Graph]: sort time: ", infoMsg);
 
       DebugTimer timePreSortSimplices;
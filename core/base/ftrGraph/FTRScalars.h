@@ -8,6 +8,7 @@
 #include <vector>
 
 #include <Debug.h>
+#include <Triangulation.h>
 
 namespace ttk {
   namespace ftr {
@@ -34,12 +35,15 @@ namespace ttk {
       bool externalOffsets_;
 
       std::vector<Vert<ScalarType>> vertices_;
-      std::vector<idVertex> mirror_;
+      // ranks of the vertex order shared by the triangulation, not copied
+      std::shared_ptr<const VertexOrder> order_;
+      const idVertex *mirror_;
 
     public:
       Scalars()
         : size_(nullVertex), values_(nullptr), vOffsets_(nullptr),
-          offsets_(nullptr), externalOffsets_(false), vertices_(), mirror_() {
+          offsets_(nullptr), externalOffsets_(false), vertices_(), order_(),
+          mirror_(nullptr) {
       }
 
       // Heavy, prevent using it
@@ -100,7 +104,6 @@ namespace ttk {
           offsets_ = new SimplexId[size_];
         }
         vertices_.resize(size_);
-        mirror_.resize(size_);
       }
 
       void init() {
@@ -125,20 +128,30 @@ namespace ttk {
         }
       }
 
-      void sort() {
-        // Sort the vertices array
-        ::ttk::ftr::parallel_sort<decltype(vertices_.begin())>(
-          vertices_.begin(), vertices_.end());
+      int sort(Triangulation *triangulation) {
+        // Sort the vertices array, using the vertex order shared with the
+        // other filters processing this field
+        order_ = triangulation->getVertexOrder(
+          values_, externalOffsets_ ? offsets_ : nullptr, threadNumber_);
+        if(!order_)
+          return -1;
+        const std::vector<SimplexId> &sorted = order_->getSortedVertices();
 
-        // Fill the mirror array, used for later comparisons
-        DebugTimer tt;
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_) \
   schedule(static, size_ / threadNumber_)
 #endif
         for(idVertex i = 0; i < size_; i++) {
-          mirror_[vertices_[i].id] = i;
+          const idVertex v = sorted[i];
+          vertices_[i].id = v;
+          vertices_[i].value = values_[v];
+          vertices_[i].offset = offsets_[v];
         }
+
+        // Mirror array, used for later comparisons
+        mirror_ = order_->getVertexRanks().data();
+
+        return 0;
       }
 
       void removeNaN(void) {
@@ -3,9 +3,21 @@
 using namespace std;
 using namespace ttk;
 
+// neighbor and star numbers of the vertices, indexed by position class (see
+// ImplicitTriangulation::getVertexPosition())
+static const SimplexId vertexNeighborNumbers3d[27]
+  = {4, 8, 7, 6, 10, 8, 4, 6, 4, 6, 10, 8, 10, 14,
+     10, 8, 10, 6, 4, 6, 4, 8, 10, 6, 7, 8, 4};
+static const SimplexId vertexStarNumbers3d[27]
+  = {2, 8, 6, 4, 12, 8, 2, 4, 2, 4, 12, 8, 12, 24,
+     12, 8, 12, 4, 2, 4, 2, 8, 12, 4, 6, 8, 2};
+static const SimplexId vertexNeighborNumbers2d[9] = {2, 4, 3, 4, 6, 4, 3, 4, 2};
+static const SimplexId vertexStarNumbers2d[9] = {1, 3, 2, 3, 6, 3, 2, 3, 1};
+
 ImplicitTriangulation::ImplicitTriangulation()
   : dimensionality_{-1}, cellNumber_{}, vertexNumber_{}, edgeNumber_{},
-    triangleNumber_{}, tetrahedronNumber_{}, isAccelerated_{} {
+    triangleNumber_{}, tetrahedronNumber_{}, isAccelerated_{},
+    useVertexPositionTable_{} {
 }
 
 ImplicitTriangulation::~ImplicitTriangulation() {
@@ -21,6 +33,8 @@ int ImplicitTriangulation::setInputGrid(const float &xOrigin,
                                         const SimplexId &yDim,
                                         const SimplexId &zDim) {
 
+  vertexPositions_.clear();
+
   // Dimensionality //
   if(xDim < 1 or yDim < 1 or zDim < 1)
     dimensionality_ = -1;
@@ -118,6 +132,29 @@ int ImplicitTriangulation::setInputGrid(const float &xOrigin,
     tetrahedronNumber_ = (xDim - 1) * (yDim - 1) * (zDim - 1) * 6;
     cellNumber_ = tetrahedronNumber_;
 
+    // interior vertex shifts (the neighbors and the star of an interior
+    // vertex are obtained by adding constant offsets)
+    const SimplexId p0[3] = {0, 0, 0};
+    for(int k = 0; k < 14; ++k)
+      vertexNeighborShifts_[k] = getVertexNeighborABCDEFGH(0, k);
+    for(int k = 0; k < 24; ++k)
+      vertexStarShifts_[k] = getVertexStarABCDEFGH(p0, k);
+    // same for the star of an interior edge of each type (L, H, P, D1, D2,
+    // D3), with regard to the first tetrahedron of its voxel (only used if
+    // such edges exist)
+    const SimplexId p1[3] = {1, 1, 1};
+    const SimplexId t1 = 6 + tetshift_[0] + tetshift_[1];
+    for(int k = 0; k < 6; ++k) {
+      edgeStarShifts_[0][k] = getEdgeStarL(p1, k) - t1;
+      edgeStarShifts_[1][k] = getEdgeStarH(p1, k) - t1;
+      edgeStarShifts_[2][k] = getEdgeStarP(p1, k) - t1;
+    }
+    for(int k = 0; k < 4; ++k) {
+      edgeStarShifts_[3][k] = getEdgeStarD1(p1, k) - t1;
+      edgeStarShifts_[4][k] = getEdgeStarD2(p1, k) - t1;
+      edgeStarShifts_[5][k] = getEdgeStarD3(p1, k) - t1;
+    }
+
     checkAcceleration();
   } else if(dimensionality_ == 2) {
     // dimensions selectors
@@ -156,6 +193,19 @@ int ImplicitTriangulation::setInputGrid(const float &xOrigin,
     triangleNumber_ = (dimensions_[Di_] - 1) * (dimensions_[Dj_] - 1) * 2;
     cellNumber_ = triangleNumber_;
 
+    // interior vertex shifts
+    const SimplexId p0[3] = {0, 0, 0};
+    for(int k = 0; k < 6; ++k) {
+      vertexNeighborShifts_[k] = getVertexNeighbor2dABCD(0, k);
+      vertexStarShifts_[k] = getVertexStar2dABCD(p0, k);
+    }
+    const SimplexId p1[2] = {1, 1};
+    const SimplexId t1 = 2 + tshift_[0];
+    for(int k = 0; k < 2; ++k) {
+      edgeStarShifts_[0][k] = getEdgeStar2dL(p1, k) - t1;
+      edgeStarShifts_[1][k] = getEdgeStar2dH(p1, k) - t1;
+    }
+
     checkAcceleration();
   } else if(dimensionality_ == 1) {
     // dimensions selectors
@@ -175,6 +225,55 @@ int ImplicitTriangulation::setInputGrid(const float &xOrigin,
   return 0;
 }
 
+size_t ImplicitTriangulation::footprint() const {
+
+  size_t size = AbstractTriangulation::footprint();
+  stringstream msg;
+
+  size += tableFootprint<char>(vertexPositions_, "vertexPositions_", &msg);
+
+  dMsg(cout, msg.str(), memoryMsg);
+
+  return size;
+}
+
+int ImplicitTriangulation::buildVertexPositions() {
+
+  if((!useVertexPositionTable_) or (dimensionality_ < 2)
+     or (!vertexPositions_.empty()))
+    return 0;
+
+  Timer t;
+
+  vertexPositions_.resize(vertexNumber_);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < vertexNumber_; ++i)
+    vertexPositions_[i] = computeVertexPosition(i);
+
+  {
+    stringstream msg;
+    msg << "[ImplicitTriangulation] Vertex positions built in "
+        << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+        << endl;
+    dMsg(cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
+int ImplicitTriangulation::preprocessVertexNeighbors() {
+  buildVertexPositions();
+  return AbstractTriangulation::preprocessVertexNeighbors();
+}
+
+int ImplicitTriangulation::preprocessVertexStars() {
+  buildVertexPositions();
+  return AbstractTriangulation::preprocessVertexStars();
+}
+
 int ImplicitTriangulation::checkAcceleration() {
   isAccelerated_ = false;
 
@@ -319,99 +418,9 @@ inline SimplexId ImplicitTriangulation::getVertexNeighborNumber(
 #endif
 
   if(dimensionality_ == 3) {
-    SimplexId p[3];
-    vertexToPosition(vertexId, p);
-
-    if(0 < p[0] and p[0] < nbvoxels_[0]) {
-      if(0 < p[1] and p[1] < nbvoxels_[1]) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 14; // abcdefgh
-        else
-          return 10; // abdc ou efhg
-      } else if(p[1] == 0) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 10; // aefb
-        else if(p[2] == 0)
-          return 8; // ab
-        else
-          return 6; // ef
-      } else {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 10; // ghdc
-        else if(p[2] == 0)
-          return 6; // cd
-        else
-          return 8; // gh
-      }
-    } else if(p[0] == 0) {
-      if(0 < p[1] and p[1] < nbvoxels_[1]) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 10; // aegc
-        else if(p[2] == 0)
-          return 6; // ac
-        else
-          return 8; // eg
-      } else if(p[1] == 0) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 6; // ae
-        else
-          return 4; // a ou e
-      } else {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 8; // cg
-        else if(p[2] == 0)
-          return 4; // c
-        else
-          return 7; // g
-      }
-    } else {
-      if(0 < p[1] and p[1] < nbvoxels_[1]) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 10; // bfhd
-        else if(p[2] == 0)
-          return 8; // bd
-        else
-          return 6; // fh
-      } else if(p[1] == 0) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 8; // bf
-        else if(p[2] == 0)
-          return 7; // b
-        else
-          return 4; // f
-      } else {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 6; // dh
-        else
-          return 4; // d ou h
-      }
-    }
+    return vertexNeighborNumbers3d[(int)getVertexPosition(vertexId)];
   } else if(dimensionality_ == 2) {
-    SimplexId p[2];
-    vertexToPosition2d(vertexId, p);
-
-    if(0 < p[0] and p[0] < nbvoxels_[Di_]) {
-      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
-        return 6; // abcd
-      else if(p[1] == 0)
-        return 4; // ab
-      else
-        return 4; // cd
-    } else if(p[0] == 0) {
-      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
-        return 4; // ac
-      else if(p[1] == 0)
-        return 2; // a
-      else
-        return 3; // c
-    } else {
-      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
-        return 4; // bd
-      else if(p[1] == 0)
-        return 3; // b
-      else
-        return 2; // d
-    }
+    return vertexNeighborNumbers2d[(int)getVertexPosition(vertexId)];
   } else if(dimensionality_ == 1) {
     if(vertexId > 0 and vertexId < nbvoxels_[Di_])
       return 2; // ab
@@ -426,115 +435,154 @@ int ImplicitTriangulation::getVertexNeighbor(const SimplexId &vertexId,
                                              const int &localNeighborId,
                                              SimplexId &neighborId) const {
 #ifndef TTK_ENABLE_KAMIKAZE
-  if(localNeighborId < 0
-     or localNeighborId >= getVertexNeighborNumber(vertexId))
+  if(vertexId < 0 or vertexId >= vertexNumber_ or localNeighborId < 0)
     return -1;
 #endif
 
   neighborId = -1;
 
   if(dimensionality_ == 3) {
-    SimplexId p[3];
-    vertexToPosition(vertexId, p);
+    // computed once, for both the check and the dispatch
+    const char position = getVertexPosition(vertexId);
+#ifndef TTK_ENABLE_KAMIKAZE
+    if(localNeighborId >= vertexNeighborNumbers3d[(int)position])
+      return -1;
+#endif
 
-    if(0 < p[0] and p[0] < nbvoxels_[0]) {
-      if(0 < p[1] and p[1] < nbvoxels_[1]) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          neighborId
-            = getVertexNeighborABCDEFGH(vertexId, localNeighborId); // abcdefgh
-        else if(p[2] == 0)
-          neighborId = getVertexNeighborABDC(vertexId, localNeighborId); // abdc
-        else
-          neighborId = getVertexNeighborEFHG(vertexId, localNeighborId); // efhg
-      } else if(p[1] == 0) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          neighborId = getVertexNeighborAEFB(vertexId, localNeighborId); // aefb
-        else if(p[2] == 0)
-          neighborId = getVertexNeighborAB(vertexId, localNeighborId); // ab
-        else
-          neighborId = getVertexNeighborEF(vertexId, localNeighborId); // ef
-      } else {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          neighborId = getVertexNeighborGHDC(vertexId, localNeighborId); // ghdc
-        else if(p[2] == 0)
-          neighborId = getVertexNeighborCD(vertexId, localNeighborId); // cd
-        else
-          neighborId = getVertexNeighborGH(vertexId, localNeighborId); // gh
-      }
-    } else if(p[0] == 0) {
-      if(0 < p[1] and p[1] < nbvoxels_[1]) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          neighborId = getVertexNeighborAEGC(vertexId, localNeighborId); // aegc
-        else if(p[2] == 0)
-          neighborId = getVertexNeighborAC(vertexId, localNeighborId); // ac
-        else
-          neighborId = getVertexNeighborEG(vertexId, localNeighborId); // eg
-      } else if(p[1] == 0) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          neighborId = getVertexNeighborAE(vertexId, localNeighborId); // ae
-        else if(p[2] == 0)
-          neighborId = getVertexNeighborA(vertexId, localNeighborId); // a
-        else
-          neighborId = getVertexNeighborE(vertexId, localNeighborId); // e
-      } else {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          neighborId = getVertexNeighborCG(vertexId, localNeighborId); // cg
-        else if(p[2] == 0)
-          neighborId = getVertexNeighborC(vertexId, localNeighborId); // c
-        else
-          neighborId = getVertexNeighborG(vertexId, localNeighborId); // g
-      }
-    } else {
-      if(0 < p[1] and p[1] < nbvoxels_[1]) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          neighborId = getVertexNeighborBFHD(vertexId, localNeighborId); // bfhd
-        else if(p[2] == 0)
-          neighborId = getVertexNeighborBD(vertexId, localNeighborId); // bd
-        else
-          neighborId = getVertexNeighborFH(vertexId, localNeighborId); // fh
-      } else if(p[1] == 0) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          neighborId = getVertexNeighborBF(vertexId, localNeighborId); // bf
-        else if(p[2] == 0)
-          neighborId = getVertexNeighborB(vertexId, localNeighborId); // b
-        else
-          neighborId = getVertexNeighborF(vertexId, localNeighborId); // f
-      } else {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          neighborId = getVertexNeighborDH(vertexId, localNeighborId); // dh
-        else if(p[2] == 0)
-          neighborId = getVertexNeighborD(vertexId, localNeighborId); // d
-        else
-          neighborId = getVertexNeighborH(vertexId, localNeighborId); // h
-      }
+    // fast path: interior vertex
+    if(position == 13) {
+      neighborId = vertexId + vertexNeighborShifts_[localNeighborId];
+      return 0;
+    }
+
+    const SimplexId &v = vertexId;
+    const int &id = localNeighborId;
+    switch(position) {
+      case 0:
+        neighborId = getVertexNeighborA(v, id); // a
+        break;
+      case 1:
+        neighborId = getVertexNeighborAB(v, id); // ab
+        break;
+      case 2:
+        neighborId = getVertexNeighborB(v, id); // b
+        break;
+      case 3:
+        neighborId = getVertexNeighborAC(v, id); // ac
+        break;
+      case 4:
+        neighborId = getVertexNeighborABDC(v, id); // abdc
+        break;
+      case 5:
+        neighborId = getVertexNeighborBD(v, id); // bd
+        break;
+      case 6:
+        neighborId = getVertexNeighborC(v, id); // c
+        break;
+      case 7:
+        neighborId = getVertexNeighborCD(v, id); // cd
+        break;
+      case 8:
+        neighborId = getVertexNeighborD(v, id); // d
+        break;
+      case 9:
+        neighborId = getVertexNeighborAE(v, id); // ae
+        break;
+      case 10:
+        neighborId = getVertexNeighborAEFB(v, id); // aefb
+        break;
+      case 11:
+        neighborId = getVertexNeighborBF(v, id); // bf
+        break;
+      case 12:
+        neighborId = getVertexNeighborAEGC(v, id); // aegc
+        break;
+      case 14:
+        neighborId = getVertexNeighborBFHD(v, id); // bfhd
+        break;
+      case 15:
+        neighborId = getVertexNeighborCG(v, id); // cg
+        break;
+      case 16:
+        neighborId = getVertexNeighborGHDC(v, id); // ghdc
+        break;
+      case 17:
+        neighborId = getVertexNeighborDH(v, id); // dh
+        break;
+      case 18:
+        neighborId = getVertexNeighborE(v, id); // e
+        break;
+      case 19:
+        neighborId = getVertexNeighborEF(v, id); // ef
+        break;
+      case 20:
+        neighborId = getVertexNeighborF(v, id); // f
+        break;
+      case 21:
+        neighborId = getVertexNeighborEG(v, id); // eg
+        break;
+      case 22:
+        neighborId = getVertexNeighborEFHG(v, id); // efhg
+        break;
+      case 23:
+        neighborId = getVertexNeighborFH(v, id); // fh
+        break;
+      case 24:
+        neighborId = getVertexNeighborG(v, id); // g
+        break;
+      case 25:
+        neighborId = getVertexNeighborGH(v, id); // gh
+        break;
+      case 26:
+        neighborId = getVertexNeighborH(v, id); // h
+        break;
     }
   } else if(dimensionality_ == 2) {
-    SimplexId p[2];
-    vertexToPosition2d(vertexId, p);
+    const char position = getVertexPosition(vertexId);
+#ifndef TTK_ENABLE_KAMIKAZE
+    if(localNeighborId >= vertexNeighborNumbers2d[(int)position])
+      return -1;
+#endif
 
-    if(0 < p[0] and p[0] < nbvoxels_[Di_]) {
-      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
-        neighborId = getVertexNeighbor2dABCD(vertexId, localNeighborId); // abcd
-      else if(p[1] == 0)
-        neighborId = getVertexNeighbor2dAB(vertexId, localNeighborId); // ab
-      else
-        neighborId = getVertexNeighbor2dCD(vertexId, localNeighborId); // cd
-    } else if(p[0] == 0) {
-      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
-        neighborId = getVertexNeighbor2dAC(vertexId, localNeighborId); // ac
-      else if(p[1] == 0)
-        neighborId = getVertexNeighbor2dA(vertexId, localNeighborId); // a
-      else
-        neighborId = getVertexNeighbor2dC(vertexId, localNeighborId); // c
-    } else {
-      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
-        neighborId = getVertexNeighbor2dBD(vertexId, localNeighborId); // bd
-      else if(p[1] == 0)
-        neighborId = getVertexNeighbor2dB(vertexId, localNeighborId); // b
-      else
-        neighborId = getVertexNeighbor2dD(vertexId, localNeighborId); // d
+    // fast path: interior vertex
+    if(position == 4) {
+      neighborId = vertexId + vertexNeighborShifts_[localNeighborId];
+      return 0;
+    }
+
+    const SimplexId &v = vertexId;
+    const int &id = localNeighborId;
+    switch(position) {
+      case 0:
+        neighborId = getVertexNeighbor2dA(v, id); // a
+        break;
+      case 1:
+        neighborId = getVertexNeighbor2dAB(v, id); // ab
+        break;
+      case 2:
+        neighborId = getVertexNeighbor2dB(v, id); // b
+        break;
+      case 3:
+        neighborId = getVertexNeighbor2dAC(v, id); // ac
+        break;
+      case 5:
+        neighborId = getVertexNeighbor2dBD(v, id); // bd
+        break;
+      case 6:
+        neighborId = getVertexNeighbor2dC(v, id); // c
+        break;
+      case 7:
+        neighborId = getVertexNeighbor2dCD(v, id); // cd
+        break;
+      case 8:
+        neighborId = getVertexNeighbor2dD(v, id); // d
+        break;
     }
   } else if(dimensionality_ == 1) {
+#ifndef TTK_ENABLE_KAMIKAZE
+    if(localNeighborId >= getVertexNeighborNumber(vertexId))
+      return -1;
+#endif
     // ab
     if(vertexId > 0 and vertexId < nbvoxels_[Di_]) {
       if(localNeighborId == 0)
@@ -1081,101 +1129,10 @@ inline SimplexId
     return -1;
 #endif
 
-  if(dimensionality_ == 3) {
-    SimplexId p[3];
-    vertexToPosition(vertexId, p);
-
-    if(0 < p[0] and p[0] < nbvoxels_[0]) {
-      if(0 < p[1] and p[1] < nbvoxels_[1]) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 24; // abcdefgh
-        else
-          return 12; // abdc ou efhg
-      } else if(p[1] == 0) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 12; // aefb
-        else if(p[2] == 0)
-          return 8; // ab
-        else
-          return 4; // ef
-      } else {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 12; // ghdc
-        else if(p[2] == 0)
-          return 4; // cd
-        else
-          return 8; // gh
-      }
-    } else if(p[0] == 0) {
-      if(0 < p[1] and p[1] < nbvoxels_[1]) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 12; // aegc
-        else if(p[2] == 0)
-          return 4; // ac
-        else
-          return 8; // eg
-      } else if(p[1] == 0) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 4; // ae
-        else
-          return 2; // a ou e
-      } else {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 8; // cg
-        else if(p[2] == 0)
-          return 2; // c
-        else
-          return 6; // g
-      }
-    } else {
-      if(0 < p[1] and p[1] < nbvoxels_[1]) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 12; // bfhd
-        else if(p[2] == 0)
-          return 8; // bd
-        else
-          return 4; // fh
-      } else if(p[1] == 0) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 8; // bf
-        else if(p[2] == 0)
-          return 6; // b
-        else
-          return 2; // f
-      } else {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          return 4; // dh
-        else
-          return 2; // d ou h
-      }
-    }
-  } else if(dimensionality_ == 2) {
-    SimplexId p[2];
-    vertexToPosition2d(vertexId, p);
-
-    if(0 < p[0] and p[0] < nbvoxels_[Di_]) {
-      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
-        return 6; // abcd
-      else if(p[1] == 0)
-        return 3; // ab
-      else
-        return 3; // cd
-    } else if(p[0] == 0) {
-      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
-        return 3; // ac
-      else if(p[1] == 0)
-        return 1; // a
-      else
-        return 2; // c
-    } else {
-      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
-        return 3; // bd
-      else if(p[1] == 0)
-        return 2; // b
-      else
-        return 1; // d
-    }
-  }
+  if(dimensionality_ == 3)
+    return vertexStarNumbers3d[(int)getVertexPosition(vertexId)];
+  else if(dimensionality_ == 2)
+    return vertexStarNumbers2d[(int)getVertexPosition(vertexId)];
 
   return 0;
 }
@@ -1184,113 +1141,157 @@ int ImplicitTriangulation::getVertexStar(const SimplexId &vertexId,
                                          const int &localStarId,
                                          SimplexId &starId) const {
 #ifndef TTK_ENABLE_KAMIKAZE
-  if(localStarId < 0 or localStarId >= getVertexStarNumber(vertexId))
+  if(vertexId < 0 or vertexId >= vertexNumber_ or localStarId < 0)
     return -1;
 #endif
 
   starId = -1;
 
   if(dimensionality_ == 3) {
+    // the position class is derived from the vertex coordinates
     SimplexId p[3];
     vertexToPosition(vertexId, p);
+    const char position = getVertexPosition(vertexId, p);
+#ifndef TTK_ENABLE_KAMIKAZE
+    if(localStarId >= vertexStarNumbers3d[(int)position])
+      return -1;
+#endif
 
-    if(0 < p[0] and p[0] < nbvoxels_[0]) {
-      if(0 < p[1] and p[1] < nbvoxels_[1]) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          starId = getVertexStarABCDEFGH(p, localStarId); // abcdefgh
-        else if(p[2] == 0)
-          starId = getVertexStarABDC(p, localStarId); // abdc
-        else
-          starId = getVertexStarEFHG(p, localStarId); // efhg
-      } else if(p[1] == 0) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          starId = getVertexStarAEFB(p, localStarId); // aefb
-        else if(p[2] == 0)
-          starId = getVertexStarAB(p, localStarId); // ab
-        else
-          starId = getVertexStarEF(p, localStarId); // ef
-      } else {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          starId = getVertexStarGHDC(p, localStarId); // ghdc
-        else if(p[2] == 0)
-          starId = getVertexStarCD(p, localStarId); // cd
-        else
-          starId = getVertexStarGH(p, localStarId); // gh
-      }
-    } else if(p[0] == 0) {
-      if(0 < p[1] and p[1] < nbvoxels_[1]) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          starId = getVertexStarAEGC(p, localStarId); // aegc
-        else if(p[2] == 0)
-          starId = getVertexStarAC(p, localStarId); // ac
-        else
-          starId = getVertexStarEG(p, localStarId); // eg
-      } else if(p[1] == 0) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          starId = getVertexStarAE(p, localStarId); // ae
-        else if(p[2] == 0)
-          starId = getVertexStarA(p, localStarId); // a
-        else
-          starId = getVertexStarE(p, localStarId); // e
-      } else {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          starId = getVertexStarCG(p, localStarId); // cg
-        else if(p[2] == 0)
-          starId = getVertexStarC(p, localStarId); // c
-        else
-          starId = getVertexStarG(p, localStarId); // g
-      }
-    } else {
-      if(0 < p[1] and p[1] < nbvoxels_[1]) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          starId = getVertexStarBFHD(p, localStarId); // bfhd
-        else if(p[2] == 0)
-          starId = getVertexStarBD(p, localStarId); // bd
-        else
-          starId = getVertexStarFH(p, localStarId); // fh
-      } else if(p[1] == 0) {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          starId = getVertexStarBF(p, localStarId); // bf
-        else if(p[2] == 0)
-          starId = getVertexStarB(p, localStarId); // b
-        else
-          starId = getVertexStarF(p, localStarId); // f
-      } else {
-        if(0 < p[2] and p[2] < nbvoxels_[2])
-          starId = getVertexStarDH(p, localStarId); // dh
-        else if(p[2] == 0)
-          starId = getVertexStarD(p, localStarId); // d
-        else
-          starId = getVertexStarH(p, localStarId); // h
-      }
+    // fast path: interior vertex
+    if(position == 13) {
+      starId = p[0] * 6 + p[1] * tetshift_[0] + p[2] * tetshift_[1]
+               + vertexStarShifts_[localStarId];
+      return 0;
+    }
+
+    const int &id = localStarId;
+    switch(position) {
+      case 0:
+        starId = getVertexStarA(p, id); // a
+        break;
+      case 1:
+        starId = getVertexStarAB(p, id); // ab
+        break;
+      case 2:
+        starId = getVertexStarB(p, id); // b
+        break;
+      case 3:
+        starId = getVertexStarAC(p, id); // ac
+        break;
+      case 4:
+        starId = getVertexStarABDC(p, id); // abdc
+        break;
+      case 5:
+        starId = getVertexStarBD(p, id); // bd
+        break;
+      case 6:
+        starId = getVertexStarC(p, id); // c
+        break;
+      case 7:
+        starId = getVertexStarCD(p, id); // cd
+        break;
+      case 8:
+        starId = getVertexStarD(p, id); // d
+        break;
+      case 9:
+        starId = getVertexStarAE(p, id); // ae
+        break;
+      case 10:
+        starId = getVertexStarAEFB(p, id); // aefb
+        break;
+      case 11:
+        starId = getVertexStarBF(p, id); // bf
+        break;
+      case 12:
+        starId = getVertexStarAEGC(p, id); // aegc
+        break;
+      case 14:
+        starId = getVertexStarBFHD(p, id); // bfhd
+        break;
+      case 15:
+        starId = getVertexStarCG(p, id); // cg
+        break;
+      case 16:
+        starId = getVertexStarGHDC(p, id); // ghdc
+        break;
+      case 17:
+        starId = getVertexStarDH(p, id); // dh
+        break;
+      case 18:
+        starId = getVertexStarE(p, id); // e
+        break;
+      case 19:
+        starId = getVertexStarEF(p, id); // ef
+        break;
+      case 20:
+        starId = getVertexStarF(p, id); // f
+        break;
+      case 21:
+        starId = getVertexStarEG(p, id); // eg
+        break;
+      case 22:
+        starId = getVertexStarEFHG(p, id); // efhg
+        break;
+      case 23:
+        starId = getVertexStarFH(p, id); // fh
+        break;
+      case 24:
+        starId = getVertexStarG(p, id); // g
+        break;
+      case 25:
+        starId = getVertexStarGH(p, id); // gh
+        break;
+      case 26:
+        starId = getVertexStarH(p, id); // h
+        break;
     }
   } else if(dimensionality_ == 2) {
     SimplexId p[2];
     vertexToPosition2d(vertexId, p);
+    const char position = getVertexPosition2d(vertexId, p);
+#ifndef TTK_ENABLE_KAMIKAZE
+    if(localStarId >= vertexStarNumbers2d[(int)position])
+      return -1;
+#endif
 
-    if(0 < p[0] and p[0] < nbvoxels_[Di_]) {
-      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
-        starId = getVertexStar2dABCD(p, localStarId); // abcd
-      else if(p[1] == 0)
-        starId = getVertexStar2dAB(p, localStarId); // ab
-      else
-        starId = getVertexStar2dCD(p, localStarId); // cd
-    } else if(p[0] == 0) {
-      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
-        starId = getVertexStar2dAC(p, localStarId); // ac
-      else if(p[1] == 0)
-        starId = getVertexStar2dA(p, localStarId); // a
-      else
-        starId = getVertexStar2dC(p, localStarId); // c
-    } else {
-      if(0 < p[1] and p[1] < nbvoxels_[Dj_])
-        starId = getVertexStar2dBD(p, localStarId); // bd
-      else if(p[1] == 0)
-        starId = getVertexStar2dB(p, localStarId); // b
-      else
-        starId = getVertexStar2dD(p, localStarId); // d
+    // fast path: interior vertex
+    if(position == 4) {
+      starId = p[0] * 2 + p[1] * tshift_[0] + vertexStarShifts_[localStarId];
+      return 0;
+    }
+
+    const int &id = localStarId;
+    switch(position) {
+      case 0:
+        starId = getVertexStar2dA(p, id); // a
+        break;
+      case 1:
+        starId = getVertexStar2dAB(p, id); // ab
+        break;
+      case 2:
+        starId = getVertexStar2dB(p, id); // b
+        break;
+      case 3:
+        starId = getVertexStar2dAC(p, id); // ac
+        break;
+      case 5:
+        starId = getVertexStar2dBD(p, id); // bd
+        break;
+      case 6:
+        starId = getVertexStar2dC(p, id); // c
+        break;
+      case 7:
+        starId = getVertexStar2dCD(p, id); // cd
+        break;
+      case 8:
+        starId = getVertexStar2dD(p, id); // d
+        break;
     }
   }
+#ifndef TTK_ENABLE_KAMIKAZE
+  else
+    return -1;
+#endif
 
   return 0;
 }
@@ -2175,47 +2176,84 @@ int ImplicitTriangulation::getEdgeStar(const SimplexId &edgeId,
 
   if(dimensionality_ == 3) {
     SimplexId p[3];
+    const int &id = localStarId;
 
+    // fast paths: interior edges (their star is made of the tetrahedra
+    // around them, at constant offsets)
     if(edgeId < esetshift_[0]) {
       edgeToPosition(edgeId, 0, p);
-      starId = getEdgeStarL(p, localStarId); // L
+      if(p[1] > 0 and p[1] < nbvoxels_[1] and p[2] > 0
+         and p[2] < nbvoxels_[2])
+        starId = p[0] * 6 + p[1] * tetshift_[0] + p[2] * tetshift_[1]
+                 + edgeStarShifts_[0][id];
+      else
+        starId = getEdgeStarL(p, id); // L
     } else if(edgeId < esetshift_[1]) {
       edgeToPosition(edgeId, 1, p);
-      starId = getEdgeStarH(p, localStarId); // H
+      if(p[0] > 0 and p[0] < nbvoxels_[0] and p[2] > 0
+         and p[2] < nbvoxels_[2])
+        starId = p[0] * 6 + p[1] * tetshift_[0] + p[2] * tetshift_[1]
+                 + edgeStarShifts_[1][id];
+      else
+        starId = getEdgeStarH(p, id); // H
     } else if(edgeId < esetshift_[2]) {
       edgeToPosition(edgeId, 2, p);
-      starId = getEdgeStarP(p, localStarId); // P
+      if(p[0] > 0 and p[0] < nbvoxels_[0] and p[1] > 0
+         and p[1] < nbvoxels_[1])
+        starId = p[0] * 6 + p[1] * tetshift_[0] + p[2] * tetshift_[1]
+                 + edgeStarShifts_[2][id];
+      else
+        starId = getEdgeStarP(p, id); // P
     } else if(edgeId < esetshift_[3]) {
       edgeToPosition(edgeId, 3, p);
-      starId = getEdgeStarD1(p, localStarId); // D1
+      if(p[2] > 0 and p[2] < nbvoxels_[2])
+        starId = p[0] * 6 + p[1] * tetshift_[0] + p[2] * tetshift_[1]
+                 + edgeStarShifts_[3][id];
+      else
+        starId = getEdgeStarD1(p, id); // D1
     } else if(edgeId < esetshift_[4]) {
       edgeToPosition(edgeId, 4, p);
-      starId = getEdgeStarD2(p, localStarId); // D2
+      if(p[0] > 0 and p[0] < nbvoxels_[0])
+        starId = p[0] * 6 + p[1] * tetshift_[0] + p[2] * tetshift_[1]
+                 + edgeStarShifts_[4][id];
+      else
+        starId = getEdgeStarD2(p, id); // D2
     } else if(edgeId < esetshift_[5]) {
       edgeToPosition(edgeId, 5, p);
-      starId = getEdgeStarD3(p, localStarId); // D3
+      if(p[1] > 0 and p[1] < nbvoxels_[1])
+        starId = p[0] * 6 + p[1] * tetshift_[0] + p[2] * tetshift_[1]
+                 + edgeStarShifts_[5][id];
+      else
+        starId = getEdgeStarD3(p, id); // D3
     } else if(edgeId < esetshift_[6]) {
       edgeToPosition(edgeId, 6, p);
       starId = p[2] * tetshift_[1] + p[1] * tetshift_[0] + p[0] * 6
-               + localStarId; // D4
+               + id; // D4
     }
   } else if(dimensionality_ == 2) {
     SimplexId p[2];
+    const int &id = localStarId;
 
     // L
     if(edgeId < esetshift_[0]) {
       edgeToPosition2d(edgeId, 0, p);
-      starId = getEdgeStar2dL(p, localStarId); // L
+      if(p[1] > 0 and p[1] < nbvoxels_[Dj_])
+        starId = p[0] * 2 + p[1] * tshift_[0] + edgeStarShifts_[0][id];
+      else
+        starId = getEdgeStar2dL(p, id); // L
     }
     // H
     else if(edgeId < esetshift_[1]) {
       edgeToPosition2d(edgeId, 1, p);
-      starId = getEdgeStar2dH(p, localStarId); // L
+      if(p[0] > 0 and p[0] < nbvoxels_[Di_])
+        starId = p[0] * 2 + p[1] * tshift_[0] + edgeStarShifts_[1][id];
+      else
+        starId = getEdgeStar2dH(p, id); // H
     }
     // D1
     else if(edgeId < esetshift_[2]) {
       edgeToPosition2d(edgeId, 2, p);
-      starId = p[0] * 2 + p[1] * tshift_[0] + localStarId; // D1
+      starId = p[0] * 2 + p[1] * tshift_[0] + id; // D1
     }
   }
 
@@ -26,6 +26,8 @@ namespace ttk {
     ImplicitTriangulation();
     ~ImplicitTriangulation();
 
+    size_t footprint() const override;
+
     int getCellEdge(const SimplexId &cellId,
                     const int &id,
                     SimplexId &edgeId) const override;
@@ -235,6 +237,10 @@ namespace ttk {
 
     bool isVertexOnBoundary(const SimplexId &vertexId) const override;
 
+    int preprocessVertexNeighbors() override;
+
+    int preprocessVertexStars() override;
+
     int setInputGrid(const float &xOrigin,
                      const float &yOrigin,
                      const float &zOrigin,
@@ -245,6 +251,18 @@ namespace ttk {
                      const SimplexId &yDim,
                      const SimplexId &zDim);
 
+    /// Store the position class of each vertex (one byte per vertex, built
+    /// by preprocessVertexNeighbors() and preprocessVertexStars()) instead
+    /// of computing it on each vertex neighbor or star query (default).
+    /// \note The stored classes save the integer divisions of the vertex
+    /// coordinates in the neighbor queries, at the price of the otherwise
+    /// negligible memory footprint of the grid.
+    inline void setVertexPositionTable(const bool &useVertexPositionTable) {
+      useVertexPositionTable_ = useVertexPositionTable;
+      if(!useVertexPositionTable_)
+        std::vector<char>().swap(vertexPositions_);
+    }
+
   protected:
     int dimensionality_; //
     float origin_[3]; //
@@ -287,6 +305,26 @@ namespace ttk {
     int checkAcceleration();
     bool isPowerOfTwo(unsigned long long int v, unsigned long long int &r);
 
+    // vertex position classes (see getVertexPosition()), optional
+    bool useVertexPositionTable_;
+    std::vector<char> vertexPositions_;
+    // offsets of the neighbors and of the star of an interior vertex
+    SimplexId vertexNeighborShifts_[14];
+    SimplexId vertexStarShifts_[24];
+    // offsets of the star of an interior edge, per edge type
+    SimplexId edgeStarShifts_[6][6];
+
+    int buildVertexPositions();
+    // position of a vertex with regard to the boundary of the grid, encoded
+    // as cx + 3 * cy + 9 * cz where ck is 0 on the lower boundary of the k-th
+    // axis, 2 on its upper boundary and 1 in between (13 for interior
+    // vertices in 3D, 4 in 2D)
+    char getVertexPosition(const SimplexId v) const;
+    char computeVertexPosition(const SimplexId v) const;
+    // same from the coordinates of the vertex
+    char getVertexPosition(const SimplexId v, const SimplexId p[3]) const;
+    char getVertexPosition2d(const SimplexId v, const SimplexId p[2]) const;
+
     //\cond
     // 2D //
     void vertexToPosition2d(const SimplexId vertex, SimplexId p[2]) const;
@@ -1355,6 +1393,45 @@ inline void ttk::ImplicitTriangulation::vertexToPosition(const SimplexId vertex,
   }
 }
 
+inline char ttk::ImplicitTriangulation::getVertexPosition(
+  const SimplexId v, const SimplexId p[3]) const {
+  if(!vertexPositions_.empty())
+    return vertexPositions_[v];
+  return (p[0] > 0) + (p[0] == nbvoxels_[0])
+         + 3 * ((p[1] > 0) + (p[1] == nbvoxels_[1]))
+         + 9 * ((p[2] > 0) + (p[2] == nbvoxels_[2]));
+}
+
+inline char ttk::ImplicitTriangulation::getVertexPosition2d(
+  const SimplexId v, const SimplexId p[2]) const {
+  if(!vertexPositions_.empty())
+    return vertexPositions_[v];
+  return (p[0] > 0) + (p[0] == nbvoxels_[Di_])
+         + 3 * ((p[1] > 0) + (p[1] == nbvoxels_[Dj_]));
+}
+
+inline char
+  ttk::ImplicitTriangulation::computeVertexPosition(const SimplexId v) const {
+  if(dimensionality_ == 3) {
+    SimplexId p[3];
+    vertexToPosition(v, p);
+    return (p[0] > 0) + (p[0] == nbvoxels_[0])
+           + 3 * ((p[1] > 0) + (p[1] == nbvoxels_[1]))
+           + 9 * ((p[2] > 0) + (p[2] == nbvoxels_[2]));
+  }
+  SimplexId p[2];
+  vertexToPosition2d(v, p);
+  return (p[0] > 0) + (p[0] == nbvoxels_[Di_])
+         + 3 * ((p[1] > 0) + (p[1] == nbvoxels_[Dj_]));
+}
+
+inline char
+  ttk::ImplicitTriangulation::getVertexPosition(const SimplexId v) const {
+  if(vertexPositions_.empty())
+    return computeVertexPosition(v);
+  return vertexPositions_[v];
+}
+
 inline void ttk::ImplicitTriangulation::edgeToPosition(const SimplexId edge,
                                                        const int k,
                                                        SimplexId p[3]) const {
@@ -5,7 +5,9 @@ using namespace ttk;
 
 IntegralLines::IntegralLines()
   : vertexNumber_{}, seedNumber_{}, triangulation_{}, inputScalarField_{},
-    inputOffsets_{}, vertexIdentifierScalarField_{}, outputTrajectories_{} {
+    inputOffsets_{}, vertexIdentifierScalarField_{},
+    stopAtTracedVertices_{false}, outputTrajectories_{},
+    outputFlatTrajectories_{} {
 }
 
 IntegralLines::~IntegralLines() {
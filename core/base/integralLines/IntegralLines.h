@@ -9,18 +9,24 @@
 /// Given a list of sources, the package produces forward or backward integral
 /// lines along the edges of the input triangulation.
 ///
+/// The seeds are traced in parallel and the lines are gathered into a single
+/// pooled buffer (see setOutputTrajectories()). Optionally, a line can stop
+/// as soon as it reaches a vertex already visited by another line, hence
+/// merging into it (see setStopAtTracedVertices()).
+///
 /// \sa ttkIntegralLines.cpp %for a usage example.
 
 #ifndef _DISCRETESTREAMLINE_H
 #define _DISCRETESTREAMLINE_H
 
 // base code includes
+#include <FlatJaggedArray.h>
 #include <Geometry.h>
 #include <Triangulation.h>
 #include <Wrapper.h>
 
 // std includes
-#include <unordered_set>
+#include <limits>
 
 namespace ttk {
   enum Direction { Forward = 0, Backward };
@@ -44,10 +50,18 @@ namespace ttk {
     template <typename dataType>
     inline float getGradient(const SimplexId &a,
                              const SimplexId &b,
-                             dataType *scalars) const {
+                             const dataType *scalars) const {
       return fabs(scalars[b] - scalars[a]) / getDistance<dataType>(a, b);
     }
 
+    /// Vertex following \p v along the integral line (steepest edge, with
+    /// the offsets breaking the ties on flat regions), -1 if \p v is an
+    /// extremum in the current direction.
+    template <typename dataType, typename idType>
+    inline SimplexId getNextVertex(const SimplexId &v,
+                                   const dataType *scalars,
+                                   const idType *offsets) const;
+
     template <typename dataType, typename idType>
     int execute() const;
 
@@ -98,6 +112,22 @@ namespace ttk {
       return 0;
     }
 
+    /// Pooled output: the i-th entry lists the vertices of the line traced
+    /// from the i-th (deduplicated) seed.
+    inline int setOutputTrajectories(FlatJaggedArray *trajectories) {
+      outputFlatTrajectories_ = trajectories;
+      return 0;
+    }
+
+    /// Stop a line at the first vertex already visited by another line
+    /// (this vertex is kept, so the line merges into the other one).
+    /// When several threads are used, which of two converging lines is cut
+    /// depends on the scheduling, but the union of the lines does not.
+    inline int setStopAtTracedVertices(bool onOff) {
+      stopAtTracedVertices_ = onOff;
+      return 0;
+    }
+
   protected:
     SimplexId vertexNumber_;
     SimplexId seedNumber_;
@@ -106,178 +136,178 @@ namespace ttk {
     void *inputScalarField_;
     void *inputOffsets_;
     void *vertexIdentifierScalarField_;
+    bool stopAtTracedVertices_;
     std::vector<std::vector<SimplexId>> *outputTrajectories_;
+    FlatJaggedArray *outputFlatTrajectories_;
   };
 } // namespace ttk
 
 template <typename dataType, typename idType>
-int ttk::IntegralLines::execute() const {
-  idType *offsets = static_cast<idType *>(inputOffsets_);
-  SimplexId *identifiers
-    = static_cast<SimplexId *>(vertexIdentifierScalarField_);
-  dataType *scalars = static_cast<dataType *>(inputScalarField_);
-  std::vector<std::vector<SimplexId>> *trajectories = outputTrajectories_;
-
-  Timer t;
-
-  // get the seeds
-  std::unordered_set<SimplexId> isSeed;
-  for(SimplexId k = 0; k < seedNumber_; ++k)
-    isSeed.insert(identifiers[k]);
-  std::vector<SimplexId> seeds;
-  for(auto k : isSeed)
-    seeds.push_back(k);
-  isSeed.clear();
+inline ttk::SimplexId
+  ttk::IntegralLines::getNextVertex(const SimplexId &v,
+                                    const dataType *scalars,
+                                    const idType *offsets) const {
+  const bool isForward = (direction_ == static_cast<int>(Direction::Forward));
+
+  SimplexId vnext{-1};
+  float fnext = std::numeric_limits<float>::min();
+  SimplexId neighborNumber = triangulation_->getVertexNeighborNumber(v);
+  bool isLocalMax = true;
+  bool isLocalMin = true;
+  for(SimplexId k = 0; k < neighborNumber; ++k) {
+    SimplexId n;
+    triangulation_->getVertexNeighbor(v, k, n);
+
+    if(scalars[n] <= scalars[v])
+      isLocalMax = false;
+    if(scalars[n] >= scalars[v])
+      isLocalMin = false;
+
+    if(isForward xor (scalars[n] < scalars[v])) {
+      const float f = getGradient<dataType>(v, n, scalars);
+      if(f > fnext) {
+        vnext = n;
+        fnext = f;
+      }
+    }
+  }
 
-  trajectories->resize(seeds.size());
-  for(SimplexId i = 0; i < (SimplexId)seeds.size(); ++i) {
-    SimplexId v{seeds[i]};
-    (*trajectories)[i].push_back(v);
+  if(vnext == -1 and !isLocalMax and !isLocalMin) {
+    idType onext = -1;
+    for(SimplexId k = 0; k < neighborNumber; ++k) {
+      SimplexId n;
+      triangulation_->getVertexNeighbor(v, k, n);
 
-    bool isMax{};
-    while(!isMax) {
-      SimplexId vnext{-1};
-      float fnext = std::numeric_limits<float>::min();
-      SimplexId neighborNumber = triangulation_->getVertexNeighborNumber(v);
-      bool isLocalMax = true;
-      bool isLocalMin = true;
-      for(SimplexId k = 0; k < neighborNumber; ++k) {
-        SimplexId n;
-        triangulation_->getVertexNeighbor(v, k, n);
-
-        if(scalars[n] <= scalars[v])
-          isLocalMax = false;
-        if(scalars[n] >= scalars[v])
-          isLocalMin = false;
-
-        if((direction_ == static_cast<int>(Direction::Forward))
-           xor (scalars[n] < scalars[v])) {
-          const float f = getGradient<dataType>(v, n, scalars);
-          if(f > fnext) {
+      if(scalars[n] == scalars[v]) {
+        const idType o = offsets[n];
+        if(isForward xor (o < offsets[v])) {
+          if(o > onext) {
             vnext = n;
-            fnext = f;
-          }
-        }
-      }
-
-      if(vnext == -1 and !isLocalMax and !isLocalMin) {
-        idType onext = -1;
-        for(SimplexId k = 0; k < neighborNumber; ++k) {
-          SimplexId n;
-          triangulation_->getVertexNeighbor(v, k, n);
-
-          if(scalars[n] == scalars[v]) {
-            const idType o = offsets[n];
-            if((direction_ == static_cast<int>(Direction::Forward))
-               xor (o < offsets[v])) {
-              if(o > onext) {
-                vnext = n;
-                onext = o;
-              }
-            }
+            onext = o;
           }
         }
       }
-
-      if(vnext == -1)
-        isMax = true;
-      else {
-        v = vnext;
-        (*trajectories)[i].push_back(v);
-      }
     }
   }
 
-  {
-    std::stringstream msg;
-    msg << "[IntegralLines] Data-set (" << vertexNumber_
-        << " points) processed in " << t.getElapsedTime() << " s. ("
-        << threadNumber_ << " thread(s))." << std::endl;
-    dMsg(std::cout, msg.str(), timeMsg);
-  }
+  return vnext;
+}
 
-  return 0;
+template <typename dataType, typename idType>
+int ttk::IntegralLines::execute() const {
+  return execute<dataType, idType>([](const SimplexId &) { return false; });
 }
 
 template <typename dataType, typename idType, class Compare>
 int ttk::IntegralLines::execute(Compare cmp) const {
-  idType *offsets = static_cast<idType *>(inputOffsets_);
-  SimplexId *identifiers
-    = static_cast<SimplexId *>(vertexIdentifierScalarField_);
-  dataType *scalars = static_cast<dataType *>(inputScalarField_);
-  std::vector<std::vector<SimplexId>> *trajectories = outputTrajectories_;
+  const idType *offsets = static_cast<const idType *>(inputOffsets_);
+  const SimplexId *identifiers
+    = static_cast<const SimplexId *>(vertexIdentifierScalarField_);
+  const dataType *scalars = static_cast<const dataType *>(inputScalarField_);
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!triangulation_ or !offsets or !identifiers or !scalars)
+    return -1;
+  if(!outputTrajectories_ and !outputFlatTrajectories_)
+    return -2;
+#endif
 
   Timer t;
 
-  // get the seeds
-  std::unordered_set<SimplexId> isSeed;
-  for(SimplexId k = 0; k < seedNumber_; ++k)
-    isSeed.insert(identifiers[k]);
+  // get the seeds (duplicates removed, input order kept)
   std::vector<SimplexId> seeds;
-  for(auto k : isSeed)
-    seeds.push_back(k);
-  isSeed.clear();
+  {
+    std::vector<char> isSeed(vertexNumber_, 0);
+    for(SimplexId k = 0; k < seedNumber_; ++k) {
+      const SimplexId s = identifiers[k];
+      if(!isSeed[s]) {
+        isSeed[s] = 1;
+        seeds.push_back(s);
+      }
+    }
+  }
+  const SimplexId lineNumber = seeds.size();
+
+  // vertices already reached by a line (stopAtTracedVertices_ only)
+  std::vector<char> isTraced;
+  if(stopAtTracedVertices_)
+    isTraced.resize(vertexNumber_, 0);
+  const auto markTraced = [&isTraced](const SimplexId &v) {
+    char wasTraced;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic capture
+#endif
+    {
+      wasTraced = isTraced[v];
+      isTraced[v] = 1;
+    }
+    return wasTraced;
+  };
+
+  // each thread appends its lines to its own pool, lineStart/lineThread
+  // locate them for the final gathering
+  std::vector<std::vector<SimplexId>> pools(threadNumber_);
+  std::vector<SimplexId> lineStart(lineNumber);
+  std::vector<ThreadId> lineThread(lineNumber);
+  std::vector<SimplexId> lineOffsets(lineNumber + 1, 0);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic, 64)
+#endif
+  for(SimplexId i = 0; i < lineNumber; ++i) {
+    ThreadId threadId = 0;
+#ifdef TTK_ENABLE_OPENMP
+    threadId = omp_get_thread_num();
+#endif
+    std::vector<SimplexId> &pool = pools[threadId];
+    lineThread[i] = threadId;
+    lineStart[i] = pool.size();
 
-  trajectories->resize(seeds.size());
-  for(SimplexId i = 0; i < (SimplexId)seeds.size(); ++i) {
     SimplexId v{seeds[i]};
-    (*trajectories)[i].push_back(v);
+    pool.push_back(v);
 
-    bool isMax{};
+    bool isMax = stopAtTracedVertices_ and markTraced(v);
     while(!isMax) {
-      SimplexId vnext{-1};
-      float fnext = std::numeric_limits<float>::min();
-      SimplexId neighborNumber = triangulation_->getVertexNeighborNumber(v);
-      bool isLocalMax = true;
-      bool isLocalMin = true;
-      for(SimplexId k = 0; k < neighborNumber; ++k) {
-        SimplexId n;
-        triangulation_->getVertexNeighbor(v, k, n);
-
-        if(scalars[n] <= scalars[v])
-          isLocalMax = false;
-        if(scalars[n] >= scalars[v])
-          isLocalMin = false;
-
-        if((direction_ == static_cast<int>(Direction::Forward))
-           xor (scalars[n] < scalars[v])) {
-          const float f = getGradient<dataType>(v, n, scalars);
-          if(f > fnext) {
-            vnext = n;
-            fnext = f;
-          }
-        }
-      }
-
-      if(vnext == -1 and !isLocalMax and !isLocalMin) {
-        SimplexId onext = -1;
-        for(SimplexId k = 0; k < neighborNumber; ++k) {
-          SimplexId n;
-          triangulation_->getVertexNeighbor(v, k, n);
-
-          if(scalars[n] == scalars[v]) {
-            const SimplexId o = offsets[n];
-            if((direction_ == static_cast<int>(Direction::Forward))
-               xor (o < offsets[v])) {
-              if(o > onext) {
-                vnext = n;
-                onext = o;
-              }
-            }
-          }
-        }
-      }
+      const SimplexId vnext
+        = getNextVertex<dataType, idType>(v, scalars, offsets);
 
       if(vnext == -1)
         isMax = true;
       else {
         v = vnext;
-        (*trajectories)[i].push_back(v);
+        pool.push_back(v);
 
-        if(cmp(v))
+        if(cmp(v) or (stopAtTracedVertices_ and markTraced(v)))
           isMax = true;
       }
     }
+
+    lineOffsets[i] = pool.size() - lineStart[i];
+  }
+
+  // gather the lines into a single pooled buffer
+  std::vector<SimplexId> lineData(
+    FlatJaggedArray::countsToOffsets(lineOffsets));
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < lineNumber; ++i) {
+    const SimplexId *line = pools[lineThread[i]].data() + lineStart[i];
+    std::copy(line, line + lineOffsets[i + 1] - lineOffsets[i],
+              lineData.begin() + lineOffsets[i]);
+  }
+  pools.clear();
+
+  if(outputFlatTrajectories_) {
+    outputFlatTrajectories_->setData(
+      std::move(lineOffsets), std::move(lineData));
+    if(outputTrajectories_)
+      outputFlatTrajectories_->copyTo(*outputTrajectories_);
+  } else {
+    FlatJaggedArray trajectories;
+    trajectories.setData(std::move(lineOffsets), std::move(lineData));
+    trajectories.copyTo(*outputTrajectories_);
   }
 
   {
@@ -288,6 +318,12 @@ int ttk::IntegralLines::execute(Compare cmp) const {
     dMsg(std::cout, msg.str(), timeMsg);
   }
 
+  {
+    std::stringstream msg;
+    msg << "[IntegralLines] " << lineNumber << " line(s) traced." << std::endl;
+    dMsg(std::cout, msg.str(), detailedInfoMsg);
+  }
+
   return 0;
 }
 
@@ -5,6 +5,11 @@
 ///
 /// \brief TTK KD-Tree
 ///
+/// The nodes of a tree are allocated in one contiguous array in depth-first
+/// order. Their coordinates, bounding boxes and weights are stored in
+/// structure-of-arrays form in this same arena, owned by the root. Weights
+/// can be updated in place through the node pointers returned by build().
+///
 
 #pragma once
 
@@ -17,6 +22,7 @@
 #include <cmath>
 #include <iostream>
 #include <limits>
+#include <vector>
 
 namespace ttk {
   template <typename dataType>
@@ -28,53 +34,33 @@ namespace ttk {
     KDTree *parent_;
     int id_; // ID of the object saved here. The whole object is not kept in the
              // KDTree Users should keep track of them in a table for instance
-    std::vector<dataType> coordinates_;
-    std::vector<dataType> coords_min_;
-    std::vector<dataType> coords_max_;
     int level_;
 
-    std::vector<dataType> weight_;
-    std::vector<dataType> min_subweights_;
-
     KDTree() {
       left_ = nullptr;
       right_ = nullptr;
       parent_ = nullptr;
+      id_ = -1;
+      level_ = 0;
 
       coords_number_ = 0;
       p_ = 2;
       include_weights_ = false;
+      is_left_ = false;
+      index_ = 0;
+      arena_ = nullptr;
     }
 
-    KDTree(bool include_weights, int p) {
-      left_ = nullptr;
-      right_ = nullptr;
-      parent_ = nullptr;
-
-      coords_number_ = 0;
+    KDTree(bool include_weights, int p) : KDTree() {
       p_ = p;
       include_weights_ = include_weights;
     }
 
-    KDTree(KDTree *father, int coords_number, bool is_left) {
-      left_ = nullptr;
-      right_ = nullptr;
-      parent_ = father;
-
-      coords_number_ = coords_number;
-      p_ = father->p_;
-      include_weights_ = father->include_weights_;
-      is_left_ = is_left;
-    }
-
     ~KDTree() {
-      delete left_;
-      delete right_;
-      // coordinates_.resize(0);
-      // coords_min_.resize(0);
-      // coords_max_.resize(0);
-      // weight_.resize(0);
-      // min_subweights_.resize(0);
+      // the root owns the nodes and their data
+      if(arena_ && this->isRoot()) {
+        delete arena_;
+      }
     }
 
     std::vector<KDTree<dataType> *> build(dataType *coordinates,
@@ -88,22 +74,6 @@ namespace ttk {
             std::vector<std::vector<dataType>> &weights,
             const int weight_number = 1);
 
-    void buildRecursive(dataType *coordinates,
-                        std::vector<int> indexes,
-                        const int &ptNumber,
-                        const int &dimension,
-                        KDTree<dataType> *parent,
-                        std::vector<KDTree<dataType> *> &correspondance_map,
-                        std::vector<std::vector<dataType>> &weights,
-                        const int weight_number = 1);
-    void buildRecursive(dataType *coordinates,
-                        std::vector<int> indexes,
-                        const int &ptNumber,
-                        const int &dimension,
-                        KDTree<dataType> *parent,
-                        std::vector<KDTree<dataType> *> &correspondance_map,
-                        const int weight_number = 1);
-
     void updateWeight(dataType new_weight, const int weight_index = 0);
     void updateMinSubweight(const int weight_index = 0);
     void getKClosest(const unsigned int k,
@@ -133,6 +103,66 @@ namespace ttk {
     }
 
   protected:
+    // Storage of a whole tree, allocated by the root
+    struct Arena {
+      int nodeNumber{};
+      int dimension{};
+      int weightNumber{};
+      // nodes other than the root, the node of index i is nodes[i - 1]
+      KDTree *nodes{};
+      // per-node data in structure-of-arrays form, [axis or weight][index]
+      std::vector<dataType> coordinates;
+      std::vector<dataType> coordsMin;
+      std::vector<dataType> coordsMax;
+      std::vector<dataType> weights;
+      std::vector<dataType> minSubweights;
+
+      ~Arena() {
+        delete[] nodes;
+      }
+    };
+
+    void buildArena(dataType *data,
+                    const int ptNumber,
+                    const int dimension,
+                    const int weight_number,
+                    std::vector<KDTree<dataType> *> &correspondance_map);
+
+    KDTree *buildRecursive(dataType *data,
+                           int *idx,
+                           const int size,
+                           KDTree<dataType> *parent,
+                           const bool is_left,
+                           int &nextIndex,
+                           std::vector<KDTree<dataType> *> &correspondance_map);
+
+    // computes the min subweights of all the nodes from their weights
+    void initMinSubweights();
+
+    inline KDTree *getNode(const int index) {
+      return index ? &arena_->nodes[index - 1] : this;
+    }
+
+    inline dataType &coordinate(const int axis) {
+      return arena_->coordinates[axis * arena_->nodeNumber + index_];
+    }
+
+    inline dataType &weight(const int weight_index) {
+      return arena_->weights[weight_index * arena_->nodeNumber + index_];
+    }
+
+    inline dataType &minSubweight(const int weight_index) {
+      return arena_->minSubweights[weight_index * arena_->nodeNumber + index_];
+    }
+
+    inline dataType power(const dataType var) const {
+      if(p_ == 2)
+        return var * var;
+      if(p_ == 1)
+        return var;
+      return pow(var, p_);
+    }
+
     bool is_left_; // Boolean indicating if the current node is a left node of
                    // its parent
     int coords_number_; // Indicates according to which coordinate the tree
@@ -144,21 +174,28 @@ namespace ttk {
     bool include_weights_; // Wether or not the KDTree should include weights
                            // that add up to distance for the computation of
                            // nearest neighbours
+
+    int index_; // Position of the node in the arena (depth-first order)
+    Arena *arena_; // Storage shared by all the nodes of the tree
   };
 
   template <typename dataType>
   std::vector<dataType> KDTree<dataType>::getCoordinates() {
-    return coordinates_;
+    std::vector<dataType> coordinates(arena_->dimension);
+    for(int axis = 0; axis < arena_->dimension; axis++) {
+      coordinates[axis] = coordinate(axis);
+    }
+    return coordinates;
   }
 
   template <typename dataType>
   dataType KDTree<dataType>::getWeight(const int weight_index) {
-    return weight_[weight_index];
+    return weight(weight_index);
   }
 
   template <typename dataType>
   dataType KDTree<dataType>::getMinSubWeight(const int weight_index) {
-    return min_subweights_[weight_index];
+    return minSubweight(weight_index);
   }
 
   template <typename dataType>
@@ -168,164 +205,175 @@ namespace ttk {
                             const int &dimension,
                             const int weight_number) {
     std::vector<KDTree<dataType> *> correspondance_map(ptNumber);
-    // First, perform a argsort on the data
-    // initialize original index locations
-    for(int axis = 0; axis < dimension; axis++) {
-      coords_min_.push_back(std::numeric_limits<dataType>::lowest());
-      coords_max_.push_back(std::numeric_limits<dataType>::max());
-    }
-    std::vector<int> idx(ptNumber);
-    for(int i = 0; i < ptNumber; i++) {
-      idx[i] = i;
-    }
-    // sort indexes based on comparing values in coordinates
-    sort(idx.begin(), idx.end(), [&](int i1, int i2) {
-      return data[dimension * i1 + coords_number_]
-             < data[dimension * i2 + coords_number_];
-    });
-    int median_loc = (int)(ptNumber - 1) / 2;
-    int median_idx = idx[median_loc];
-    correspondance_map[median_idx] = this;
+    buildArena(data, ptNumber, dimension, weight_number, correspondance_map);
+    // all the weights are null, as their min subweights
+    return correspondance_map;
+  }
+
+  template <typename dataType>
+  void KDTree<dataType>::buildArena(
+    dataType *data,
+    const int ptNumber,
+    const int dimension,
+    const int weight_number,
+    std::vector<KDTree<dataType> *> &correspondance_map) {
 
-    for(int axis = 0; axis < dimension; axis++) {
-      coordinates_.push_back(data[dimension * median_idx + axis]);
+    if(arena_) {
+      delete arena_;
     }
-    for(int w = 0; w < weight_number; w++) {
-      weight_.push_back(0);
-      min_subweights_.push_back(0);
+    arena_ = new Arena();
+    arena_->nodeNumber = ptNumber;
+    arena_->dimension = dimension;
+    arena_->weightNumber = weight_number;
+    if(ptNumber <= 0) {
+      return;
     }
-    id_ = median_idx;
-    parent_ = nullptr;
-    level_ = 0;
 
-    if(idx.size() > 2) {
-      // Build left leaf
-      std::vector<int> idx_left;
-      for(int i = 0; i < median_loc; i++) {
-        idx_left.push_back(idx[i]);
+    if(ptNumber > 1) {
+      arena_->nodes = new KDTree[ptNumber - 1];
+      for(int i = 0; i < ptNumber - 1; i++) {
+        arena_->nodes[i].p_ = p_;
+        arena_->nodes[i].include_weights_ = include_weights_;
+        arena_->nodes[i].arena_ = arena_;
       }
-
-      KDTree *left = new KDTree(this, (coords_number_ + 1) % dimension, true);
-      left->buildRecursive(data, idx_left, ptNumber, dimension, this,
-                           correspondance_map, weight_number);
-      left_ = left;
     }
+    arena_->coordinates.resize(dimension * ptNumber);
+    arena_->coordsMin.resize(dimension * ptNumber);
+    arena_->coordsMax.resize(dimension * ptNumber);
+    arena_->weights.resize(weight_number * ptNumber, 0);
+    arena_->minSubweights.resize(weight_number * ptNumber, 0);
 
-    if(idx.size() > 1) {
-      // Build right leaf
-      std::vector<int> idx_right(ptNumber - median_loc - 1);
-      for(int i = 0; i < ptNumber - median_loc - 1; i++) {
-        idx_right[i] = idx[i + median_loc + 1];
-      }
-      KDTree *right = new KDTree(this, (coords_number_ + 1) % dimension, false);
-      right->buildRecursive(data, idx_right, ptNumber, dimension, this,
-                            correspondance_map, weight_number);
-      right_ = right;
+    std::vector<int> idx(ptNumber);
+    for(int i = 0; i < ptNumber; i++) {
+      idx[i] = i;
     }
-
-    return correspondance_map;
+    int nextIndex = 0;
+    buildRecursive(data, idx.data(), ptNumber, nullptr, false, nextIndex,
+                   correspondance_map);
   }
 
   template <typename dataType>
-  void KDTree<dataType>::buildRecursive(
+  KDTree<dataType> *KDTree<dataType>::buildRecursive(
     dataType *data,
-    std::vector<int> idx_side,
-    const int &ptNumber,
-    const int &dimension,
+    int *idx,
+    const int size,
     KDTree<dataType> *parent,
-    std::vector<KDTree<dataType> *> &correspondance_map,
-    const int weight_number) {
-
-    // First, perform a argsort on the data
-    sort(idx_side.begin(), idx_side.end(), [&](int i1, int i2) {
-      return data[dimension * i1 + coords_number_]
-             < data[dimension * i2 + coords_number_];
+    const bool is_left,
+    int &nextIndex,
+    std::vector<KDTree<dataType> *> &correspondance_map) {
+
+    const int index = nextIndex++;
+    const int dimension = arena_->dimension;
+    const int nodeNumber = arena_->nodeNumber;
+    KDTree *node = getNode(index);
+    node->index_ = index;
+    node->parent_ = parent;
+    node->is_left_ = is_left;
+    node->left_ = nullptr;
+    node->right_ = nullptr;
+    node->level_ = parent ? parent->level_ + 1 : 0;
+    node->coords_number_
+      = parent ? (parent->coords_number_ + 1) % dimension : 0;
+
+    // Place the median along the split coordinate, the lower half before it
+    const int axis = node->coords_number_;
+    const int median_loc = (size - 1) / 2;
+    std::nth_element(idx, idx + median_loc, idx + size, [&](int i1, int i2) {
+      return data[dimension * i1 + axis] < data[dimension * i2 + axis];
     });
-    int median_loc = (int)(idx_side.size() - 1) / 2;
-    int median_idx = idx_side[median_loc];
-    correspondance_map[median_idx] = this;
+    const int median_idx = idx[median_loc];
+    correspondance_map[median_idx] = node;
+    node->id_ = median_idx;
 
-    for(int axis = 0; axis < dimension; axis++) {
-      coordinates_.push_back(data[dimension * median_idx + axis]);
+    for(int a = 0; a < dimension; a++) {
+      arena_->coordinates[a * nodeNumber + index]
+        = data[dimension * median_idx + a];
     }
-    for(int w = 0; w < weight_number; w++) {
-      weight_.push_back(0);
-      min_subweights_.push_back(0);
-    }
-    id_ = median_idx;
-    parent_ = parent;
-    level_ = parent->level_ + 1;
 
     // Create bounding box
-    for(int axis = 0; axis < dimension; axis++) {
-      coords_min_.push_back(parent_->coords_min_[axis]);
-      coords_max_.push_back(parent_->coords_max_[axis]);
+    for(int a = 0; a < dimension; a++) {
+      arena_->coordsMin[a * nodeNumber + index]
+        = parent ? arena_->coordsMin[a * nodeNumber + parent->index_]
+                 : std::numeric_limits<dataType>::lowest();
+      arena_->coordsMax[a * nodeNumber + index]
+        = parent ? arena_->coordsMax[a * nodeNumber + parent->index_]
+                 : std::numeric_limits<dataType>::max();
     }
-    if(is_left_ && !this->isRoot()) {
-      coords_max_[parent_->coords_number_]
-        = parent_->coordinates_[parent_->coords_number_];
-    } else if(!is_left_ && !this->isRoot()) {
-      coords_min_[parent_->coords_number_]
-        = parent_->coordinates_[parent_->coords_number_];
+    if(parent) {
+      const int cut = parent->coords_number_ * nodeNumber;
+      if(is_left) {
+        arena_->coordsMax[cut + index]
+          = arena_->coordinates[cut + parent->index_];
+      } else {
+        arena_->coordsMin[cut + index]
+          = arena_->coordinates[cut + parent->index_];
+      }
     }
 
-    if(idx_side.size() > 2) {
+    if(size > 2) {
       // Build left leaf
-      std::vector<int> idx_left(median_loc);
-      for(int i = 0; i < median_loc; i++) {
-        idx_left[i] = idx_side[i];
-      }
-
-      KDTree *left = new KDTree(this, (coords_number_ + 1) % dimension, true);
-      left->buildRecursive(data, idx_left, ptNumber, dimension, this,
-                           correspondance_map, weight_number);
-      left_ = left;
+      node->left_ = buildRecursive(
+        data, idx, median_loc, node, true, nextIndex, correspondance_map);
     }
 
-    if(idx_side.size() > 1) {
+    if(size > 1) {
       // Build right leaf
-      std::vector<int> idx_right(idx_side.size() - median_loc - 1);
-      for(unsigned int i = 0; i < idx_side.size() - median_loc - 1; i++) {
-        idx_right[i] = idx_side[i + median_loc + 1];
+      node->right_
+        = buildRecursive(data, idx + median_loc + 1, size - median_loc - 1,
+                         node, false, nextIndex, correspondance_map);
+    }
+    return node;
+  }
+
+  template <typename dataType>
+  void KDTree<dataType>::initMinSubweights() {
+    // children come after their parent in the arena
+    const int nodeNumber = arena_->nodeNumber;
+    for(int w = 0; w < arena_->weightNumber; w++) {
+      dataType *minSubweights = &arena_->minSubweights[w * nodeNumber];
+      const dataType *weights = &arena_->weights[w * nodeNumber];
+      for(int i = nodeNumber - 1; i >= 0; i--) {
+        KDTree *node = getNode(i);
+        dataType min_subweight = weights[i];
+        if(node->left_) {
+          min_subweight
+            = std::min(min_subweight, minSubweights[node->left_->index_]);
+        }
+        if(node->right_) {
+          min_subweight
+            = std::min(min_subweight, minSubweights[node->right_->index_]);
+        }
+        minSubweights[i] = min_subweight;
       }
-      KDTree *right = new KDTree(this, (coords_number_ + 1) % dimension, false);
-      right->buildRecursive(data, idx_right, ptNumber, dimension, this,
-                            correspondance_map, weight_number);
-      right_ = right;
     }
-    return;
   }
 
   template <typename dataType>
   void KDTree<dataType>::updateWeight(dataType new_weight,
                                       const int weight_index) {
-    weight_[weight_index] = new_weight;
+    weight(weight_index) = new_weight;
     updateMinSubweight(weight_index);
   }
 
   template <typename dataType>
   void KDTree<dataType>::updateMinSubweight(const int weight_index) {
-    dataType new_min_subweight;
-    if(this->isLeaf()) {
-      new_min_subweight = weight_[weight_index];
-    } else if(!left_) {
-      new_min_subweight = std::min(
-        right_->min_subweights_[weight_index], weight_[weight_index]);
-    } else if(!right_) {
-      new_min_subweight
-        = std::min(left_->min_subweights_[weight_index], weight_[weight_index]);
-    } else {
-      new_min_subweight
-        = std::min(std::min(left_->min_subweights_[weight_index],
-                            right_->min_subweights_[weight_index]),
-                   weight_[weight_index]);
-    }
+    KDTree *node = this;
+    while(node) {
+      dataType new_min_subweight = node->weight(weight_index);
+      if(node->left_) {
+        new_min_subweight = std::min(
+          new_min_subweight, node->left_->minSubweight(weight_index));
+      }
+      if(node->right_) {
+        new_min_subweight = std::min(
+          new_min_subweight, node->right_->minSubweight(weight_index));
+      }
 
-    if(new_min_subweight != min_subweights_[weight_index]) {
-      min_subweights_[weight_index] = new_min_subweight;
-      if(!this->isRoot()) {
-        parent_->updateMinSubweight(weight_index);
+      if(new_min_subweight == node->minSubweight(weight_index)) {
+        break;
       }
+      node->minSubweight(weight_index) = new_min_subweight;
+      node = node->parent_;
     }
   }
 
@@ -342,7 +390,7 @@ namespace ttk {
     /// will need to sort them according to their cost.
     if(this->isLeaf()) {
       dataType cost = this->cost(coordinates);
-      cost += weight_[weight_index];
+      cost += weight(weight_index);
       neighbours.push_back(this);
       costs.push_back(cost);
     } else {
@@ -363,52 +411,52 @@ namespace ttk {
     // 1- Look wether or not to include the current point in the nearest
     // neighbours
     dataType cost = this->cost(coordinates);
-    cost += weight_[weight_index];
+    cost += weight(weight_index);
 
     if(costs.size() < k) {
       neighbours.push_back(this);
       costs.push_back(cost);
     } else {
       // 1.1- Find the most costly amongst neighbours
-      std::vector<int> idx(k);
-      for(unsigned int i = 0; i < k; i++) {
-        idx[i] = i;
+      unsigned int idx_max_cost = 0;
+      for(unsigned int i = 1; i < k; i++) {
+        if(costs[idx_max_cost] < costs[i]) {
+          idx_max_cost = i;
+        }
       }
-      int idx_max_cost = *std::max_element(
-        idx.begin(), idx.end(),
-        [&costs](int &a, int &b) { return costs[a] < costs[b]; });
-      dataType max_cost = costs[idx_max_cost];
 
       // 1.2- If the current KDTree is less costly, put it in the neighbours and
       // update costs.
-      if(cost < max_cost) {
+      if(cost < costs[idx_max_cost]) {
         costs[idx_max_cost] = cost;
         neighbours[idx_max_cost] = this;
       }
     }
 
-    // 2- Recursively visit KDTrees that are worth it
-    if(left_) {
-      dataType max_cost = *std::max_element(costs.begin(), costs.end());
-      dataType &min_subweight = left_->min_subweights_[weight_index];
-      dataType d_min = this->distanceToBox(left_, coordinates);
-      if(costs.size() < k || d_min + min_subweight < max_cost) {
-        // 2.2- It is possible that there exists a point in this subtree that is
-        // less costly than max_cost
-        left_->recursiveGetKClosest(
-          k, coordinates, neighbours, costs, weight_index);
+    // 2- Recursively visit KDTrees that are worth it, the closest subtree
+    // first so that the second one is more likely to be pruned
+    KDTree *children[2] = {left_, right_};
+    dataType d_mins[2] = {0, 0};
+    for(int c = 0; c < 2; c++) {
+      if(children[c]) {
+        d_mins[c] = children[c]->minSubweight(weight_index)
+                    + this->distanceToBox(children[c], coordinates);
       }
     }
+    if(children[0] && children[1] && d_mins[1] < d_mins[0]) {
+      std::swap(children[0], children[1]);
+      std::swap(d_mins[0], d_mins[1]);
+    }
 
-    if(right_) {
-      dataType max_cost = *std::max_element(costs.begin(), costs.end());
-      dataType &min_subweight = right_->min_subweights_[weight_index];
-      dataType d_min = this->distanceToBox(right_, coordinates);
-      if(costs.size() < k || d_min + min_subweight < max_cost) {
-        // 2.2- It is possible that there exists a point in this subtree that is
-        // less costly than max_cost
-        right_->recursiveGetKClosest(
-          k, coordinates, neighbours, costs, weight_index);
+    for(int c = 0; c < 2; c++) {
+      if(children[c]) {
+        dataType max_cost = *std::max_element(costs.begin(), costs.end());
+        if(costs.size() < k || d_mins[c] < max_cost) {
+          // 2.2- It is possible that there exists a point in this subtree that
+          // is less costly than max_cost
+          children[c]->recursiveGetKClosest(
+            k, coordinates, neighbours, costs, weight_index);
+        }
       }
     }
     return;
@@ -418,7 +466,7 @@ namespace ttk {
   dataType KDTree<dataType>::cost(const std::vector<dataType> &coordinates) {
     dataType cost = 0;
     for(unsigned int i = 0; i < coordinates.size(); i++) {
-      cost += pow(abs(coordinates[i] - coordinates_[i]), p_);
+      cost += power(abs(coordinates[i] - coordinate(i)));
     }
     return cost;
   }
@@ -427,12 +475,15 @@ namespace ttk {
   dataType
     KDTree<dataType>::distanceToBox(KDTree<dataType> *subtree,
                                     const std::vector<dataType> &coordinates) {
+    const int nodeNumber = arena_->nodeNumber;
+    const dataType *coords_min = &arena_->coordsMin[subtree->index_];
+    const dataType *coords_max = &arena_->coordsMax[subtree->index_];
     dataType d_min = 0;
     for(unsigned int axis = 0; axis < coordinates.size(); axis++) {
-      if(subtree->coords_min_[axis] > coordinates[axis]) {
-        d_min += pow(subtree->coords_min_[axis] - coordinates[axis], p_);
-      } else if(subtree->coords_max_[axis] < coordinates[axis]) {
-        d_min += pow(coordinates[axis] - subtree->coords_max_[axis], p_);
+      if(coords_min[axis * nodeNumber] > coordinates[axis]) {
+        d_min += power(coords_min[axis * nodeNumber] - coordinates[axis]);
+      } else if(coords_max[axis * nodeNumber] < coordinates[axis]) {
+        d_min += power(coordinates[axis] - coords_max[axis * nodeNumber]);
       }
     }
     return d_min;
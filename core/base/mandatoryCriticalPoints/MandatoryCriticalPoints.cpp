@@ -140,6 +140,12 @@ int MandatoryCriticalPoints::buildSubTrees() {
     }
   }
 
+  // the join and split trees of a field sweep the same vertex order
+  const auto upperVertexOrder = triangulation_->getVertexOrder(
+    upperVertexScalars_.data(), vertexSoSoffsets_.data(), threadNumber_);
+  const auto lowerVertexOrder = triangulation_->getVertexOrder(
+    lowerVertexScalars_.data(), vertexSoSoffsets_.data(), threadNumber_);
+
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel sections num_threads(threadNumber_)
 #endif
@@ -152,6 +158,7 @@ int MandatoryCriticalPoints::buildSubTrees() {
   upperJoinTree_.setVertexPositions(&vertexPositions_);
   upperJoinTree_.setTriangulation(triangulation_);
   upperJoinTree_.setVertexSoSoffsets(&vertexSoSoffsets_);
+  upperJoinTree_.setVertexOrder(upperVertexOrder);
   upperJoinTree_.buildExtremumList(upperMinimumList_, true);
   upperJoinTree_.build();
 }
@@ -164,6 +171,7 @@ int MandatoryCriticalPoints::buildSubTrees() {
   lowerJoinTree_.setVertexPositions(&vertexPositions_);
   lowerJoinTree_.setTriangulation(triangulation_);
   lowerJoinTree_.setVertexSoSoffsets(&vertexSoSoffsets_);
+  lowerJoinTree_.setVertexOrder(lowerVertexOrder);
   lowerJoinTree_.setMinimumList(lowerMinimumList_);
   lowerJoinTree_.build();
 }
@@ -176,6 +184,7 @@ int MandatoryCriticalPoints::buildSubTrees() {
   upperSplitTree_.setVertexPositions(&vertexPositions_);
   upperSplitTree_.setTriangulation(triangulation_);
   upperSplitTree_.setVertexSoSoffsets(&vertexSoSoffsets_);
+  upperSplitTree_.setVertexOrder(upperVertexOrder);
   upperSplitTree_.setMaximumList(upperMaximumList_);
   upperSplitTree_.build();
 }
@@ -188,6 +197,7 @@ int MandatoryCriticalPoints::buildSubTrees() {
   lowerSplitTree_.setVertexPositions(&vertexPositions_);
   lowerSplitTree_.setTriangulation(triangulation_);
   lowerSplitTree_.setVertexSoSoffsets(&vertexSoSoffsets_);
+  lowerSplitTree_.setVertexOrder(lowerVertexOrder);
   lowerSplitTree_.buildExtremumList(lowerMaximumList_, false);
   lowerSplitTree_.build();
 }
@@ -75,44 +75,71 @@ int MorseSmaleComplex3D::getSaddleConnectors(
   vector<Separatrix> &separatrices,
   vector<vector<Cell>> &separatricesGeometry) const {
 
-  const SimplexId numberOfTriangles
-    = inputTriangulation_->getNumberOfTriangles();
-  wallId_t descendingWallId = 1;
-  vector<wallId_t> isVisited(numberOfTriangles, 0);
-
+  vector<SimplexId> saddleIndexes;
   const SimplexId numberOfCriticalPoints = criticalPoints.size();
   for(SimplexId i = 0; i < numberOfCriticalPoints; ++i) {
     const Cell &criticalPoint = criticalPoints[i];
 
-    if(criticalPoint.dim_ == 2) {
-      const Cell &saddle2 = criticalPoint;
+    if(criticalPoint.dim_ == 2)
+      saddleIndexes.push_back(i);
+  }
+  const SimplexId numberOfSaddles = saddleIndexes.size();
+
+  // connectors of each 2-saddle, concatenated afterwards in saddle order
+  vector<vector<SimplexId>> connectorSources(numberOfSaddles);
+  vector<vector<vector<Cell>>> connectorGeometries(numberOfSaddles);
 
-      set<SimplexId> saddles1;
-      const wallId_t savedDescendingWallId = descendingWallId;
+  const SimplexId numberOfTriangles
+    = inputTriangulation_->getNumberOfTriangles();
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif
+  {
+    // the walls are stamped in thread-local arrays
+    wallId_t descendingWallId = 0;
+    vector<wallId_t> isVisited(numberOfTriangles, 0);
+    vector<SimplexId> saddles1;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+    for(SimplexId i = 0; i < numberOfSaddles; ++i) {
+      const Cell &saddle2 = criticalPoints[saddleIndexes[i]];
+
+      ++descendingWallId;
       discreteGradient_.getDescendingWall(
         descendingWallId, saddle2, isVisited, nullptr, &saddles1);
-      ++descendingWallId;
 
       for(const SimplexId saddle1Id : saddles1) {
-        const Cell &saddle1 = Cell(1, saddle1Id);
+        const Cell saddle1(1, saddle1Id);
 
         vector<Cell> vpath;
         const bool isMultiConnected
           = discreteGradient_.getAscendingPathThroughWall(
-            savedDescendingWallId, saddle1, saddle2, isVisited, &vpath);
+            descendingWallId, saddle1, saddle2, isVisited, &vpath);
 
         const Cell &lastCell = vpath.back();
         if(!isMultiConnected and lastCell.dim_ == saddle2.dim_
            and lastCell.id_ == saddle2.id_) {
-          const SimplexId separatrixIndex = separatrices.size();
-          separatricesGeometry.push_back(std::move(vpath));
-          separatrices.push_back(
-            Separatrix(true, saddle1, saddle2, false, separatrixIndex));
+          connectorSources[i].push_back(saddle1Id);
+          connectorGeometries[i].push_back(std::move(vpath));
         }
       }
     }
   }
 
+  for(SimplexId i = 0; i < numberOfSaddles; ++i) {
+    const Cell &saddle2 = criticalPoints[saddleIndexes[i]];
+    const SimplexId numberOfConnectors = connectorSources[i].size();
+    for(SimplexId j = 0; j < numberOfConnectors; ++j) {
+      const SimplexId separatrixIndex = separatrices.size();
+      separatricesGeometry.push_back(std::move(connectorGeometries[i][j]));
+      separatrices.push_back(Separatrix(true, Cell(1, connectorSources[i][j]),
+                                        saddle2, false, separatrixIndex));
+    }
+  }
+
   return 0;
 }
 
@@ -120,7 +147,7 @@ int MorseSmaleComplex3D::getAscendingSeparatrices2(
   const vector<Cell> &criticalPoints,
   vector<Separatrix> &separatrices,
   vector<vector<Cell>> &separatricesGeometry,
-  vector<set<SimplexId>> &separatricesSaddles) const {
+  vector<vector<SimplexId>> &separatricesSaddles) const {
   const Cell emptyCell;
 
   vector<SimplexId> saddleIndexes;
@@ -141,19 +168,31 @@ int MorseSmaleComplex3D::getAscendingSeparatrices2(
   separatricesSaddles.resize(numberOfSeparatrices);
 
   const SimplexId numberOfEdges = inputTriangulation_->getNumberOfEdges();
-  vector<wallId_t> isVisited(numberOfEdges, 0);
 
   // apriori: by default construction, the separatrices are not valid
-  for(SimplexId i = 0; i < numberOfSaddles; ++i) {
-    const SimplexId saddleIndex = saddleIndexes[i];
-    const Cell &saddle1 = criticalPoints[saddleIndex];
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif
+  {
+    // the walls are stamped in thread-local arrays
+    wallId_t wallId = 0;
+    vector<wallId_t> isVisited(numberOfEdges, 0);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+    for(SimplexId i = 0; i < numberOfSaddles; ++i) {
+      const SimplexId saddleIndex = saddleIndexes[i];
+      const Cell &saddle1 = criticalPoints[saddleIndex];
 
-    vector<Cell> wall;
-    discreteGradient_.getAscendingWall(
-      saddle1.id_, saddle1, isVisited, &wall, &separatricesSaddles[i]);
+      ++wallId;
+      vector<Cell> wall;
+      discreteGradient_.getAscendingWall(
+        wallId, saddle1, isVisited, &wall, &separatricesSaddles[i]);
 
-    separatricesGeometry[i] = std::move(wall);
-    separatrices[i] = Separatrix(true, saddle1, emptyCell, false, i);
+      separatricesGeometry[i] = std::move(wall);
+      separatrices[i] = Separatrix(true, saddle1, emptyCell, false, i);
+    }
   }
 
   return 0;
@@ -163,7 +202,7 @@ int MorseSmaleComplex3D::getDescendingSeparatrices2(
   const vector<Cell> &criticalPoints,
   vector<Separatrix> &separatrices,
   vector<vector<Cell>> &separatricesGeometry,
-  vector<set<SimplexId>> &separatricesSaddles) const {
+  vector<vector<SimplexId>> &separatricesSaddles) const {
   const Cell emptyCell;
 
   vector<SimplexId> saddleIndexes;
@@ -185,19 +224,31 @@ int MorseSmaleComplex3D::getDescendingSeparatrices2(
 
   const SimplexId numberOfTriangles
     = inputTriangulation_->getNumberOfTriangles();
-  vector<wallId_t> isVisited(numberOfTriangles, 0);
 
   // apriori: by default construction, the separatrices are not valid
-  for(SimplexId i = 0; i < numberOfSaddles; ++i) {
-    const SimplexId saddleIndex = saddleIndexes[i];
-    const Cell &saddle2 = criticalPoints[saddleIndex];
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif
+  {
+    // the walls are stamped in thread-local arrays
+    wallId_t wallId = 0;
+    vector<wallId_t> isVisited(numberOfTriangles, 0);
 
-    vector<Cell> wall;
-    discreteGradient_.getDescendingWall(
-      saddle2.id_, saddle2, isVisited, &wall, &separatricesSaddles[i]);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+    for(SimplexId i = 0; i < numberOfSaddles; ++i) {
+      const SimplexId saddleIndex = saddleIndexes[i];
+      const Cell &saddle2 = criticalPoints[saddleIndex];
 
-    separatricesGeometry[i] = std::move(wall);
-    separatrices[i] = Separatrix(true, saddle2, emptyCell, false, i);
+      ++wallId;
+      vector<Cell> wall;
+      discreteGradient_.getDescendingWall(
+        wallId, saddle2, isVisited, &wall, &separatricesSaddles[i]);
+
+      separatricesGeometry[i] = std::move(wall);
+      separatrices[i] = Separatrix(true, saddle2, emptyCell, false, i);
+    }
   }
 
   return 0;
@@ -38,14 +38,16 @@ namespace ttk {
 
     /**
      * Compute the (saddle1, saddle2) pairs not detected by the
-     * contour tree.
+     * contour tree. The pairs of persistence lower than threshold are
+     * not stored.
      */
     template <typename dataType, typename idType>
     int computePersistencePairs(
       const std::vector<std::tuple<SimplexId, SimplexId, dataType>> &JTPairs,
       const std::vector<std::tuple<SimplexId, SimplexId, dataType>> &STPairs,
       std::vector<std::tuple<SimplexId, SimplexId, dataType>>
-        &pl_saddleSaddlePairs);
+        &pl_saddleSaddlePairs,
+      const double threshold = 0);
 
     template <typename dataType>
     int setAugmentedCriticalPoints(const std::vector<dcg::Cell> &criticalPoints,
@@ -63,7 +65,8 @@ namespace ttk {
 
     /**
      * Compute the saddle-connectors by reading into the discrete
-     * gradient.
+     * gradient. The 2-saddles are processed in parallel, each thread
+     * stamping the visited triangles in its own array.
      */
     int getSaddleConnectors(
       const std::vector<dcg::Cell> &criticalPoints,
@@ -86,13 +89,14 @@ namespace ttk {
 
     /**
      * Compute the 2-separatrices by reading into the discrete
-     * gradient from the maxima.
+     * gradient from the maxima. The walls are extracted in parallel, each
+     * thread stamping the visited cells in its own array.
      */
     int getDescendingSeparatrices2(
       const std::vector<dcg::Cell> &criticalPoints,
       std::vector<Separatrix> &separatrices,
       std::vector<std::vector<dcg::Cell>> &separatricesGeometry,
-      std::vector<std::set<SimplexId>> &separatricesSaddles) const;
+      std::vector<std::vector<SimplexId>> &separatricesSaddles) const;
 
     /**
      * Compute the geometrical embedding of the descending
@@ -108,13 +112,13 @@ namespace ttk {
     int setDescendingSeparatrices2(
       const std::vector<Separatrix> &separatrices,
       const std::vector<std::vector<dcg::Cell>> &separatricesGeometry,
-      const std::vector<std::set<SimplexId>> &separatricesSaddles) const;
+      const std::vector<std::vector<SimplexId>> &separatricesSaddles) const;
 #ifdef TTK_ENABLE_OPENMP
     template <typename dataType>
     int omp_setDescendingSeparatrices2(
       const std::vector<Separatrix> &separatrices,
       const std::vector<std::vector<dcg::Cell>> &separatricesGeometry,
-      const std::vector<std::set<SimplexId>> &separatricesSaddles) const;
+      const std::vector<std::vector<SimplexId>> &separatricesSaddles) const;
 #endif
 
     int getDualPolygon(const SimplexId edgeId,
@@ -124,13 +128,14 @@ namespace ttk {
 
     /**
      * Compute the 2-separatrices by reading into the discrete
-     * gradient from the minima.
+     * gradient from the minima. The walls are extracted in parallel, each
+     * thread stamping the visited cells in its own array.
      */
     int getAscendingSeparatrices2(
       const std::vector<dcg::Cell> &criticalPoints,
       std::vector<Separatrix> &separatrices,
       std::vector<std::vector<dcg::Cell>> &separatricesGeometry,
-      std::vector<std::set<SimplexId>> &separatricesSaddles) const;
+      std::vector<std::vector<SimplexId>> &separatricesSaddles) const;
 
     /**
      * Compute the geometrical embedding of the ascending
@@ -146,14 +151,14 @@ namespace ttk {
     int setAscendingSeparatrices2(
       const std::vector<Separatrix> &separatrices,
       const std::vector<std::vector<dcg::Cell>> &separatricesGeometry,
-      const std::vector<std::set<SimplexId>> &separatricesSaddles) const;
+      const std::vector<std::vector<SimplexId>> &separatricesSaddles) const;
 
 #ifdef TTK_ENABLE_OPENMP
     template <typename dataType>
     int omp_setAscendingSeparatrices2(
       const std::vector<Separatrix> &separatrices,
       const std::vector<std::vector<dcg::Cell>> &separatricesGeometry,
-      const std::vector<std::set<SimplexId>> &separatricesSaddles) const;
+      const std::vector<std::vector<SimplexId>> &separatricesSaddles) const;
 #endif
   };
 } // namespace ttk
@@ -318,7 +323,7 @@ template <typename dataType>
 int ttk::MorseSmaleComplex3D::omp_setAscendingSeparatrices2(
   const std::vector<Separatrix> &separatrices,
   const std::vector<std::vector<dcg::Cell>> &separatricesGeometry,
-  const std::vector<std::set<SimplexId>> &separatricesSaddles) const {
+  const std::vector<std::vector<SimplexId>> &separatricesSaddles) const {
 #ifndef TTK_ENABLE_KAMIKAZE
   if(!outputSeparatrices2_numberOfPoints_) {
     std::cerr << "[MorseSmaleComplex3D] 2-separatrices pointer to "
@@ -618,7 +623,7 @@ template <typename dataType>
 int ttk::MorseSmaleComplex3D::setAscendingSeparatrices2(
   const std::vector<Separatrix> &separatrices,
   const std::vector<std::vector<dcg::Cell>> &separatricesGeometry,
-  const std::vector<std::set<SimplexId>> &separatricesSaddles) const {
+  const std::vector<std::vector<SimplexId>> &separatricesSaddles) const {
 #ifndef TTK_ENABLE_KAMIKAZE
   if(!outputSeparatrices2_numberOfPoints_) {
     std::cerr << "[MorseSmaleComplex3D] 2-separatrices pointer to "
@@ -789,7 +794,7 @@ template <typename dataType>
 int ttk::MorseSmaleComplex3D::omp_setDescendingSeparatrices2(
   const std::vector<Separatrix> &separatrices,
   const std::vector<std::vector<dcg::Cell>> &separatricesGeometry,
-  const std::vector<std::set<SimplexId>> &separatricesSaddles) const {
+  const std::vector<std::vector<SimplexId>> &separatricesSaddles) const {
 #ifndef TTK_ENABLE_KAMIKAZE
   if(!outputSeparatrices2_numberOfPoints_) {
     std::cerr << "[MorseSmaleComplex3D] 2-separatrices pointer to "
@@ -1081,7 +1086,7 @@ template <typename dataType>
 int ttk::MorseSmaleComplex3D::setDescendingSeparatrices2(
   const std::vector<Separatrix> &separatrices,
   const std::vector<std::vector<dcg::Cell>> &separatricesGeometry,
-  const std::vector<std::set<SimplexId>> &separatricesSaddles) const {
+  const std::vector<std::vector<SimplexId>> &separatricesSaddles) const {
 #ifndef TTK_ENABLE_KAMIKAZE
   if(!outputSeparatrices2_numberOfPoints_) {
     std::cerr << "[MorseSmaleComplex3D] 2-separatrices pointer to "
@@ -1334,12 +1339,14 @@ int ttk::MorseSmaleComplex3D::execute() {
     }
   }
 
-  // 2-separatrices
+  // 2-separatrices: the walls are always extracted in parallel, but their
+  // polygons are built in parallel only if PrioritizeSpeedOverMemory is set
+  // (the points are then duplicated per polygon).
   if(ComputeDescendingSeparatrices2) {
     Timer tmp;
     std::vector<Separatrix> separatrices;
     std::vector<std::vector<dcg::Cell>> separatricesGeometry;
-    std::vector<std::set<SimplexId>> separatricesSaddles;
+    std::vector<std::vector<SimplexId>> separatricesSaddles;
     getDescendingSeparatrices2(
       criticalPoints, separatrices, separatricesGeometry, separatricesSaddles);
 #ifdef TTK_ENABLE_OPENMP
@@ -1363,7 +1370,7 @@ int ttk::MorseSmaleComplex3D::execute() {
     Timer tmp;
     std::vector<Separatrix> separatrices;
     std::vector<std::vector<dcg::Cell>> separatricesGeometry;
-    std::vector<std::set<SimplexId>> separatricesSaddles;
+    std::vector<std::vector<SimplexId>> separatricesSaddles;
     getAscendingSeparatrices2(
       criticalPoints, separatrices, separatricesGeometry, separatricesSaddles);
 #ifdef TTK_ENABLE_OPENMP
@@ -1436,7 +1443,8 @@ int ttk::MorseSmaleComplex3D::computePersistencePairs(
   const std::vector<std::tuple<SimplexId, SimplexId, dataType>> &JTPairs,
   const std::vector<std::tuple<SimplexId, SimplexId, dataType>> &STPairs,
   std::vector<std::tuple<SimplexId, SimplexId, dataType>>
-    &pl_saddleSaddlePairs) {
+    &pl_saddleSaddlePairs,
+  const double threshold) {
   const dataType *scalars = static_cast<const dataType *>(inputScalarField_);
   const SimplexId numberOfVertices = inputTriangulation_->getNumberOfVertices();
 
@@ -1577,7 +1585,8 @@ int ttk::MorseSmaleComplex3D::computePersistencePairs(
 
     const dataType persistence = scalars[v1] - scalars[v0];
 
-    if(v0 != -1 and v1 != -1 and persistence >= 0) {
+    if(v0 != -1 and v1 != -1 and persistence >= 0
+       and persistence >= threshold) {
       if(!inputTriangulation_->isVertexOnBoundary(v0)
          or !inputTriangulation_->isVertexOnBoundary(v1)) {
         pl_saddleSaddlePairs.push_back(std::make_tuple(v0, v1, persistence));
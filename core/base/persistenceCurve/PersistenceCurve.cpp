@@ -4,7 +4,7 @@ using namespace std;
 using namespace ttk;
 
 PersistenceCurve::PersistenceCurve()
-  : ComputeSaddleConnectors{},
+  : ComputeSaddleConnectors{}, PersistenceThreshold{},
 
     triangulation_{}, inputScalars_{},
     inputOffsets_{}, JTPlot_{}, MSCPlot_{}, STPlot_{}, CTPlot_{} {
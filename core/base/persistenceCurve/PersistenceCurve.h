@@ -41,6 +41,14 @@ namespace ttk {
       return 0;
     }
 
+    /// Discard the pairs of persistence lower than \p threshold while they
+    /// are computed (the pair of the global extrema is always kept). The
+    /// curves then start at the threshold.
+    inline int setPersistenceThreshold(const double threshold) {
+      PersistenceThreshold = threshold;
+      return 0;
+    }
+
     template <typename scalarType>
     int computePersistencePlot(
       const std::vector<std::tuple<SimplexId, SimplexId, scalarType>> &pairs,
@@ -93,6 +101,7 @@ namespace ttk {
 
   protected:
     bool ComputeSaddleConnectors;
+    double PersistenceThreshold;
 
     Triangulation *triangulation_;
     void *inputScalars_;
@@ -137,6 +146,15 @@ int ttk::PersistenceCurve::execute() const {
   SimplexId *offsets = static_cast<SimplexId *>(inputOffsets_);
 
   const SimplexId numberOfVertices = triangulation_->getNumberOfVertices();
+  const int dimensionality = triangulation_->getDimensionality();
+
+  // the saddle-saddle pairs need all the extremum-saddle pairs, which are
+  // then pruned after their computation
+  const bool computeSaddleConnectors
+    = dimensionality == 3 and ComputeSaddleConnectors;
+  const double treeThreshold
+    = computeSaddleConnectors ? 0 : PersistenceThreshold;
+
   // convert offsets into a valid format for contour tree
   std::vector<SimplexId> voffsets(numberOfVertices);
   std::copy(offsets, offsets + numberOfVertices, voffsets.begin());
@@ -150,32 +168,21 @@ int ttk::PersistenceCurve::execute() const {
   contourTree.setVertexSoSoffsets(voffsets.data());
   contourTree.setSegmentation(false);
   contourTree.setThreadNumber(threadNumber_);
-  contourTree.build<scalarType, idType>();
+  if(contourTree.build<scalarType, idType>())
+    return -1;
 
   // get persistence pairs
   std::vector<std::tuple<SimplexId, SimplexId, scalarType>> JTPairs;
   std::vector<std::tuple<SimplexId, SimplexId, scalarType>> STPairs;
-  contourTree.computePersistencePairs<scalarType>(JTPairs, true);
-  contourTree.computePersistencePairs<scalarType>(STPairs, false);
-
-  // merge pairs
-  std::vector<std::tuple<SimplexId, SimplexId, scalarType>> CTPairs(
-    JTPairs.size() + STPairs.size());
-  std::copy(JTPairs.begin(), JTPairs.end(), CTPairs.begin());
-  std::copy(STPairs.begin(), STPairs.end(), CTPairs.begin() + JTPairs.size());
-  {
-    auto cmp = [](const std::tuple<SimplexId, SimplexId, scalarType> &a,
-                  const std::tuple<SimplexId, SimplexId, scalarType> &b) {
-      return std::get<2>(a) < std::get<2>(b);
-    };
-    std::sort(CTPairs.begin(), CTPairs.end(), cmp);
-  }
+  contourTree.computePersistencePairs<scalarType>(
+    JTPairs, true, treeThreshold);
+  contourTree.computePersistencePairs<scalarType>(
+    STPairs, false, treeThreshold);
 
   // get the saddle-saddle pairs
   std::vector<std::tuple<SimplexId, SimplexId, scalarType>>
     pl_saddleSaddlePairs;
-  const int dimensionality = triangulation_->getDimensionality();
-  if(dimensionality == 3 and ComputeSaddleConnectors) {
+  if(computeSaddleConnectors) {
     MorseSmaleComplex3D morseSmaleComplex;
     morseSmaleComplex.setDebugLevel(debugLevel_);
     morseSmaleComplex.setThreadNumber(threadNumber_);
@@ -183,7 +190,7 @@ int ttk::PersistenceCurve::execute() const {
     morseSmaleComplex.setInputScalarField(inputScalars_);
     morseSmaleComplex.setInputOffsets(inputOffsets_);
     morseSmaleComplex.computePersistencePairs<scalarType, idType>(
-      JTPairs, STPairs, pl_saddleSaddlePairs);
+      JTPairs, STPairs, pl_saddleSaddlePairs, PersistenceThreshold);
 
     // sort the saddle-saddle pairs by persistence value and compute curve
     {
@@ -195,6 +202,31 @@ int ttk::PersistenceCurve::execute() const {
     }
 
     computePersistencePlot<scalarType>(pl_saddleSaddlePairs, MSCPlot);
+
+    // prune the extremum-saddle pairs (sorted by persistence), except the
+    // global extrema pair
+    for(auto pairs : {&JTPairs, &STPairs}) {
+      if(pairs->empty())
+        continue;
+      auto last = pairs->begin();
+      while(last != pairs->end() - 1
+            and std::get<2>(*last) < PersistenceThreshold)
+        ++last;
+      pairs->erase(pairs->begin(), last);
+    }
+  }
+
+  // merge pairs
+  std::vector<std::tuple<SimplexId, SimplexId, scalarType>> CTPairs(
+    JTPairs.size() + STPairs.size());
+  std::copy(JTPairs.begin(), JTPairs.end(), CTPairs.begin());
+  std::copy(STPairs.begin(), STPairs.end(), CTPairs.begin() + JTPairs.size());
+  {
+    auto cmp = [](const std::tuple<SimplexId, SimplexId, scalarType> &a,
+                  const std::tuple<SimplexId, SimplexId, scalarType> &b) {
+      return std::get<2>(a) < std::get<2>(b);
+    };
+    std::sort(CTPairs.begin(), CTPairs.end(), cmp);
   }
 
   // get persistence curves
@@ -6,7 +6,7 @@ using namespace ttk;
 using namespace ftm;
 
 PersistenceDiagram::PersistenceDiagram()
-  : ComputeSaddleConnectors{},
+  : ComputeSaddleConnectors{}, UseUnionFind{}, PersistenceThreshold{},
 
     triangulation_{}, inputScalars_{}, CTDiagram_{} {
 }
@@ -15,6 +15,11 @@
 /// vertexId and critical type. Based on that, the persistence of the pair
 /// and its 2D embedding can easily be obtained.
 ///
+/// By default, the extremum-saddle pairs are read from the join and split
+/// trees of the field. When only these pairs are needed, setUseUnionFind()
+/// computes them instead with one union-find sweep of the sorted vertices per
+/// tree (the two sweeps running in parallel), without building the trees.
+///
 /// Persistence diagrams are useful and stable concise representations of the
 /// topological features of a data-set. It is useful to fine-tune persistence
 /// thresholds for topological simplification or for fast similarity
@@ -53,6 +58,20 @@ namespace ttk {
       return 0;
     }
 
+    /// Compute the extremum-saddle pairs with union-find sweeps instead of
+    /// the join and split trees.
+    inline int setUseUnionFind(bool state) {
+      UseUnionFind = state;
+      return 0;
+    }
+
+    /// Discard the pairs of persistence lower than \p threshold while they
+    /// are computed (the pair of the global extrema is always kept).
+    inline int setPersistenceThreshold(const double threshold) {
+      PersistenceThreshold = threshold;
+      return 0;
+    }
+
     ttk::CriticalType getNodeType(ftm::FTMTree_MT *tree,
                                   ftm::TreeType treeType,
                                   const SimplexId vertexId) const;
@@ -80,6 +99,35 @@ namespace ttk {
                              ttk::SimplexId>> &diagram,
       scalarType *scalars) const;
 
+    /**
+     * Compute the extremum-saddle pairs of the join (\p jt true) or split
+     * tree with a union-find sweep of the vertices in increasing (join) or
+     * decreasing (split) order. The pairs are (extremum, saddle,
+     * persistence) triplets sorted by persistence, the last one pairing the
+     * global minimum and maximum, as in ftm::FTMTreePP. The other pairs of
+     * persistence lower than \p threshold are not stored.
+     */
+    template <typename scalarType>
+    int computeUnionFindPairs(
+      const std::vector<SimplexId> &sortedVertices,
+      const std::vector<SimplexId> &vertexRanks,
+      const bool jt,
+      std::vector<std::tuple<SimplexId, SimplexId, scalarType>> &pairs,
+      const double threshold = 0) const;
+
+    template <typename scalarType>
+    int computeUnionFindPersistenceDiagram(
+      const std::vector<
+        std::tuple<ttk::SimplexId, ttk::SimplexId, scalarType, bool>> &pairs,
+      std::vector<std::tuple<ttk::SimplexId,
+                             ttk::CriticalType,
+                             ttk::SimplexId,
+                             ttk::CriticalType,
+                             scalarType,
+                             ttk::SimplexId>> &diagram,
+      const SimplexId globalMinimum,
+      const SimplexId globalMaximum) const;
+
     template <class scalarType, typename idType>
     int execute() const;
 
@@ -95,6 +143,7 @@ namespace ttk {
         ftm::FTMTreePP contourTree;
         contourTree.setupTriangulation(triangulation_);
 
+        triangulation_->preprocessVertexNeighbors();
         triangulation_->preprocessBoundaryVertices();
       }
       return 0;
@@ -119,6 +168,8 @@ namespace ttk {
     std::vector<std::tuple<dcg::Cell, dcg::Cell>> *dmt_pairs;
 
     bool ComputeSaddleConnectors;
+    bool UseUnionFind;
+    double PersistenceThreshold;
 
     Triangulation *triangulation_;
     void *inputScalars_;
@@ -205,6 +256,139 @@ int ttk::PersistenceDiagram::computeCTPersistenceDiagram(
   return 0;
 }
 
+template <typename scalarType>
+int ttk::PersistenceDiagram::computeUnionFindPairs(
+  const std::vector<SimplexId> &sortedVertices,
+  const std::vector<SimplexId> &vertexRanks,
+  const bool jt,
+  std::vector<std::tuple<SimplexId, SimplexId, scalarType>> &pairs,
+  const double threshold) const {
+
+  const scalarType *scalars = static_cast<const scalarType *>(inputScalars_);
+  const SimplexId numberOfVertices = sortedVertices.size();
+
+  pairs.clear();
+  if(!numberOfVertices)
+    return 0;
+
+  // parent of each swept vertex (-1 if not swept yet), the roots storing the
+  // extremum of their component
+  std::vector<SimplexId> parents(numberOfVertices, -1);
+  std::vector<SimplexId> extrema(numberOfVertices, -1);
+  std::vector<SimplexId> roots;
+
+  auto find = [&parents](SimplexId v) {
+    while(parents[v] != v) {
+      parents[v] = parents[parents[v]];
+      v = parents[v];
+    }
+    return v;
+  };
+  auto isOlder = [&vertexRanks, jt](const SimplexId a, const SimplexId b) {
+    return jt ? vertexRanks[a] < vertexRanks[b]
+              : vertexRanks[a] > vertexRanks[b];
+  };
+  auto getPersistence = [scalars, jt](const SimplexId e, const SimplexId v) {
+    return jt ? scalars[v] - scalars[e] : scalars[e] - scalars[v];
+  };
+
+  SimplexId v{-1};
+  for(SimplexId i = 0; i < numberOfVertices; ++i) {
+    v = sortedVertices[jt ? i : numberOfVertices - 1 - i];
+
+    roots.clear();
+    const SimplexId neighborNumber = triangulation_->getVertexNeighborNumber(v);
+    for(SimplexId j = 0; j < neighborNumber; ++j) {
+      SimplexId neighborId;
+      triangulation_->getVertexNeighbor(v, j, neighborId);
+      if(parents[neighborId] != -1)
+        roots.push_back(find(neighborId));
+    }
+    std::sort(roots.begin(), roots.end());
+    roots.erase(std::unique(roots.begin(), roots.end()), roots.end());
+
+    // extremum
+    if(roots.empty()) {
+      parents[v] = v;
+      extrema[v] = v;
+      continue;
+    }
+
+    // the component of the oldest extremum survives (elder rule), the
+    // others die at v
+    SimplexId oldest = roots[0];
+    for(const SimplexId root : roots)
+      if(isOlder(extrema[root], extrema[oldest]))
+        oldest = root;
+
+    for(const SimplexId root : roots) {
+      if(root != oldest) {
+        const scalarType persistence = getPersistence(extrema[root], v);
+        if(persistence >= threshold)
+          pairs.emplace_back(extrema[root], v, persistence);
+        parents[root] = oldest;
+      }
+    }
+    parents[v] = oldest;
+  }
+
+  // global extremum, paired with the last vertex
+  const SimplexId globalExtremum = extrema[find(v)];
+  pairs.emplace_back(globalExtremum, v, getPersistence(globalExtremum, v));
+
+  std::sort(pairs.begin(), pairs.end(),
+            [](const std::tuple<SimplexId, SimplexId, scalarType> &a,
+               const std::tuple<SimplexId, SimplexId, scalarType> &b) {
+              return std::get<2>(a) < std::get<2>(b);
+            });
+
+  return 0;
+}
+
+template <typename scalarType>
+int ttk::PersistenceDiagram::computeUnionFindPersistenceDiagram(
+  const std::vector<
+    std::tuple<ttk::SimplexId, ttk::SimplexId, scalarType, bool>> &pairs,
+  std::vector<std::tuple<ttk::SimplexId,
+                         ttk::CriticalType,
+                         ttk::SimplexId,
+                         ttk::CriticalType,
+                         scalarType,
+                         ttk::SimplexId>> &diagram,
+  const SimplexId globalMinimum,
+  const SimplexId globalMaximum) const {
+  const ttk::SimplexId numberOfPairs = pairs.size();
+  diagram.resize(numberOfPairs);
+  for(ttk::SimplexId i = 0; i < numberOfPairs; ++i) {
+    const ttk::SimplexId v0 = std::get<0>(pairs[i]);
+    const ttk::SimplexId v1 = std::get<1>(pairs[i]);
+    const scalarType persistenceValue = std::get<2>(pairs[i]);
+    const bool type = std::get<3>(pairs[i]);
+
+    // same types as the tree nodes in computeCTPersistenceDiagram()
+    std::get<4>(diagram[i]) = persistenceValue;
+    if(type == true) {
+      std::get<0>(diagram[i]) = v0;
+      std::get<1>(diagram[i]) = ttk::CriticalType::Local_minimum;
+      std::get<2>(diagram[i]) = v1;
+      std::get<3>(diagram[i]) = (v1 == globalMaximum)
+                                  ? ttk::CriticalType::Local_maximum
+                                  : ttk::CriticalType::Saddle1;
+      std::get<5>(diagram[i]) = 0;
+    } else {
+      std::get<0>(diagram[i]) = v1;
+      std::get<1>(diagram[i]) = (v1 == globalMinimum)
+                                  ? ttk::CriticalType::Local_minimum
+                                  : ttk::CriticalType::Saddle2;
+      std::get<2>(diagram[i]) = v0;
+      std::get<3>(diagram[i]) = ttk::CriticalType::Local_maximum;
+      std::get<5>(diagram[i]) = 2;
+    }
+  }
+
+  return 0;
+}
+
 template <typename scalarType, typename idType>
 int ttk::PersistenceDiagram::execute() const {
 
@@ -219,41 +403,97 @@ int ttk::PersistenceDiagram::execute() const {
   SimplexId *offsets = static_cast<SimplexId *>(inputOffsets_);
 
   const ttk::SimplexId numberOfVertices = triangulation_->getNumberOfVertices();
-  // convert offsets into a valid format for contour forests
-  std::vector<ttk::SimplexId> voffsets(numberOfVertices);
-  std::copy(offsets, offsets + numberOfVertices, voffsets.begin());
+  const int dimensionality = triangulation_->getDimensionality();
+
+  // the saddle-saddle pairs need all the extremum-saddle pairs, which are
+  // then pruned after their computation
+  const bool computeSaddleConnectors
+    = dimensionality == 3 and ComputeSaddleConnectors;
+  const double treeThreshold
+    = computeSaddleConnectors ? 0 : PersistenceThreshold;
 
-  // get contour tree
   ftm::FTMTreePP contourTree;
-  contourTree.setupTriangulation(triangulation_, false);
-  contourTree.setVertexScalars(inputScalars_);
-  contourTree.setTreeType(ftm::TreeType::Join_Split);
-  contourTree.setVertexSoSoffsets(voffsets.data());
-  contourTree.setThreadNumber(threadNumber_);
-  contourTree.setDebugLevel(debugLevel_);
-  contourTree.setSegmentation(false);
-  contourTree.build<scalarType, idType>();
-
-  // get persistence pairs
+  std::shared_ptr<const VertexOrder> order;
   std::vector<std::tuple<ttk::SimplexId, ttk::SimplexId, scalarType>> JTPairs;
   std::vector<std::tuple<ttk::SimplexId, ttk::SimplexId, scalarType>> STPairs;
-  contourTree.computePersistencePairs<scalarType>(JTPairs, true);
-  contourTree.computePersistencePairs<scalarType>(STPairs, false);
 
-  // merge pairs
+  if(UseUnionFind) {
+    Timer t;
+
+    order = triangulation_->getVertexOrder(
+      scalars, static_cast<const idType *>(inputOffsets_), threadNumber_);
+    if(!order) {
+      std::stringstream msg;
+      msg << "[PersistenceDiagram] Could not sort the vertices." << std::endl;
+      dMsg(std::cerr, msg.str(), fatalMsg);
+      return -1;
+    }
+
+    // get persistence pairs, one sweep per tree
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel sections num_threads(2) if(threadNumber_ > 1)
+#endif
+    {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp section
+#endif
+      computeUnionFindPairs<scalarType>(order->getSortedVertices(),
+                                        order->getVertexRanks(), true, JTPairs,
+                                        treeThreshold);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp section
+#endif
+      computeUnionFindPairs<scalarType>(order->getSortedVertices(),
+                                        order->getVertexRanks(), false,
+                                        STPairs, treeThreshold);
+    }
+
+    {
+      std::stringstream msg;
+      msg << "[PersistenceDiagram] Union-find pairs computed in "
+          << t.getElapsedTime() << " s." << std::endl;
+      dMsg(std::cout, msg.str(), timeMsg);
+    }
+  } else {
+    // convert offsets into a valid format for contour forests
+    std::vector<ttk::SimplexId> voffsets(numberOfVertices);
+    std::copy(offsets, offsets + numberOfVertices, voffsets.begin());
+
+    // get contour tree
+    contourTree.setupTriangulation(triangulation_, false);
+    contourTree.setVertexScalars(inputScalars_);
+    contourTree.setTreeType(ftm::TreeType::Join_Split);
+    contourTree.setVertexSoSoffsets(voffsets.data());
+    contourTree.setThreadNumber(threadNumber_);
+    contourTree.setDebugLevel(debugLevel_);
+    contourTree.setSegmentation(false);
+    if(contourTree.build<scalarType, idType>())
+      return -1;
+
+    // get persistence pairs
+    contourTree.computePersistencePairs<scalarType>(
+      JTPairs, true, treeThreshold);
+    contourTree.computePersistencePairs<scalarType>(
+      STPairs, false, treeThreshold);
+  }
+
+  // merge pairs, keeping the global extrema pair (last of each list)
   std::vector<std::tuple<ttk::SimplexId, ttk::SimplexId, scalarType, bool>>
-    CTPairs(JTPairs.size() + STPairs.size());
+    CTPairs;
+  CTPairs.reserve(JTPairs.size() + STPairs.size());
   const ttk::SimplexId JTSize = JTPairs.size();
   for(ttk::SimplexId i = 0; i < JTSize; ++i) {
     const auto &x = JTPairs[i];
-    CTPairs[i]
-      = std::make_tuple(std::get<0>(x), std::get<1>(x), std::get<2>(x), true);
+    if(i == JTSize - 1 or std::get<2>(x) >= PersistenceThreshold)
+      CTPairs.emplace_back(
+        std::get<0>(x), std::get<1>(x), std::get<2>(x), true);
   }
   const ttk::SimplexId STSize = STPairs.size();
   for(ttk::SimplexId i = 0; i < STSize; ++i) {
     const auto &x = STPairs[i];
-    CTPairs[JTSize + i]
-      = std::make_tuple(std::get<0>(x), std::get<1>(x), std::get<2>(x), false);
+    if(i == STSize - 1 or std::get<2>(x) >= PersistenceThreshold)
+      CTPairs.emplace_back(
+        std::get<0>(x), std::get<1>(x), std::get<2>(x), false);
   }
 
   // remove the last pair which is present two times (global extrema pair)
@@ -272,8 +512,7 @@ int ttk::PersistenceDiagram::execute() const {
   // get the saddle-saddle pairs
   std::vector<std::tuple<SimplexId, SimplexId, scalarType>>
     pl_saddleSaddlePairs;
-  const int dimensionality = triangulation_->getDimensionality();
-  if(dimensionality == 3 and ComputeSaddleConnectors) {
+  if(computeSaddleConnectors) {
     MorseSmaleComplex3D morseSmaleComplex;
     morseSmaleComplex.setDebugLevel(debugLevel_);
     morseSmaleComplex.setThreadNumber(threadNumber_);
@@ -281,15 +520,20 @@ int ttk::PersistenceDiagram::execute() const {
     morseSmaleComplex.setInputScalarField(inputScalars_);
     morseSmaleComplex.setInputOffsets(inputOffsets_);
     morseSmaleComplex.computePersistencePairs<scalarType, idType>(
-      JTPairs, STPairs, pl_saddleSaddlePairs);
+      JTPairs, STPairs, pl_saddleSaddlePairs, PersistenceThreshold);
   }
 
   // get persistence diagrams
-  computeCTPersistenceDiagram<scalarType>(
-    contourTree, CTPairs, CTDiagram, scalars);
+  if(UseUnionFind)
+    computeUnionFindPersistenceDiagram<scalarType>(
+      CTPairs, CTDiagram, order->getSortedVertices().front(),
+      order->getSortedVertices().back());
+  else
+    computeCTPersistenceDiagram<scalarType>(
+      contourTree, CTPairs, CTDiagram, scalars);
 
   // add saddle-saddle pairs to the diagram if needed
-  if(dimensionality == 3 and ComputeSaddleConnectors) {
+  if(computeSaddleConnectors) {
     for(const auto &i : pl_saddleSaddlePairs) {
       const ttk::SimplexId v0 = std::get<0>(i);
       const ttk::SimplexId v1 = std::get<1>(i);
@@ -37,6 +37,7 @@ namespace ttk {
       use_progressive_ = true;
       forceUseOfAlgorithm_ = false;
       deterministic_ = true;
+      use_jacobi_ = false;
       time_limit_ = std::numeric_limits<double>::max();
       epsilon_min_ = 1e-8;
       epsilon_.resize(3);
@@ -180,6 +181,13 @@ namespace ttk {
       use_kdtree_ = use_kdtree;
     }
 
+    // the distances computed by the clustering itself (not by the
+    // barycenters) run one after the other: each of them may use all the
+    // threads with the Jacobi auction
+    inline void setUseJacobi(const bool use_jacobi) {
+      use_jacobi_ = use_jacobi;
+    }
+
     inline void setAccelerated(const bool use_accelerated) {
       use_accelerated_ = use_accelerated;
     }
@@ -283,6 +291,7 @@ namespace ttk {
     bool use_accelerated_;
     bool use_kmeanspp_;
     bool use_kdtree_;
+    bool use_jacobi_;
     double time_limit_;
 
     dataType epsilon_min_;
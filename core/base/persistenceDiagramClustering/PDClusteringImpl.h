@@ -964,6 +964,8 @@ dataType PDClustering<dataType>::computeDistance(BidderDiagram<dataType> D1,
   D2 = centroidWithZeroPrices(D2);
   Auction<dataType> auction(
     wasserstein_, geometrical_factor_, lambda_, delta_lim, use_kdtree_);
+  auction.setThreadNumber(threadNumber_);
+  auction.setUseJacobi(use_jacobi_ && threadNumber_ > 1);
   auction.BuildAuctionDiagrams(&D1, &D2);
   dataType cost = auction.run(&matchings);
   return cost;
@@ -976,6 +978,8 @@ dataType PDClustering<dataType>::computeDistance(BidderDiagram<dataType> *D1,
   std::vector<matchingTuple> matchings;
   Auction<dataType> auction(
     wasserstein_, geometrical_factor_, lambda_, delta_lim, use_kdtree_);
+  auction.setThreadNumber(threadNumber_);
+  auction.setUseJacobi(use_jacobi_ && threadNumber_ > 1);
   int size1 = D1->size();
   auction.BuildAuctionDiagrams(D1, D2);
   dataType cost = auction.run(&matchings);
@@ -0,0 +1,248 @@
+/// \ingroup base
+/// \class ttk::PDMiniBatchClustering
+///
+/// \brief Mini-batch K-Means clustering of a large set of persistence diagrams.
+///
+/// Instead of matching every diagram to every centroid at each iteration,
+/// the centroids are updated from random batches of diagrams: each diagram
+/// of a batch is assigned to its closest centroid by an Auction, and each
+/// centroid point keeps the running average of the points matched to it (its
+/// diagonal projection when unmatched) over the diagrams of its cluster seen
+/// since its creation. The diagram points matched to the diagonal give birth
+/// to new centroid points, the size of a centroid being bounded by the size
+/// of the largest diagram seen. A cluster left without diagrams for several
+/// iterations is re-seeded with the worst represented diagram of the batch.
+///
+/// Only the diagrams of the current batch are kept in memory: they can be
+/// read from disk on demand by a diagram reader, the diagrams of a batch
+/// being read in parallel. A final pass assigns every diagram to its
+/// cluster, batch after batch.
+///
+/// With the progressive option, the diagrams are first restricted to their
+/// most persistent pairs, the threshold decreasing at each iteration. As in
+/// PDClustering, the diagrams are complete after 10% of the time limit and
+/// the iterations stop after 90% of it.
+///
+/// \sa PersistenceDiagramClustering, PDClustering
+
+#ifndef _PDMINIBATCHCLUSTERING_H
+#define _PDMINIBATCHCLUSTERING_H
+
+#include <Auction.h>
+
+#include <array>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace ttk {
+  template <typename dataType>
+  class PDMiniBatchClustering : public Debug {
+
+  public:
+    /// Loads the diagram of the given index. Returns 0 upon success. The
+    /// diagrams of a batch are loaded in parallel: the reader is called
+    /// concurrently by up to threadNumber_ threads.
+    typedef std::function<int(const int, std::vector<diagramTuple> &)>
+      DiagramReader;
+
+    PDMiniBatchClustering() {
+      wasserstein_ = 2;
+      geometrical_factor_ = 1;
+      lambda_ = 1;
+      deltaLim_ = 0.01;
+      k_ = 1;
+      batchSize_ = 100;
+      maxNoImprovement_ = 10;
+      maxEpochs_ = 100;
+      pairTypeClustering_ = -1;
+      use_progressive_ = true;
+      use_kmeanspp_ = false;
+      deterministic_ = true;
+      time_limit_ = std::numeric_limits<double>::max();
+      inputDiagrams_ = NULL;
+      numberOfInputs_ = 0;
+      threadNumber_ = 1;
+      cost_ = 0;
+      n_iterations_ = 0;
+    };
+
+    ~PDMiniBatchClustering(){};
+
+    /// Clusters the diagrams, fills the centroids and, if not NULL, the
+    /// matchings of each diagram to its centroid (indexed by cluster and
+    /// diagram, with the pair indices of the input diagrams).
+    /// \return Returns the cluster of each diagram, empty upon failure.
+    std::vector<int>
+      execute(std::vector<std::vector<diagramTuple>> &final_centroids,
+              std::vector<std::vector<std::vector<matchingTuple>>>
+                *all_matchings);
+
+    inline int setDiagrams(std::vector<std::vector<diagramTuple>> *data) {
+      inputDiagrams_ = data;
+      return 0;
+    }
+
+    /// Takes precedence over setDiagrams().
+    inline int setDiagramReader(const DiagramReader &reader) {
+      reader_ = reader;
+      return 0;
+    }
+
+    inline int setNumberOfInputs(int numberOfInputs) {
+      numberOfInputs_ = numberOfInputs;
+      return 0;
+    }
+
+    inline int setK(const int k) {
+      k_ = k;
+      return 0;
+    }
+
+    inline void setBatchSize(const int batchSize) {
+      batchSize_ = batchSize;
+    }
+
+    inline void setWasserstein(const int &wasserstein) {
+      wasserstein_ = wasserstein;
+    }
+
+    inline void setUseProgressive(const bool use_progressive) {
+      use_progressive_ = use_progressive;
+    }
+
+    inline void setKMeanspp(const bool use_kmeanspp) {
+      use_kmeanspp_ = use_kmeanspp;
+    }
+
+    inline void setTimeLimit(const double time_limit) {
+      time_limit_ = time_limit;
+    }
+
+    inline void setGeometricalFactor(const double geometrical_factor) {
+      geometrical_factor_ = geometrical_factor;
+    }
+
+    inline void setLambda(const double lambda) {
+      lambda_ = lambda;
+    }
+
+    inline void setDeltaLim(const double deltaLim) {
+      deltaLim_ = deltaLim;
+    }
+
+    inline void setDeterministic(const bool deterministic) {
+      deterministic_ = deterministic;
+    }
+
+    // 0: min-saddle pairs, 1: saddle-saddle pairs, 2: saddle-max pairs,
+    // else: all pairs
+    inline void setPairTypeClustering(const int pairTypeClustering) {
+      pairTypeClustering_ = pairTypeClustering;
+    }
+
+    /// Sum over the diagrams of the distance to their centroid (to the power
+    /// of the Wasserstein metric), as of the final pass.
+    inline dataType getCost() const {
+      return cost_;
+    }
+
+    inline int getNumberOfIterations() const {
+      return n_iterations_;
+    }
+
+    inline std::vector<std::vector<int>> get_centroids_sizes() const {
+      return centroids_sizes_;
+    }
+
+  protected:
+    // a diagram split by pair type (min-saddle, saddle-saddle, saddle-max)
+    struct SplitDiagram {
+      std::array<BidderDiagram<dataType>, 3> bidders;
+      // index of each bidder in the input diagram
+      std::array<std::vector<int>, 3> ids;
+    };
+
+    typedef std::array<std::vector<matchingTuple>, 3> SplitMatchings;
+
+    int loadDiagram(const int i, std::vector<diagramTuple> &diagram);
+    int loadDiagrams(const std::vector<int> &ids,
+                     std::vector<std::vector<diagramTuple>> &diagrams);
+    void splitDiagram(std::vector<diagramTuple> &diagram,
+                      SplitDiagram &split,
+                      const dataType minPersistence);
+    int loadBatch(const std::vector<int> &ids,
+                  std::vector<SplitDiagram> &batch);
+
+    dataType computeDistance(SplitDiagram &diagram,
+                             const int c,
+                             SplitMatchings *matchings);
+    int assignDiagram(SplitDiagram &diagram,
+                      dataType &cost,
+                      SplitMatchings *matchings);
+    void assignBatch(std::vector<SplitDiagram> &batch,
+                     std::vector<int> &assignment,
+                     std::vector<dataType> &costs,
+                     std::vector<SplitMatchings> &matchings);
+
+    GoodDiagram<dataType> diagramToCentroid(BidderDiagram<dataType> &diagram);
+    int initializeCentroids(std::vector<SplitDiagram> &sample,
+                            std::mt19937 &generator);
+    int reseedClusters(std::vector<SplitDiagram> &batch,
+                       std::vector<int> &assignment,
+                       const std::vector<dataType> &costs);
+    void updateCentroids(std::vector<SplitDiagram> &batch,
+                         const std::vector<int> &assignment,
+                         const std::vector<SplitMatchings> &matchings);
+    void pruneCentroid(GoodDiagram<dataType> &centroid,
+                       std::vector<double> &weights,
+                       const int maxSize);
+    void buildFinalCentroids(
+      std::vector<std::vector<diagramTuple>> &final_centroids);
+
+    int wasserstein_;
+    double geometrical_factor_;
+    double lambda_;
+    double deltaLim_;
+    int k_;
+    int batchSize_;
+    // stop after this number of iterations without improvement of the
+    // smoothed batch cost (or re-seed a cluster left without diagrams), or
+    // after this number of passes over the inputs
+    int maxNoImprovement_;
+    int maxEpochs_;
+    int pairTypeClustering_;
+    bool use_progressive_;
+    bool use_kmeanspp_;
+    bool deterministic_;
+    double time_limit_;
+
+    int numberOfInputs_;
+    std::vector<std::vector<diagramTuple>> *inputDiagrams_;
+    DiagramReader reader_;
+
+    std::array<bool, 3> doType_;
+    std::array<bool, 3> seenType_;
+    // largest number of pairs of each type in a diagram seen so far
+    std::array<int, 3> maxSize_;
+    // progressive persistence threshold (0: complete diagrams)
+    dataType rho_;
+    dataType lowestPersistence_;
+    dataType highestPersistence_;
+
+    // per pair type, per cluster
+    std::array<std::vector<GoodDiagram<dataType>>, 3> centroids_;
+    // per centroid point, number of diagrams it is averaged over
+    std::array<std::vector<std::vector<double>>, 3> weights_;
+    // last iteration at which each cluster was given a diagram
+    std::vector<int> lastAssigned_;
+    std::vector<std::vector<int>> centroids_sizes_;
+
+    dataType cost_;
+    int n_iterations_;
+  };
+} // namespace ttk
+
+#include <PDMiniBatchClusteringImpl.h>
+#endif
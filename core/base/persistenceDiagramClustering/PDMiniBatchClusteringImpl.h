@@ -0,0 +1,679 @@
+/// \ingroup base
+/// \class ttk::PDMiniBatchClustering
+///
+/// \sa PDMiniBatchClustering
+
+#ifndef _PDMINIBATCHCLUSTERINGIMPL_H
+#define _PDMINIBATCHCLUSTERINGIMPL_H
+
+#include <algorithm>
+#include <numeric>
+
+template <typename dataType>
+std::vector<int> ttk::PDMiniBatchClustering<dataType>::execute(
+  std::vector<std::vector<diagramTuple>> &final_centroids,
+  std::vector<std::vector<std::vector<matchingTuple>>> *all_matchings) {
+
+  Timer tm;
+  std::vector<int> inv_clustering;
+
+  if(numberOfInputs_ <= 0 || k_ <= 0 || k_ > numberOfInputs_
+     || (!reader_ && !inputDiagrams_)) {
+    std::stringstream msg;
+    msg << "[PersistenceDiagramClustering] Cannot cluster " << numberOfInputs_
+        << " diagrams in " << k_ << " clusters." << std::endl;
+    dMsg(std::cerr, msg.str(), fatalMsg);
+    return inv_clustering;
+  }
+
+  for(int t = 0; t < 3; ++t) {
+    doType_[t] = (pairTypeClustering_ < 0 || pairTypeClustering_ > 2
+                  || pairTypeClustering_ == t);
+    seenType_[t] = false;
+    maxSize_[t] = 0;
+  }
+  rho_ = 0;
+  lowestPersistence_ = std::numeric_limits<dataType>::max();
+  highestPersistence_ = 0;
+  cost_ = 0;
+  n_iterations_ = 0;
+
+  const int batchSize = std::min(std::max(batchSize_, 1), numberOfInputs_);
+
+  std::mt19937 generator(deterministic_ ? 0 : std::random_device()());
+  std::vector<int> order(numberOfInputs_);
+  std::iota(order.begin(), order.end(), 0);
+  std::shuffle(order.begin(), order.end(), generator);
+
+  // 1. initial sample, large enough to pick the k initial centroids
+  const int sampleSize = std::max(batchSize, k_);
+  std::vector<SplitDiagram> batch(sampleSize);
+  {
+    std::vector<std::vector<diagramTuple>> sample;
+    if(loadDiagrams(
+         std::vector<int>(order.begin(), order.begin() + sampleSize), sample)) {
+      return inv_clustering;
+    }
+    for(int i = 0; i < sampleSize; ++i) {
+      for(const auto &t : sample[i]) {
+        highestPersistence_ = std::max(highestPersistence_, std::get<4>(t));
+      }
+    }
+    if(use_progressive_) {
+      rho_ = highestPersistence_ / 2;
+    }
+    for(int i = 0; i < sampleSize; ++i) {
+      splitDiagram(sample[i], batch[i], rho_);
+    }
+  }
+  initializeCentroids(batch, generator);
+
+  // 2. mini-batch iterations
+  const int maxIterations
+    = maxEpochs_ * ((numberOfInputs_ + batchSize - 1) / batchSize);
+  const dataType ewaAlpha
+    = std::min(1.0, 2.0 * batchSize / (numberOfInputs_ + 1));
+  dataType ewaCost = 0;
+  dataType bestEwaCost = std::numeric_limits<dataType>::max();
+  bool ewaInitialized = false;
+  int noImprovement = 0;
+  int position = sampleSize;
+
+  std::vector<int> ids;
+  std::vector<int> assignment;
+  std::vector<dataType> costs;
+  std::vector<SplitMatchings> matchings;
+
+  while(n_iterations_ < maxIterations) {
+    if(position + batchSize > numberOfInputs_) {
+      std::shuffle(order.begin(), order.end(), generator);
+      position = 0;
+    }
+    ids.assign(order.begin() + position, order.begin() + position + batchSize);
+    position += batchSize;
+
+    if(loadBatch(ids, batch)) {
+      return inv_clustering;
+    }
+    assignBatch(batch, assignment, costs, matchings);
+    if(reseedClusters(batch, assignment, costs)) {
+      noImprovement = 0;
+    }
+    updateCentroids(batch, assignment, matchings);
+    n_iterations_++;
+
+    const dataType batchCost
+      = std::accumulate(costs.begin(), costs.end(), (dataType)0) / batchSize;
+    const double elapsed = tm.getElapsedTime();
+
+    if(rho_ > 0) {
+      // the costs of incomplete diagrams are not compared
+      rho_ /= 2;
+      if(rho_ < lowestPersistence_ || elapsed > 0.1 * time_limit_) {
+        rho_ = 0;
+      }
+    } else {
+      ewaCost = ewaInitialized
+                  ? (1 - ewaAlpha) * ewaCost + ewaAlpha * batchCost
+                  : batchCost;
+      ewaInitialized = true;
+      if(ewaCost < bestEwaCost) {
+        bestEwaCost = ewaCost;
+        noImprovement = 0;
+      } else {
+        noImprovement++;
+      }
+    }
+
+    {
+      std::stringstream msg;
+      msg << "[PersistenceDiagramClustering] Iteration " << n_iterations_
+          << ", batch cost " << batchCost << ", persistence threshold "
+          << rho_ << "." << std::endl;
+      dMsg(std::cout, msg.str(), advancedInfoMsg);
+    }
+
+    if(noImprovement >= maxNoImprovement_ || elapsed > 0.9 * time_limit_) {
+      break;
+    }
+  }
+
+  buildFinalCentroids(final_centroids);
+
+  // 3. final pass, assigning every diagram to its closest centroid
+  rho_ = 0;
+  inv_clustering.resize(numberOfInputs_);
+  if(all_matchings) {
+    all_matchings->resize(k_);
+    for(int c = 0; c < k_; ++c) {
+      all_matchings->at(c).clear();
+      all_matchings->at(c).resize(numberOfInputs_);
+    }
+  }
+
+  for(int start = 0; start < numberOfInputs_; start += batchSize) {
+    ids.resize(std::min(batchSize, numberOfInputs_ - start));
+    std::iota(ids.begin(), ids.end(), start);
+
+    if(loadBatch(ids, batch)) {
+      inv_clustering.clear();
+      return inv_clustering;
+    }
+    assignBatch(batch, assignment, costs, matchings);
+
+    for(size_t i = 0; i < ids.size(); ++i) {
+      const int c = assignment[i];
+      inv_clustering[ids[i]] = c;
+      cost_ += costs[i];
+      if(!all_matchings) {
+        continue;
+      }
+      int offset = 0;
+      for(int t = 0; t < 3; ++t) {
+        if(!doType_[t]) {
+          continue;
+        }
+        const int size = batch[i].bidders[t].size();
+        for(matchingTuple m : matchings[i][t]) {
+          const int bidder_id = std::get<0>(m);
+          const int good_id = std::get<1>(m);
+          // the matchings to the diagonal have no centroid point to refer to
+          if(bidder_id < 0 || bidder_id >= size || good_id < 0) {
+            continue;
+          }
+          std::get<0>(m) = batch[i].ids[t][bidder_id];
+          std::get<1>(m) = good_id + offset;
+          all_matchings->at(c)[ids[i]].push_back(m);
+        }
+        offset += centroids_[t][c].size();
+      }
+    }
+  }
+
+  {
+    std::stringstream msg;
+    msg << "[PersistenceDiagramClustering] Mini-batch clustering: "
+        << n_iterations_ << " iteration(s) of " << batchSize
+        << " diagram(s), final cost " << cost_ << "." << std::endl;
+    dMsg(std::cout, msg.str(), infoMsg);
+  }
+
+  return inv_clustering;
+}
+
+template <typename dataType>
+int ttk::PDMiniBatchClustering<dataType>::loadDiagram(
+  const int i, std::vector<diagramTuple> &diagram) {
+  if(reader_) {
+    return reader_(i, diagram);
+  }
+  if(!inputDiagrams_ || i < 0 || i >= (int)inputDiagrams_->size()) {
+    return -1;
+  }
+  diagram = (*inputDiagrams_)[i];
+  return 0;
+}
+
+template <typename dataType>
+void ttk::PDMiniBatchClustering<dataType>::splitDiagram(
+  std::vector<diagramTuple> &diagram,
+  SplitDiagram &split,
+  const dataType minPersistence) {
+
+  for(int t = 0; t < 3; ++t) {
+    split.bidders[t] = BidderDiagram<dataType>();
+    split.ids[t].clear();
+  }
+
+  for(int j = 0; j < (int)diagram.size(); ++j) {
+    diagramTuple &t = diagram[j];
+    const CriticalType nt1 = std::get<1>(t);
+    const CriticalType nt2 = std::get<3>(t);
+    const dataType dt = std::get<4>(t);
+    if(!(dt > 0)) {
+      continue;
+    }
+    lowestPersistence_ = std::min(lowestPersistence_, dt);
+    if(dt < minPersistence) {
+      continue;
+    }
+
+    auto addPair = [&](const int type) {
+      if(!doType_[type]) {
+        return;
+      }
+      BidderDiagram<dataType> &bidders = split.bidders[type];
+      Bidder<dataType> b(t, bidders.size(), lambda_);
+      b.setPositionInAuction(bidders.size());
+      bidders.addBidder(b);
+      split.ids[type].push_back(j);
+      seenType_[type] = true;
+    };
+
+    // same pair types as PersistenceDiagramClustering
+    if(nt1 == CriticalType::Local_minimum
+       && nt2 == CriticalType::Local_maximum) {
+      addPair(2);
+    } else {
+      if(nt1 == CriticalType::Local_maximum
+         || nt2 == CriticalType::Local_maximum) {
+        addPair(2);
+      }
+      if(nt1 == CriticalType::Local_minimum
+         || nt2 == CriticalType::Local_minimum) {
+        addPair(0);
+      }
+      if((nt1 == CriticalType::Saddle1 && nt2 == CriticalType::Saddle2)
+         || (nt1 == CriticalType::Saddle2 && nt2 == CriticalType::Saddle1)) {
+        addPair(1);
+      }
+    }
+  }
+
+  for(int t = 0; t < 3; ++t) {
+    maxSize_[t] = std::max(maxSize_[t], split.bidders[t].size());
+  }
+}
+
+template <typename dataType>
+int ttk::PDMiniBatchClustering<dataType>::loadDiagrams(
+  const std::vector<int> &ids,
+  std::vector<std::vector<diagramTuple>> &diagrams) {
+
+  // the diagrams are read concurrently, the first failure is reported
+  const int nbDiagrams = ids.size();
+  diagrams.resize(nbDiagrams);
+  int failed = nbDiagrams;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#endif
+  for(int i = 0; i < nbDiagrams; ++i) {
+    if(loadDiagram(ids[i], diagrams[i])) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp critical(ttkPDMiniBatchClusteringLoad)
+#endif
+      failed = std::min(failed, i);
+    }
+  }
+
+  if(failed < nbDiagrams) {
+    std::stringstream msg;
+    msg << "[PersistenceDiagramClustering] Cannot load diagram "
+        << ids[failed] << "." << std::endl;
+    dMsg(std::cerr, msg.str(), fatalMsg);
+    return -1;
+  }
+  return 0;
+}
+
+template <typename dataType>
+int ttk::PDMiniBatchClustering<dataType>::loadBatch(
+  const std::vector<int> &ids, std::vector<SplitDiagram> &batch) {
+
+  std::vector<std::vector<diagramTuple>> diagrams;
+  if(loadDiagrams(ids, diagrams)) {
+    return -1;
+  }
+  // the splits update the statistics of the pairs seen so far
+  batch.resize(ids.size());
+  for(size_t i = 0; i < ids.size(); ++i) {
+    splitDiagram(diagrams[i], batch[i], rho_);
+  }
+  return 0;
+}
+
+template <typename dataType>
+dataType ttk::PDMiniBatchClustering<dataType>::computeDistance(
+  SplitDiagram &diagram, const int c, SplitMatchings *matchings) {
+
+  dataType cost = 0;
+  for(int t = 0; t < 3; ++t) {
+    if(matchings) {
+      (*matchings)[t].clear();
+    }
+    if(!doType_[t]) {
+      continue;
+    }
+    // the Auction adds diagonal bidders and updates the prices: copies
+    BidderDiagram<dataType> bidders = diagram.bidders[t];
+    GoodDiagram<dataType> goods = centroids_[t][c];
+    std::vector<matchingTuple> m;
+    Auction<dataType> auction(
+      wasserstein_, geometrical_factor_, lambda_, deltaLim_, true);
+    auction.BuildAuctionDiagrams(&bidders, &goods);
+    cost += auction.run(&m);
+    if(matchings) {
+      (*matchings)[t].swap(m);
+    }
+  }
+  return cost;
+}
+
+template <typename dataType>
+int ttk::PDMiniBatchClustering<dataType>::assignDiagram(
+  SplitDiagram &diagram, dataType &cost, SplitMatchings *matchings) {
+
+  int cluster = 0;
+  cost = std::numeric_limits<dataType>::max();
+  SplitMatchings current;
+  for(int c = 0; c < k_; ++c) {
+    const dataType distance
+      = computeDistance(diagram, c, matchings ? &current : NULL);
+    if(distance < cost) {
+      cost = distance;
+      cluster = c;
+      if(matchings) {
+        std::swap(*matchings, current);
+      }
+    }
+  }
+  return cluster;
+}
+
+template <typename dataType>
+void ttk::PDMiniBatchClustering<dataType>::assignBatch(
+  std::vector<SplitDiagram> &batch,
+  std::vector<int> &assignment,
+  std::vector<dataType> &costs,
+  std::vector<SplitMatchings> &matchings) {
+
+  const int batchSize = batch.size();
+  assignment.resize(batchSize);
+  costs.resize(batchSize);
+  matchings.resize(batchSize);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#endif
+  for(int i = 0; i < batchSize; ++i) {
+    assignment[i] = assignDiagram(batch[i], costs[i], &matchings[i]);
+  }
+}
+
+template <typename dataType>
+GoodDiagram<dataType> ttk::PDMiniBatchClustering<dataType>::diagramToCentroid(
+  BidderDiagram<dataType> &diagram) {
+  GoodDiagram<dataType> GD;
+  for(int i = 0; i < diagram.size(); i++) {
+    Bidder<dataType> &b = diagram.get(i);
+    Good<dataType> g(b.x_, b.y_, false, GD.size());
+    g.SetCriticalCoordinates(b.coords_x_, b.coords_y_, b.coords_z_);
+    GD.addGood(g);
+  }
+  return GD;
+}
+
+template <typename dataType>
+int ttk::PDMiniBatchClustering<dataType>::initializeCentroids(
+  std::vector<SplitDiagram> &sample, std::mt19937 &generator) {
+
+  const int sampleSize = sample.size();
+  for(int t = 0; t < 3; ++t) {
+    centroids_[t].clear();
+    weights_[t].clear();
+  }
+  lastAssigned_.assign(k_, 0);
+
+  auto addCentroid = [&](const int i) {
+    for(int t = 0; t < 3; ++t) {
+      centroids_[t].push_back(diagramToCentroid(sample[i].bidders[t]));
+      weights_[t].push_back(
+        std::vector<double>(sample[i].bidders[t].size(), 1));
+    }
+  };
+
+  // the sample is already in random order
+  if(!use_kmeanspp_) {
+    for(int c = 0; c < k_; ++c) {
+      addCentroid(c);
+    }
+    return 0;
+  }
+
+  // KMeans++ within the sample
+  std::vector<bool> isCentroid(sampleSize, false);
+  std::vector<dataType> minDistance(
+    sampleSize, std::numeric_limits<dataType>::max());
+  int candidate = 0;
+  for(int c = 0; c < k_; ++c) {
+    addCentroid(candidate);
+    isCentroid[candidate] = true;
+    if(c == k_ - 1) {
+      break;
+    }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#endif
+    for(int i = 0; i < sampleSize; ++i) {
+      if(!isCentroid[i]) {
+        minDistance[i]
+          = std::min(minDistance[i], computeDistance(sample[i], c, NULL));
+      }
+    }
+
+    std::vector<double> probabilities(sampleSize, 0);
+    double total = 0;
+    for(int i = 0; i < sampleSize; ++i) {
+      if(!isCentroid[i]) {
+        probabilities[i] = pow(minDistance[i], 2);
+        total += probabilities[i];
+      }
+    }
+    if(total > 0) {
+      std::discrete_distribution<int> distribution(
+        probabilities.begin(), probabilities.end());
+      candidate = distribution(generator);
+    } else {
+      candidate = std::find(isCentroid.begin(), isCentroid.end(), false)
+                  - isCentroid.begin();
+    }
+  }
+  return 0;
+}
+
+template <typename dataType>
+int ttk::PDMiniBatchClustering<dataType>::reseedClusters(
+  std::vector<SplitDiagram> &batch,
+  std::vector<int> &assignment,
+  const std::vector<dataType> &costs) {
+
+  const int batchSize = batch.size();
+  std::vector<int> byCost(batchSize);
+  std::iota(byCost.begin(), byCost.end(), 0);
+  std::stable_sort(byCost.begin(), byCost.end(), [&](const int a, const int b) {
+    return costs[a] > costs[b];
+  });
+
+  int reseeded = 0;
+  for(int c = 0; c < k_ && reseeded < batchSize; ++c) {
+    if(std::find(assignment.begin(), assignment.end(), c)
+       != assignment.end()) {
+      lastAssigned_[c] = n_iterations_;
+      continue;
+    }
+    if(n_iterations_ - lastAssigned_[c] < maxNoImprovement_) {
+      continue;
+    }
+    // the diagram is the new centroid: it is left out of the update
+    const int i = byCost[reseeded++];
+    for(int t = 0; t < 3; ++t) {
+      centroids_[t][c] = diagramToCentroid(batch[i].bidders[t]);
+      weights_[t][c].assign(batch[i].bidders[t].size(), 1);
+    }
+    assignment[i] = -1;
+    lastAssigned_[c] = n_iterations_;
+
+    std::stringstream msg;
+    msg << "[PersistenceDiagramClustering] Cluster " << c
+        << " re-seeded at iteration " << n_iterations_ << "." << std::endl;
+    dMsg(std::cout, msg.str(), advancedInfoMsg);
+  }
+  return reseeded;
+}
+
+template <typename dataType>
+void ttk::PDMiniBatchClustering<dataType>::updateCentroids(
+  std::vector<SplitDiagram> &batch,
+  const std::vector<int> &assignment,
+  const std::vector<SplitMatchings> &matchings) {
+
+  const int batchSize = batch.size();
+
+  for(int c = 0; c < k_; ++c) {
+    const int batchCount
+      = std::count(assignment.begin(), assignment.end(), c);
+    if(!batchCount) {
+      continue;
+    }
+
+    for(int t = 0; t < 3; ++t) {
+      if(!doType_[t]) {
+        continue;
+      }
+      GoodDiagram<dataType> &centroid = centroids_[t][c];
+      std::vector<double> &weights = weights_[t][c];
+      const int size = centroid.size();
+
+      // sums of the points matched to each centroid point
+      std::vector<std::array<double, 5>> sums(size, {{0, 0, 0, 0, 0}});
+      std::vector<int> matched(size, 0);
+      std::vector<Good<dataType>> newPoints;
+
+      for(int i = 0; i < batchSize; ++i) {
+        if(assignment[i] != c) {
+          continue;
+        }
+        BidderDiagram<dataType> &bidders = batch[i].bidders[t];
+        for(const matchingTuple &m : matchings[i][t]) {
+          const int bidder_id = std::get<0>(m);
+          const int good_id = std::get<1>(m);
+          if(bidder_id < 0 || bidder_id >= bidders.size()) {
+            // diagonal bidder
+            continue;
+          }
+          Bidder<dataType> &b = bidders.get(bidder_id);
+          if(good_id >= 0) {
+            sums[good_id][0] += b.x_;
+            sums[good_id][1] += b.y_;
+            sums[good_id][2] += b.coords_x_;
+            sums[good_id][3] += b.coords_y_;
+            sums[good_id][4] += b.coords_z_;
+            matched[good_id]++;
+          } else {
+            // point matched to the diagonal: a new centroid point, average
+            // of this point and of the diagonal for the rest of the batch
+            const dataType projection = (b.x_ + b.y_) / 2;
+            const dataType x = projection + (b.x_ - projection) / batchCount;
+            const dataType y = projection + (b.y_ - projection) / batchCount;
+            Good<dataType> g(x, y, false, 0);
+            g.SetCriticalCoordinates(b.coords_x_, b.coords_y_, b.coords_z_);
+            newPoints.push_back(g);
+          }
+        }
+      }
+
+      // the centroid points left unmatched are matched to their diagonal
+      // projection
+      for(int j = 0; j < size; ++j) {
+        Good<dataType> &g = centroid.get(j);
+        weights[j] += batchCount;
+        const double eta = batchCount / weights[j];
+        const int unmatched = batchCount - matched[j];
+        const double projection = ((double)g.x_ + g.y_) / 2;
+        const double x = (sums[j][0] + unmatched * projection) / batchCount;
+        const double y = (sums[j][1] + unmatched * projection) / batchCount;
+        const double cx
+          = (sums[j][2] + unmatched * (double)g.coords_x_) / batchCount;
+        const double cy
+          = (sums[j][3] + unmatched * (double)g.coords_y_) / batchCount;
+        const double cz
+          = (sums[j][4] + unmatched * (double)g.coords_z_) / batchCount;
+        g.x_ += eta * (x - g.x_);
+        g.y_ += eta * (y - g.y_);
+        g.SetCriticalCoordinates(g.coords_x_ + eta * (cx - g.coords_x_),
+                                 g.coords_y_ + eta * (cy - g.coords_y_),
+                                 g.coords_z_ + eta * (cz - g.coords_z_));
+      }
+      for(auto &g : newPoints) {
+        centroid.addGood(g);
+        weights.push_back(batchCount);
+      }
+
+      pruneCentroid(centroid, weights, maxSize_[t]);
+    }
+  }
+}
+
+template <typename dataType>
+void ttk::PDMiniBatchClustering<dataType>::pruneCentroid(
+  GoodDiagram<dataType> &centroid,
+  std::vector<double> &weights,
+  const int maxSize) {
+
+  std::vector<int> kept;
+  for(int j = 0; j < centroid.size(); ++j) {
+    if(centroid.get(j).getPersistence() > 0) {
+      kept.push_back(j);
+    }
+  }
+  if((int)kept.size() > maxSize) {
+    std::stable_sort(kept.begin(), kept.end(), [&](const int a, const int b) {
+      return centroid.get(a).getPersistence()
+             > centroid.get(b).getPersistence();
+    });
+    kept.resize(maxSize);
+    std::sort(kept.begin(), kept.end());
+  }
+
+  // the goods are renumbered: their ids are their positions
+  GoodDiagram<dataType> pruned;
+  std::vector<double> prunedWeights;
+  for(const int j : kept) {
+    Good<dataType> &g = centroid.get(j);
+    Good<dataType> p(g.x_, g.y_, false, pruned.size());
+    p.SetCriticalCoordinates(g.coords_x_, g.coords_y_, g.coords_z_);
+    pruned.addGood(p);
+    prunedWeights.push_back(weights[j]);
+  }
+  centroid = pruned;
+  weights.swap(prunedWeights);
+}
+
+template <typename dataType>
+void ttk::PDMiniBatchClustering<dataType>::buildFinalCentroids(
+  std::vector<std::vector<diagramTuple>> &final_centroids) {
+
+  final_centroids.clear();
+  final_centroids.resize(k_);
+  centroids_sizes_.assign(k_, std::vector<int>(3, 0));
+
+  const std::array<CriticalType, 3> birthTypes
+    = {{CriticalType::Local_minimum, CriticalType::Saddle1,
+        (doType_[1] && seenType_[1]) ? CriticalType::Saddle2
+                                     : CriticalType::Saddle1}};
+  const std::array<CriticalType, 3> deathTypes
+    = {{CriticalType::Saddle1, CriticalType::Saddle2,
+        CriticalType::Local_maximum}};
+
+  for(int c = 0; c < k_; ++c) {
+    for(int t = 0; t < 3; ++t) {
+      if(!doType_[t]) {
+        continue;
+      }
+      centroids_sizes_[c][t] = centroids_[t][c].size();
+      for(int i = 0; i < centroids_[t][c].size(); ++i) {
+        Good<dataType> &g = centroids_[t][c].get(i);
+        const float x = g.coords_x_;
+        const float y = g.coords_y_;
+        const float z = g.coords_z_;
+        diagramTuple tuple = std::make_tuple(0, birthTypes[t], 0, deathTypes[t],
+                                             g.getPersistence(), t, g.x_, x, y,
+                                             z, g.y_, x, y, z);
+        final_centroids[c].push_back(tuple);
+      }
+    }
+  }
+}
+
+#endif
@@ -46,6 +46,8 @@
 //
 #include <PDClustering.h>
 //
+#include <PDMiniBatchClustering.h>
+//
 
 using namespace std;
 using namespace ttk;
@@ -60,6 +62,9 @@ namespace ttk {
       use_progressive_ = 1;
       use_kmeanspp_ = 0;
       use_accelerated_ = 0;
+      use_mini_batch_ = 0;
+      use_jacobi_ = 0;
+      mini_batch_size_ = 100;
       inputData_ = NULL;
       numberOfInputs_ = 0;
       threadNumber_ = 1;
@@ -77,6 +82,14 @@ namespace ttk {
       return 0;
     }
 
+    /// Reads the diagrams on demand instead of from setDiagrams(), in
+    /// mini-batch mode only.
+    inline int setDiagramReader(
+      const typename PDMiniBatchClustering<dataType>::DiagramReader &reader) {
+      diagramReader_ = reader;
+      return 0;
+    }
+
     inline int setNumberOfInputs(int numberOfInputs) {
       numberOfInputs_ = numberOfInputs;
       // 			if(inputData_)
@@ -119,6 +132,14 @@ namespace ttk {
       use_accelerated_ = UseAccelerated;
     }
 
+    inline void setUseMiniBatch(const bool UseMiniBatch) {
+      use_mini_batch_ = UseMiniBatch;
+    }
+
+    inline void setMiniBatchSize(const int MiniBatchSize) {
+      mini_batch_size_ = MiniBatchSize;
+    }
+
     inline void setNumberOfClusters(const int NumberOfClusters) {
       n_clusters_ = NumberOfClusters;
     }
@@ -128,6 +149,11 @@ namespace ttk {
     inline void setDeterministic(const bool deterministic) {
       deterministic_ = deterministic;
     }
+    /// Parallel (Jacobi) bidding within each distance computed by the
+    /// clustering, instead of one thread per distance (k-means only).
+    inline void setUseJacobi(const bool use_jacobi) {
+      use_jacobi_ = use_jacobi;
+    }
     inline void setPairTypeClustering(const int pairTypeClustering) {
       pairTypeClustering_ = pairTypeClustering;
     }
@@ -172,6 +198,10 @@ namespace ttk {
     bool use_progressive_;
     bool use_accelerated_;
     bool use_kmeanspp_;
+    bool use_mini_batch_;
+    bool use_jacobi_;
+    int mini_batch_size_;
+    typename PDMiniBatchClustering<dataType>::DiagramReader diagramReader_;
     double alpha_;
     double lambda_;
     double time_limit_;
@@ -197,6 +227,38 @@ namespace ttk {
       }
       std::vector<std::vector<diagramTuple>> *intermediateDiagrams
         = (std::vector<std::vector<diagramTuple>> *)inputData_;
+
+      if(use_mini_batch_) {
+        PDMiniBatchClustering<dataType> miniBatch;
+        miniBatch.setWasserstein(wasserstein_);
+        miniBatch.setThreadNumber(threadNumber_);
+        miniBatch.setNumberOfInputs(numberOfInputs_);
+        miniBatch.setUseProgressive(use_progressive_);
+        miniBatch.setKMeanspp(use_kmeanspp_);
+        miniBatch.setTimeLimit(time_limit_);
+        miniBatch.setGeometricalFactor(alpha_);
+        miniBatch.setLambda(lambda_);
+        miniBatch.setDeltaLim(deltaLim_);
+        miniBatch.setDeterministic(deterministic_);
+        miniBatch.setDebugLevel(debugLevel_);
+        miniBatch.setPairTypeClustering(pairTypeClustering_);
+        miniBatch.setK(n_clusters_);
+        miniBatch.setBatchSize(mini_batch_size_);
+        miniBatch.setDiagrams(intermediateDiagrams);
+        if(diagramReader_) {
+          miniBatch.setDiagramReader(diagramReader_);
+        }
+        std::vector<int> inv_clustering
+          = miniBatch.execute(*final_centroids, all_matchings);
+
+        std::stringstream msg;
+        msg << "[PersistenceDiagramClustering] processed in "
+            << tm.getElapsedTime() << " s. (" << threadNumber_
+            << " thread(s))." << std::endl;
+        dMsg(std::cout, msg.str(), timeMsg);
+        return inv_clustering;
+      }
+
       std::vector<std::vector<diagramTuple>> data_min(numberOfInputs_);
       std::vector<std::vector<diagramTuple>> data_sad(numberOfInputs_);
       std::vector<std::vector<diagramTuple>> data_max(numberOfInputs_);
@@ -293,6 +355,7 @@ namespace ttk {
       KMeans.setUseProgressive(use_progressive_);
       KMeans.setAccelerated(use_accelerated_);
       KMeans.setUseKDTree(true);
+      KMeans.setUseJacobi(use_jacobi_);
       KMeans.setTimeLimit(time_limit_);
       KMeans.setGeometricalFactor(alpha_);
       KMeans.setLambda(lambda_);
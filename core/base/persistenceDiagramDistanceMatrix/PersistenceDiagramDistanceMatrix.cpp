@@ -0,0 +1 @@
+#include <PersistenceDiagramDistanceMatrix.h>
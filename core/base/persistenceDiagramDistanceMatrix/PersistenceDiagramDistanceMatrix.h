@@ -0,0 +1,546 @@
+/// \ingroup base
+/// \class ttk::PersistenceDiagramDistanceMatrix
+///
+/// \brief TTK processing package for the computation of the matrix of the
+/// Wasserstein distances between the persistence diagrams of an ensemble.
+///
+/// The pairs of diagrams are processed in parallel, each one by an Auction.
+/// The bidders, goods and KD-tree of each diagram are built once and shared
+/// by all its pairs: every thread owns a weight slot in the KD-trees, in
+/// which the prices of its current Auction are stored.
+///
+/// A lower bound of each distance is given by matching the sorted
+/// persistences of the two diagrams, which is optimal on the real line. When
+/// only the distances below a threshold or the k nearest neighbours of each
+/// diagram are requested, the pairs excluded by this bound are not refined:
+/// their entries hold the bound instead of the distance.
+///
+/// \sa ttkPersistenceDiagramDistanceMatrix
+
+#ifndef _PERSISTENCEDIAGRAMDISTANCEMATRIX_H
+#define _PERSISTENCEDIAGRAMDISTANCEMATRIX_H
+
+#ifndef diagramTuple
+#define diagramTuple                                                       \
+  std::tuple<ttk::SimplexId, ttk::CriticalType, ttk::SimplexId,            \
+             ttk::CriticalType, dataType, ttk::SimplexId, dataType, float, \
+             float, float, dataType, float, float, float>
+#endif
+
+// base code includes
+#include <Auction.h>
+#include <KDTree.h>
+#include <PersistenceDiagram.h>
+#include <Wrapper.h>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ttk {
+  template <typename dataType>
+  class PersistenceDiagramDistanceMatrix : public Debug {
+
+  public:
+    PersistenceDiagramDistanceMatrix() {
+      wasserstein_ = 2;
+      alpha_ = 1;
+      lambda_ = 1;
+      deltaLim_ = 0.01;
+      pairType_ = -1;
+      distanceThreshold_ = -1;
+      numberOfNeighbors_ = 0;
+      inputData_ = NULL;
+      numberOfInputs_ = 0;
+      refinedPairs_ = 0;
+      use_jacobi_ = false;
+      threadNumber_ = 1;
+    };
+
+    ~PersistenceDiagramDistanceMatrix() {
+      clear();
+    };
+
+    /// Fills the numberOfInputs x numberOfInputs matrix of the distances
+    /// and, if not NULL, the mask of its exact entries (the other ones hold
+    /// a lower bound of the distance).
+    /// \return Returns 0 upon success, negative values otherwise.
+    int execute(std::vector<std::vector<dataType>> &distanceMatrix,
+                std::vector<std::vector<char>> *exactMask = NULL);
+
+    inline int setDiagrams(void *data) {
+      inputData_ = data;
+      return 0;
+    }
+
+    inline int setNumberOfInputs(int numberOfInputs) {
+      numberOfInputs_ = numberOfInputs;
+      return 0;
+    }
+
+    /// "inf" or a positive integer.
+    /// \return Returns 0 upon success, negative values otherwise.
+    inline int setWasserstein(const std::string &wasserstein) {
+      if(wasserstein == "inf") {
+        wasserstein_ = -1;
+        return 0;
+      }
+      char *end = NULL;
+      const long value = strtol(wasserstein.c_str(), &end, 10);
+      if(wasserstein.empty() || *end != '\0' || value < 1 || value > INT_MAX) {
+        std::stringstream msg;
+        msg << "[PersistenceDiagramDistanceMatrix] Invalid Wasserstein "
+            << "metric \"" << wasserstein << "\"." << std::endl;
+        dMsg(std::cerr, msg.str(), fatalMsg);
+        return -1;
+      }
+      wasserstein_ = value;
+      return 0;
+    }
+
+    inline void setAlpha(const double alpha) {
+      alpha_ = alpha;
+    }
+
+    inline void setLambda(const double lambda) {
+      lambda_ = lambda;
+    }
+
+    inline void setDeltaLim(const double deltaLim) {
+      deltaLim_ = deltaLim;
+    }
+
+    // 0: min-saddle pairs, 1: saddle-saddle pairs, 2: saddle-max pairs,
+    // else: all pairs
+    inline void setPairType(const int pairType) {
+      pairType_ = pairType;
+    }
+
+    /// Only the distances below this threshold are refined (negative: all).
+    inline void setDistanceThreshold(const double distanceThreshold) {
+      distanceThreshold_ = distanceThreshold;
+    }
+
+    /// Only the distances to the k nearest neighbours of each diagram are
+    /// refined (0: all). Takes precedence over the distance threshold.
+    inline void setNumberOfNeighbors(const int numberOfNeighbors) {
+      numberOfNeighbors_ = numberOfNeighbors;
+    }
+
+    /// The pairs are refined one after the other, each Auction bidding on
+    /// all the threads (Jacobi bidding), instead of one pair per thread.
+    /// Better suited to a few large diagrams.
+    inline void setUseJacobi(const bool use_jacobi) {
+      use_jacobi_ = use_jacobi;
+    }
+
+    /// Number of pairs of the last execution refined by an Auction.
+    inline int getNumberOfRefinedPairs() const {
+      return refinedPairs_;
+    }
+
+    template <typename type>
+    static type abs(const type var) {
+      return (var >= 0) ? var : -var;
+    }
+
+  protected:
+    int wasserstein_;
+    double alpha_;
+    double lambda_;
+    double deltaLim_;
+    int pairType_;
+    double distanceThreshold_;
+    int numberOfNeighbors_;
+    bool use_jacobi_;
+
+    int numberOfInputs_;
+    void *inputData_;
+    int refinedPairs_;
+
+    // per pair type (min-saddle, saddle-saddle, saddle-max), per diagram
+    std::array<bool, 3> doType_;
+    std::array<std::vector<BidderDiagram<dataType>>, 3> bidders_;
+    std::array<std::vector<GoodDiagram<dataType>>, 3> goods_;
+    std::array<std::vector<KDTree<dataType> *>, 3> trees_;
+    std::array<std::vector<std::vector<KDTree<dataType> *>>, 3> treeNodes_;
+    std::array<std::vector<std::vector<dataType>>, 3> persistences_;
+    // per weight slot: copies of the two diagrams of the current Auction
+    std::vector<BidderDiagram<dataType>> workBidders_;
+    std::vector<GoodDiagram<dataType>> workGoods_;
+
+    // matching costs (power wasserstein_ of the distances) of the pairs
+    std::vector<std::vector<dataType>> costs_;
+    std::vector<std::vector<char>> refined_;
+
+    void clear();
+    void preprocess(std::vector<std::vector<diagramTuple>> &diagrams);
+    void buildKDTree(const int type, const int diagram, const int slotNumber);
+
+    dataType lowerBound(const int type, const int i, const int j) const;
+    dataType auctionCost(const int type,
+                         const int i,
+                         const int j,
+                         const int slot);
+    // matching cost of the pair, or a lower bound above thresholdCost if
+    // the pair is not refined
+    dataType pairCost(const int i,
+                      const int j,
+                      const int slot,
+                      const dataType thresholdCost,
+                      bool &refined);
+    void refinePairs(std::vector<std::pair<int, int>> &pairs,
+                     const dataType thresholdCost);
+
+    inline int diagramSize(const int i) const {
+      return bidders_[0][i].bidders_.size() + bidders_[1][i].bidders_.size()
+             + bidders_[2][i].bidders_.size();
+    }
+  };
+
+  template <typename dataType>
+  void PersistenceDiagramDistanceMatrix<dataType>::clear() {
+    for(int t = 0; t < 3; t++) {
+      for(size_t i = 0; i < trees_[t].size(); i++) {
+        delete trees_[t][i];
+      }
+      bidders_[t].clear();
+      goods_[t].clear();
+      trees_[t].clear();
+      treeNodes_[t].clear();
+      persistences_[t].clear();
+    }
+    workBidders_.clear();
+    workGoods_.clear();
+  }
+
+  template <typename dataType>
+  void PersistenceDiagramDistanceMatrix<dataType>::preprocess(
+    std::vector<std::vector<diagramTuple>> &diagrams) {
+
+    doType_[0] = doType_[1] = doType_[2] = false;
+    for(int t = 0; t < 3; t++) {
+      bidders_[t].resize(numberOfInputs_);
+      goods_[t].resize(numberOfInputs_);
+      trees_[t].resize(numberOfInputs_, nullptr);
+      treeNodes_[t].resize(numberOfInputs_);
+      persistences_[t].resize(numberOfInputs_);
+    }
+
+    // same split of the pairs as in PersistenceDiagramClustering
+    for(int i = 0; i < numberOfInputs_; i++) {
+      for(size_t j = 0; j < diagrams[i].size(); j++) {
+        diagramTuple &t = diagrams[i][j];
+        const BNodeType nt1 = std::get<1>(t);
+        const BNodeType nt2 = std::get<3>(t);
+        if(std::get<4>(t) <= 0) {
+          continue;
+        }
+        std::array<bool, 3> in{};
+        if(nt1 == BLocalMin && nt2 == BLocalMax) {
+          in[2] = true;
+        } else {
+          in[2] = (nt1 == BLocalMax || nt2 == BLocalMax);
+          in[0] = (nt1 == BLocalMin || nt2 == BLocalMin);
+          in[1] = (nt1 == BSaddle1 && nt2 == BSaddle2)
+                  || (nt1 == BSaddle2 && nt2 == BSaddle1);
+        }
+        for(int type = 0; type < 3; type++) {
+          if(!in[type]
+             || (pairType_ >= 0 && pairType_ <= 2 && type != pairType_)) {
+            continue;
+          }
+          BidderDiagram<dataType> &bidders = bidders_[type][i];
+          GoodDiagram<dataType> &goods = goods_[type][i];
+          Bidder<dataType> b(t, bidders.size(), lambda_);
+          b.setPositionInAuction(bidders.size());
+          bidders.addBidder(b);
+          Good<dataType> g(t, goods.size(), lambda_);
+          goods.addGood(g);
+          persistences_[type][i].push_back(abs<dataType>(b.y_ - b.x_));
+          doType_[type] = true;
+        }
+      }
+    }
+
+    const int slotNumber = std::max(1, threadNumber_);
+    workBidders_.resize(slotNumber);
+    workGoods_.resize(slotNumber);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#endif
+    for(int i = 0; i < numberOfInputs_; i++) {
+      for(int t = 0; t < 3; t++) {
+        std::sort(persistences_[t][i].begin(), persistences_[t][i].end());
+        if(goods_[t][i].size() > 0) {
+          buildKDTree(t, i, slotNumber);
+        }
+      }
+    }
+  }
+
+  template <typename dataType>
+  void PersistenceDiagramDistanceMatrix<dataType>::buildKDTree(
+    const int type, const int diagram, const int slotNumber) {
+    // same embedding as the queries of the bidders: the persistence
+    // coordinates are kept (null) when alpha_ is null
+    GoodDiagram<dataType> &goods = goods_[type][diagram];
+    const int dimension = alpha_ < 1 ? 5 : 2;
+    std::vector<dataType> coordinates;
+    coordinates.reserve(goods.size() * dimension);
+    for(int i = 0; i < goods.size(); i++) {
+      Good<dataType> &g = goods.get(i);
+      coordinates.push_back(alpha_ * g.x_);
+      coordinates.push_back(alpha_ * g.y_);
+      if(alpha_ < 1) {
+        coordinates.push_back((1 - alpha_) * g.coords_x_);
+        coordinates.push_back((1 - alpha_) * g.coords_y_);
+        coordinates.push_back((1 - alpha_) * g.coords_z_);
+      }
+    }
+    trees_[type][diagram] = new KDTree<dataType>(true, wasserstein_);
+    treeNodes_[type][diagram] = trees_[type][diagram]->build(
+      coordinates.data(), goods.size(), dimension, slotNumber);
+  }
+
+  template <typename dataType>
+  dataType PersistenceDiagramDistanceMatrix<dataType>::lowerBound(
+    const int type, const int i, const int j) const {
+    // Both matched points are at least as far apart as their persistences,
+    // the diagonal having a zero persistence: padded with zeros, the sorted
+    // persistences of the two diagrams are matched in order.
+    const std::vector<dataType> &p1 = persistences_[type][i];
+    const std::vector<dataType> &p2 = persistences_[type][j];
+    const int n1 = p1.size();
+    const int n2 = p2.size();
+    dataType cost = 0;
+    for(int k = 0; k < n1 + n2; k++) {
+      const dataType a = k < n2 ? 0 : p1[k - n2];
+      const dataType b = k < n1 ? 0 : p2[k - n1];
+      cost += pow(abs<dataType>(a - b), wasserstein_);
+    }
+    return alpha_ * pow(2., 1 - wasserstein_) * cost;
+  }
+
+  template <typename dataType>
+  dataType PersistenceDiagramDistanceMatrix<dataType>::auctionCost(
+    const int type, const int i, const int j, const int slot) {
+    if(bidders_[type][i].size() == 0 && goods_[type][j].size() == 0) {
+      return 0;
+    }
+    // the Auction adds the diagonal points and sets the prices: it works on
+    // copies of the diagrams, made in the buffers of the weight slot (their
+    // memory is reused from one pair to the next)
+    BidderDiagram<dataType> &bidders = workBidders_[slot];
+    GoodDiagram<dataType> &goods = workGoods_[slot];
+    bidders = bidders_[type][i];
+    goods = goods_[type][j];
+    std::vector<KDTree<dataType> *> &nodes = treeNodes_[type][j];
+    std::vector<matchingTuple> matchings;
+
+    Auction<dataType> auction(&bidders, &goods, wasserstein_, alpha_, lambda_,
+                              deltaLim_, trees_[type][j], nodes, 1, 0);
+    auction.setThreadNumber(threadNumber_);
+    auction.setUseJacobi(use_jacobi_ && threadNumber_ > 1);
+    const dataType cost = auction.run(&matchings, slot);
+
+    // leaves the weight slot of this thread null for its next pair
+    for(size_t k = 0; k < nodes.size(); k++) {
+      nodes[k]->updateWeight(0, slot);
+    }
+    return cost;
+  }
+
+  template <typename dataType>
+  dataType PersistenceDiagramDistanceMatrix<dataType>::pairCost(
+    const int i,
+    const int j,
+    const int slot,
+    const dataType thresholdCost,
+    bool &refined) {
+    std::array<dataType, 3> bounds{};
+    dataType remaining = 0;
+    for(int t = 0; t < 3; t++) {
+      if(doType_[t]) {
+        bounds[t] = lowerBound(t, i, j);
+        remaining += bounds[t];
+      }
+    }
+
+    // the pair types are refined one after the other, until the bounds of
+    // the remaining ones exclude the pair (up to the Auction precision)
+    dataType cost = 0;
+    for(int t = 0; t < 3; t++) {
+      if(!doType_[t]) {
+        continue;
+      }
+      if(thresholdCost >= 0 && cost + remaining > thresholdCost) {
+        refined = false;
+        return cost + remaining;
+      }
+      remaining -= bounds[t];
+      cost += auctionCost(t, i, j, slot);
+    }
+    refined = true;
+    return cost;
+  }
+
+  template <typename dataType>
+  void PersistenceDiagramDistanceMatrix<dataType>::refinePairs(
+    std::vector<std::pair<int, int>> &pairs, const dataType thresholdCost) {
+    // largest pairs first, for the load balance
+    std::sort(pairs.begin(), pairs.end(),
+              [this](const std::pair<int, int> &a,
+                     const std::pair<int, int> &b) {
+                return diagramSize(a.first) + diagramSize(a.second)
+                       > diagramSize(b.first) + diagramSize(b.second);
+              });
+
+    // in Jacobi mode, the threads are used within each Auction
+    const int pairThreadNumber = use_jacobi_ ? 1 : threadNumber_;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(pairThreadNumber) schedule(dynamic)
+#endif
+    for(int p = 0; p < (int)pairs.size(); p++) {
+      int slot = 0;
+#ifdef TTK_ENABLE_OPENMP
+      slot = omp_get_thread_num();
+#endif
+      const int i = pairs[p].first;
+      const int j = pairs[p].second;
+      bool refined;
+      const dataType cost = pairCost(i, j, slot, thresholdCost, refined);
+      costs_[i][j] = costs_[j][i] = cost;
+      refined_[i][j] = refined_[j][i] = refined;
+    }
+  }
+
+  template <typename dataType>
+  int PersistenceDiagramDistanceMatrix<dataType>::execute(
+    std::vector<std::vector<dataType>> &distanceMatrix,
+    std::vector<std::vector<char>> *exactMask) {
+
+    Timer tm;
+
+    if(wasserstein_ < 1) {
+      std::stringstream msg;
+      msg << "[PersistenceDiagramDistanceMatrix] Only the Wasserstein "
+          << "distances of finite order are supported." << std::endl;
+      dMsg(std::cerr, msg.str(), fatalMsg);
+      return -1;
+    }
+    if(!inputData_ || numberOfInputs_ < 1) {
+      return -2;
+    }
+
+    const int n = numberOfInputs_;
+    clear();
+    preprocess(*(std::vector<std::vector<diagramTuple>> *)inputData_);
+
+    costs_.assign(n, std::vector<dataType>(n, 0));
+    refined_.assign(n, std::vector<char>(n, 0));
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#endif
+    for(int i = 0; i < n; i++) {
+      refined_[i][i] = 1;
+      for(int j = i + 1; j < n; j++) {
+        dataType bound = 0;
+        for(int t = 0; t < 3; t++) {
+          if(doType_[t]) {
+            bound += lowerBound(t, i, j);
+          }
+        }
+        costs_[i][j] = costs_[j][i] = bound;
+      }
+    }
+
+    std::vector<std::pair<int, int>> pairs;
+    if(numberOfNeighbors_ > 0) {
+      // Refines the k smallest entries of each row until they are all exact:
+      // the bounds of the other entries are then not below them. A single
+      // diagram has no neighbour.
+      const int k = std::min(numberOfNeighbors_, n - 1);
+      std::vector<std::vector<char>> requested(n, std::vector<char>(n, 0));
+      std::vector<int> row;
+      while(k > 0) {
+        pairs.clear();
+        for(int i = 0; i < n; i++) {
+          row.clear();
+          for(int j = 0; j < n; j++) {
+            if(j != i) {
+              row.push_back(j);
+            }
+          }
+          const std::vector<dataType> &costs = costs_[i];
+          std::nth_element(row.begin(), row.begin() + k - 1, row.end(),
+                           [&costs](const int a, const int b) {
+                             return costs[a] < costs[b];
+                           });
+          for(int l = 0; l < k; l++) {
+            const int j = row[l];
+            if(!refined_[i][j] && !requested[i][j]) {
+              requested[i][j] = requested[j][i] = 1;
+              pairs.push_back(std::make_pair(std::min(i, j), std::max(i, j)));
+            }
+          }
+        }
+        if(pairs.empty()) {
+          break;
+        }
+        refinePairs(pairs, -1);
+      }
+    } else {
+      const dataType thresholdCost
+        = distanceThreshold_ >= 0 ? pow(distanceThreshold_, wasserstein_) : -1;
+      for(int i = 0; i < n; i++) {
+        for(int j = i + 1; j < n; j++) {
+          if(thresholdCost < 0 || costs_[i][j] <= thresholdCost) {
+            pairs.push_back(std::make_pair(i, j));
+          }
+        }
+      }
+      refinePairs(pairs, thresholdCost);
+    }
+
+    refinedPairs_ = 0;
+    distanceMatrix.resize(n);
+    for(int i = 0; i < n; i++) {
+      distanceMatrix[i].resize(n);
+      for(int j = 0; j < n; j++) {
+        distanceMatrix[i][j] = pow(costs_[i][j], 1. / wasserstein_);
+        if(j > i && refined_[i][j]) {
+          refinedPairs_++;
+        }
+      }
+    }
+    if(exactMask) {
+      *exactMask = refined_;
+    }
+    clear();
+
+    {
+      std::stringstream msg;
+      msg << "[PersistenceDiagramDistanceMatrix] " << refinedPairs_
+          << " out of " << n * (n - 1) / 2 << " pairs refined." << std::endl;
+      dMsg(std::cout, msg.str(), infoMsg);
+    }
+    {
+      std::stringstream msg;
+      msg << "[PersistenceDiagramDistanceMatrix] Data-set (" << n
+          << " diagrams) processed in " << tm.getElapsedTime() << " s. ("
+          << threadNumber_ << " thread(s))." << std::endl;
+      dMsg(std::cout, msg.str(), timeMsg);
+    }
+
+    return 0;
+  }
+} // namespace ttk
+
+#endif
@@ -11,9 +11,9 @@ OneSkeleton::~OneSkeleton() {
 
 int OneSkeleton::buildEdgeLinks(
   const vector<pair<SimplexId, SimplexId>> &edgeList,
-  const vector<vector<SimplexId>> &edgeStars,
+  const FlatJaggedArray &edgeStars,
   const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &edgeLinks) const {
+  FlatJaggedArray &edgeLinks) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(edgeList.empty())
@@ -26,32 +26,33 @@ int OneSkeleton::buildEdgeLinks(
 
   Timer t;
 
-  edgeLinks.resize(edgeList.size());
-
   SimplexId verticesPerCell = cellArray[0];
 
+  // one link vertex per triangle of the edge star
+  vector<SimplexId> offsets(edgeStars.getOffsets());
+  vector<SimplexId> links(edgeStars.dataSize(), -1);
+
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < (SimplexId)edgeLinks.size(); i++) {
-    for(SimplexId j = 0; j < (SimplexId)edgeStars[i].size(); j++) {
+  for(SimplexId i = 0; i < (SimplexId)edgeList.size(); i++) {
+    for(SimplexId j = 0; j < edgeStars.size(i); j++) {
 
-      SimplexId vertexId = -1;
+      const SimplexId cellId = edgeStars.get(i, j);
       for(int k = 0; k < 3; k++) {
-        if((cellArray[(verticesPerCell + 1) * edgeStars[i][j] + 1 + k]
-            != edgeList[i].first)
-           && (cellArray[(verticesPerCell + 1) * edgeStars[i][j] + 1 + k]
-               != edgeList[i].second)) {
-          vertexId = cellArray[(verticesPerCell + 1) * edgeStars[i][j] + 1 + k];
+        const SimplexId vertexId
+          = cellArray[(verticesPerCell + 1) * cellId + 1 + k];
+        if((vertexId != edgeList[i].first)
+           && (vertexId != edgeList[i].second)) {
+          links[offsets[i] + j] = vertexId;
           break;
         }
       }
-      if(vertexId != -1) {
-        edgeLinks[i].push_back(vertexId);
-      }
     }
   }
 
+  edgeLinks.setData(std::move(offsets), std::move(links));
+
   {
     stringstream msg;
     msg << "[OneSkeleton] Edge links built in " << t.getElapsedTime() << " s. ("
@@ -64,9 +65,9 @@ int OneSkeleton::buildEdgeLinks(
 
 int OneSkeleton::buildEdgeLinks(
   const vector<pair<SimplexId, SimplexId>> &edgeList,
-  const vector<vector<SimplexId>> &edgeStars,
-  const vector<vector<SimplexId>> &cellEdges,
-  vector<vector<SimplexId>> &edgeLinks) const {
+  const FlatJaggedArray &edgeStars,
+  const FlatJaggedArray &cellEdges,
+  FlatJaggedArray &edgeLinks) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(edgeList.empty())
@@ -79,36 +80,35 @@ int OneSkeleton::buildEdgeLinks(
 
   Timer t;
 
-  edgeLinks.resize(edgeList.size());
+  // one link edge per tetrahedron of the edge star
+  vector<SimplexId> offsets(edgeStars.getOffsets());
+  vector<SimplexId> links(edgeStars.dataSize(), -1);
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < (SimplexId)edgeLinks.size(); i++) {
-
-    SimplexId otherEdgeId = -1;
+  for(SimplexId i = 0; i < (SimplexId)edgeList.size(); i++) {
 
-    for(SimplexId j = 0; j < (SimplexId)edgeStars[i].size(); j++) {
+    for(SimplexId j = 0; j < edgeStars.size(i); j++) {
 
-      SimplexId linkEdgeId = -1;
+      const SimplexId cellId = edgeStars.get(i, j);
 
-      for(SimplexId k = 0; k < (SimplexId)cellEdges[edgeStars[i][j]].size();
-          k++) {
-        otherEdgeId = cellEdges[edgeStars[i][j]][k];
+      for(SimplexId k = 0; k < cellEdges.size(cellId); k++) {
+        const SimplexId otherEdgeId = cellEdges.get(cellId, k);
 
         if((edgeList[otherEdgeId].first != edgeList[i].first)
            && (edgeList[otherEdgeId].first != edgeList[i].second)
            && (edgeList[otherEdgeId].second != edgeList[i].first)
            && (edgeList[otherEdgeId].second != edgeList[i].second)) {
-          linkEdgeId = otherEdgeId;
+          links[offsets[i] + j] = otherEdgeId;
           break;
         }
       }
-
-      edgeLinks[i].push_back(linkEdgeId);
     }
   }
 
+  edgeLinks.setData(std::move(offsets), std::move(links));
+
   {
     stringstream msg;
     msg << "[OneSkeleton] Edge links built in " << t.getElapsedTime() << " s. ("
@@ -125,12 +125,6 @@ int OneSkeleton::buildEdgeList(
   const LongSimplexId *cellArray,
   vector<pair<SimplexId, SimplexId>> &edgeList) const {
 
-  ThreadId oldThreadNumber = threadNumber_;
-
-  // NOTE: parallel implementation not efficient (see bench at the bottom)
-  // let's force the usage of only 1 thread.
-  threadNumber_ = 1;
-
 #ifndef TTK_ENABLE_KAMIKAZE
   if(!cellArray)
     return -1;
@@ -138,112 +132,83 @@ int OneSkeleton::buildEdgeList(
 
   Timer t;
 
-  vector<vector<vector<SimplexId>>> threadedEdgeTable(threadNumber_);
-
-  for(SimplexId i = 0; i < (SimplexId)threadedEdgeTable.size(); i++) {
-    threadedEdgeTable[i].resize(vertexNumber);
-  }
-
   // WARNING!
   // assuming triangulations here
-  SimplexId verticesPerCell = cellArray[0];
+  const SimplexId verticesPerCell = cellArray[0];
+
+  // each edge is bucketed by its lowest vertex. within a bucket, the
+  // candidates are sorted and made unique, then a prefix sum over the
+  // buckets gives the global edge identifiers. hence, edges are sorted by
+  // increasing (first, second) vertex identifiers, whatever the number of
+  // threads.
+
+  // first pass: number of candidate edges per lowest vertex
+  vector<SimplexId> offsets(vertexNumber + 1, 0);
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
   for(SimplexId i = 0; i < cellNumber; i++) {
-
-    ThreadId threadId = 0, tmpVertexId = 0;
-    pair<SimplexId, SimplexId> edgeIds;
+    const LongSimplexId *cell = &(cellArray[(verticesPerCell + 1) * i + 1]);
+    for(SimplexId j = 0; j <= verticesPerCell - 2; j++) {
+      for(SimplexId k = j + 1; k <= verticesPerCell - 1; k++) {
+        const SimplexId lowestVertexId = min(cell[j], cell[k]);
 #ifdef TTK_ENABLE_OPENMP
-    threadId = omp_get_thread_num();
+#pragma omp atomic update
 #endif
+        offsets[lowestVertexId]++;
+      }
+    }
+  }
 
-    // tet case
-    // 0 - 1
-    // 0 - 2
-    // 0 - 3
-    // 1 - 2
-    // 1 - 3
-    // 2 - 3
+  vector<SimplexId> candidates(FlatJaggedArray::countsToOffsets(offsets));
+  vector<SimplexId> cursor(offsets.begin(), offsets.end() - 1);
+
+  // second pass: fill the buckets with the highest vertex of each edge
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < cellNumber; i++) {
+    const LongSimplexId *cell = &(cellArray[(verticesPerCell + 1) * i + 1]);
     for(SimplexId j = 0; j <= verticesPerCell - 2; j++) {
       for(SimplexId k = j + 1; k <= verticesPerCell - 1; k++) {
-        // edge processing
-        edgeIds.first = cellArray[(verticesPerCell + 1) * i + 1 + j];
-        edgeIds.second = cellArray[(verticesPerCell + 1) * i + 1 + k];
-
-        if(edgeIds.first > edgeIds.second) {
-          tmpVertexId = edgeIds.first;
-          edgeIds.first = edgeIds.second;
-          edgeIds.second = tmpVertexId;
-        }
-
-        bool hasFound = false;
-        for(SimplexId l = 0;
-            l < (SimplexId)threadedEdgeTable[threadId][edgeIds.first].size();
-            l++) {
-          if(edgeIds.second == threadedEdgeTable[threadId][edgeIds.first][l]) {
-            hasFound = true;
-            break;
-          }
-        }
-        if(!hasFound) {
-          threadedEdgeTable[threadId][edgeIds.first].push_back(edgeIds.second);
-        }
-        // end of edge processing
+        const SimplexId lowestVertexId = min(cell[j], cell[k]);
+        SimplexId position;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic capture
+#endif
+        position = cursor[lowestVertexId]++;
+        candidates[position] = max(cell[j], cell[k]);
       }
     }
   }
 
-  // now merge the thing
-  SimplexId edgeCount = 0;
-  vector<vector<SimplexId>> edgeTable;
-
-  if(threadNumber_ > 1) {
-    edgeTable.resize(vertexNumber);
-    for(SimplexId i = 0; i < (SimplexId)threadedEdgeTable.size(); i++) {
-
-      for(SimplexId j = 0; j < (SimplexId)threadedEdgeTable[i].size(); j++) {
+  vector<SimplexId>().swap(cursor);
 
-        for(SimplexId k = 0; k < (SimplexId)threadedEdgeTable[i][j].size();
-            k++) {
+  // third pass: remove the duplicates within each bucket
+  vector<SimplexId> edgeOffsets(vertexNumber + 1, 0);
 
-          // search if it already exists
-          bool hasFound = false;
-
-          for(SimplexId l = 0; l < (SimplexId)edgeTable[j].size(); l++) {
-
-            if(edgeTable[j][l] == threadedEdgeTable[i][j][k]) {
-              hasFound = true;
-              break;
-            }
-          }
-          if(!hasFound) {
-            edgeTable[j].push_back(threadedEdgeTable[i][j][k]);
-            edgeCount++;
-          }
-        }
-      }
-    }
-  } else {
-    for(SimplexId i = 0; i < (SimplexId)threadedEdgeTable[0].size(); i++)
-      edgeCount += threadedEdgeTable[0][i].size();
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic, 1024)
+#endif
+  for(SimplexId i = 0; i < vertexNumber; i++) {
+    const auto begin = candidates.begin() + offsets[i];
+    const auto end = candidates.begin() + offsets[i + 1];
+    sort(begin, end);
+    edgeOffsets[i] = unique(begin, end) - begin;
   }
 
-  vector<vector<SimplexId>> *masterEdgeTable = &edgeTable;
-  if(threadNumber_ == 1) {
-    masterEdgeTable = &(threadedEdgeTable[0]);
-  }
+  const SimplexId edgeCount = FlatJaggedArray::countsToOffsets(edgeOffsets);
 
   edgeList.resize(edgeCount);
-  edgeCount = 0;
-  for(SimplexId i = 0; i < (SimplexId)masterEdgeTable->size(); i++) {
 
-    for(SimplexId j = 0; j < (SimplexId)(*masterEdgeTable)[i].size(); j++) {
-
-      edgeList[edgeCount].first = i;
-      edgeList[edgeCount].second = (*masterEdgeTable)[i][j];
-      edgeCount++;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < vertexNumber; i++) {
+    for(SimplexId j = edgeOffsets[i]; j < edgeOffsets[i + 1]; j++) {
+      edgeList[j].first = i;
+      edgeList[j].second = candidates[offsets[i] + j - edgeOffsets[i]];
     }
   }
 
@@ -255,12 +220,6 @@ int OneSkeleton::buildEdgeList(
     dMsg(cout, msg.str(), timeMsg);
   }
 
-  threadNumber_ = oldThreadNumber;
-
-  // ethaneDiolMedium.vtu, 70Mtets, hal9000 (12coresHT)
-  // 1 thread: 10.4979 s
-  // 24 threads: 12.3994 s [not efficient in parallel]
-
   return 0;
 }
 
@@ -310,9 +269,9 @@ int OneSkeleton::buildEdgeLists(
 int OneSkeleton::buildEdgeStars(const SimplexId &vertexNumber,
                                 const SimplexId &cellNumber,
                                 const LongSimplexId *cellArray,
-                                vector<vector<SimplexId>> &starList,
+                                FlatJaggedArray &starList,
                                 vector<pair<SimplexId, SimplexId>> *edgeList,
-                                vector<vector<SimplexId>> *vertexStars) const {
+                                FlatJaggedArray *vertexStars) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(!cellArray)
@@ -331,12 +290,8 @@ int OneSkeleton::buildEdgeStars(const SimplexId &vertexNumber,
     buildEdgeList(vertexNumber, cellNumber, cellArray, *localEdgeList);
   }
 
-  starList.resize(localEdgeList->size());
-  for(SimplexId i = 0; i < (SimplexId)starList.size(); i++)
-    starList[i].reserve(16);
-
   auto localVertexStars = vertexStars;
-  vector<vector<SimplexId>> defaultVertexStars{};
+  FlatJaggedArray defaultVertexStars{};
   if(!localVertexStars) {
     localVertexStars = &defaultVertexStars;
   }
@@ -348,33 +303,53 @@ int OneSkeleton::buildEdgeStars(const SimplexId &vertexNumber,
       vertexNumber, cellNumber, cellArray, *localVertexStars);
   }
 
+  const SimplexId edgeNumber = localEdgeList->size();
+  const auto &edges = *localEdgeList;
+  const auto &stars = *localVertexStars;
+
+  // the star of an edge is the intersection of the (sorted) stars of its
+  // two vertices. first pass: count, second pass: fill.
+  auto intersectStars = [&edges, &stars](const SimplexId &i, SimplexId *out) {
+    const FlatJaggedArray::Slice star0 = stars[edges[i].first];
+    const FlatJaggedArray::Slice star1 = stars[edges[i].second];
+    SimplexId count = 0;
+    size_t pos0 = 0, pos1 = 0;
+    while((pos0 < star0.size()) && (pos1 < star1.size())) {
+      if(star0[pos0] < star1[pos1]) {
+        pos0++;
+      } else if(star1[pos1] < star0[pos0]) {
+        pos1++;
+      } else {
+        if(out)
+          out[count] = star0[pos0];
+        count++;
+        pos0++;
+        pos1++;
+      }
+    }
+    return count;
+  };
+
+  vector<SimplexId> offsets(edgeNumber + 1, 0);
+
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < (SimplexId)localEdgeList->size(); i++) {
-
-    SimplexId vertex0 = (*localEdgeList)[i].first;
-    SimplexId vertex1 = (*localEdgeList)[i].second;
+  for(SimplexId i = 0; i < edgeNumber; i++) {
+    offsets[i] = intersectStars(i, nullptr);
+  }
 
-    // merge the two vertex stars
-    for(SimplexId j = 0; j < (SimplexId)(*localVertexStars)[vertex0].size();
-        j++) {
+  vector<SimplexId> data(FlatJaggedArray::countsToOffsets(offsets));
 
-      bool hasFound = false;
-      for(SimplexId k = 0; k < (SimplexId)(*localVertexStars)[vertex1].size();
-          k++) {
-        if((*localVertexStars)[vertex0][j] == (*localVertexStars)[vertex1][k]) {
-          hasFound = true;
-          break;
-        }
-      }
-      if(hasFound) {
-        // common to the two vertex stars
-        starList[i].push_back((*localVertexStars)[vertex0][j]);
-      }
-    }
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < edgeNumber; i++) {
+    intersectStars(i, data.data() + offsets[i]);
   }
 
+  starList.setData(std::move(offsets), std::move(data));
+
   {
     stringstream msg;
     msg << "[OneSkeleton] Edge stars built in " << t.getElapsedTime() << " s. ("
@@ -398,19 +373,16 @@ int OneSkeleton::buildEdgeSubList(
 
   // NOTE: here we're dealing with a subportion of the mesh.
   // hence our lookup strategy (based on the number of total vertices) is no
-  // longer efficient. let's use a standard map instead
-  // NOTE: when dealing with the entire mesh (case above), our vertex based
-  // look up strategy is about 7 times faster than the standard map.
-  // For mesh portions, the standard map is orders of magnitude faster
+  // longer efficient. let's simply sort the candidate edges instead (which is
+  // much faster than a std::map).
 
-  map<pair<SimplexId, SimplexId>, bool> edgeMap;
   edgeList.clear();
 
   SimplexId verticesPerCell = cellArray[0];
-  for(SimplexId i = 0; i < cellNumber; i++) {
+  edgeList.reserve(cellNumber * verticesPerCell * (verticesPerCell - 1) / 2);
 
-    pair<SimplexId, SimplexId> edgeIds;
-    int tmpVertexId;
+  for(SimplexId i = 0; i < cellNumber; i++) {
+    const LongSimplexId *cell = &(cellArray[(verticesPerCell + 1) * i + 1]);
     // tet case
     // 0 - 1
     // 0 - 2
@@ -420,27 +392,13 @@ int OneSkeleton::buildEdgeSubList(
     // 2 - 3
     for(SimplexId j = 0; j <= verticesPerCell - 2; j++) {
       for(SimplexId k = j + 1; k <= verticesPerCell - 1; k++) {
-
-        edgeIds.first = cellArray[(verticesPerCell + 1) * i + 1 + j];
-        edgeIds.second = cellArray[(verticesPerCell + 1) * i + 1 + k];
-
-        if(edgeIds.first > edgeIds.second) {
-          tmpVertexId = edgeIds.first;
-          edgeIds.first = edgeIds.second;
-          edgeIds.second = tmpVertexId;
-        }
-
-        map<pair<SimplexId, SimplexId>, bool>::iterator it
-          = edgeMap.find(edgeIds);
-
-        if(it == edgeMap.end()) {
-          // not found, let's add this edge
-          edgeList.push_back(edgeIds);
-          edgeMap[edgeIds] = true;
-        }
+        edgeList.emplace_back(min(cell[j], cell[k]), max(cell[j], cell[k]));
       }
     }
   }
 
+  sort(edgeList.begin(), edgeList.end());
+  edgeList.erase(unique(edgeList.begin(), edgeList.end()), edgeList.end());
+
   return 0;
 }
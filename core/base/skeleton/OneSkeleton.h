@@ -13,7 +13,7 @@
 #ifndef _ONESKELETON_H
 #define _ONESKELETON_H
 
-#include <map>
+#include <algorithm>
 
 // base code includes
 #include <Wrapper.h>
@@ -33,47 +33,41 @@ namespace ttk {
     /// \param edgeList List of edges. The size of this std::vector
     /// should be equal to the number of edges in the triangulation. Each
     /// entry is a std::pair of vertex identifiers.
-    /// \param edgeStars List of edge stars. The size of this std::vector
-    /// should be
-    /// equal to the number of edges. Each entry is a std::vector of triangle
-    /// identifiers.
+    /// \param edgeStars List of edge stars. The number of entries should be
+    /// equal to the number of edges. Each entry lists triangle identifiers.
     /// \param cellArray Pointer to a contiguous array of cells. Each entry
     /// starts by the number of vertices in the cell, followed by the vertex
     /// identifiers of the cell.
-    /// \param edgeLinks Output edge links. The size of this std::vector
-    /// will be equal to the number of edges in the triangulation. Each
-    /// entry will be a std::vector listing the vertices in the link of the
-    /// corresponding vertex.
+    /// \param edgeLinks Output edge links. The number of entries will be
+    /// equal to the number of edges in the triangulation. Each entry will
+    /// list the vertices in the link of the corresponding edge.
     /// \return Returns 0 upon success, negative values otherwise.
     int buildEdgeLinks(
       const std::vector<std::pair<SimplexId, SimplexId>> &edgeList,
-      const std::vector<std::vector<SimplexId>> &edgeStars,
+      const FlatJaggedArray &edgeStars,
       const LongSimplexId *cellArray,
-      std::vector<std::vector<SimplexId>> &edgeLinks) const;
+      FlatJaggedArray &edgeLinks) const;
 
     /// Compute the link of each edge of a 3D triangulation (unspecified
     /// behavior if the input mesh is not a valid triangulation).
     /// \param edgeList List of edges. The size of this std::vector
     /// should be equal to the number of edges in the triangulation. Each
     /// entry is a std::pair of vertex identifiers.
-    /// \param edgeStars List of edge stars. The size of this std::vector
-    /// should be
-    /// equal to the number of edges. Each entry is a std::vector of
-    /// tetrahedron
+    /// \param edgeStars List of edge stars. The number of entries should be
+    /// equal to the number of edges. Each entry lists tetrahedron
     /// identifiers.
-    /// \param cellEdges List of celle edges. The size of this std::vector
-    /// should be equal to the number of tetrahedra in the triangulation. Each
-    /// entry is a std::vector of edge identifiers.
-    /// \param edgeLinks Output edge links. The size of this std::vector
-    /// will be equal to the number of edges in the triangulation. Each
-    /// entry will be a std::vector listing the vertices in the link of the
-    /// corresponding vertex.
+    /// \param cellEdges List of cell edges. The number of entries should be
+    /// equal to the number of tetrahedra in the triangulation. Each entry
+    /// lists edge identifiers.
+    /// \param edgeLinks Output edge links. The number of entries will be
+    /// equal to the number of edges in the triangulation. Each entry will
+    /// list the edges in the link of the corresponding edge.
     /// \return Returns 0 upon success, negative values otherwise.
     int buildEdgeLinks(
       const std::vector<std::pair<SimplexId, SimplexId>> &edgeList,
-      const std::vector<std::vector<SimplexId>> &edgeStars,
-      const std::vector<std::vector<SimplexId>> &cellEdges,
-      std::vector<std::vector<SimplexId>> &edgeLinks) const;
+      const FlatJaggedArray &edgeStars,
+      const FlatJaggedArray &cellEdges,
+      FlatJaggedArray &edgeLinks) const;
 
     /// Compute the list of edges of a valid triangulation.
     /// \param vertexNumber Number of vertices in the triangulation.
@@ -83,8 +77,8 @@ namespace ttk {
     /// starts by the number of vertices in the cell, followed by the vertex
     /// identifiers of the cell.
     /// \param edgeList Output edge list (each entry is an ordered std::pair
-    /// of
-    /// vertex identifiers).
+    /// of vertex identifiers). Edges are sorted by increasing vertex
+    /// identifiers.
     /// \return Returns 0 upon success, negative values otherwise.
     int buildEdgeList(
       const SimplexId &vertexNumber,
@@ -113,11 +107,9 @@ namespace ttk {
     /// \param cellArray Pointer to a contiguous array of cells. Each entry
     /// starts by the number of vertices in the cell, followed by the vertex
     /// identifiers of the cell.
-    /// \param starList Output list of 3-stars. The size of this std::vector
-    /// will
-    /// be equal to the number of edges in the mesh. Each entry stores a
-    /// std::vector that lists the identifiers of all 3-dimensional cells
-    /// connected to the entry's edge.
+    /// \param starList Output list of 3-stars. The number of entries will be
+    /// equal to the number of edges in the mesh. Each entry lists the
+    /// identifiers of all 3-dimensional cells connected to the entry's edge.
     /// \param edgeList Optional list of edges. If NULL, the function will
     /// compute this list anyway and free the related memory upon return.
     /// If not NULL but pointing to an empty std::vector, the function will
@@ -132,22 +124,20 @@ namespace ttk {
     /// \param vertexStars Optional list of vertex stars (list of
     /// 3-dimensional cells connected to each vertex). If NULL, the
     /// function will compute this list anyway and free the related memory
-    /// upon return. If not NULL but pointing to an empty std::vector, the
-    /// function will fill this empty std::vector (useful if this list needs
+    /// upon return. If not NULL but pointing to an empty array, the
+    /// function will fill this empty array (useful if this list needs
     /// to be used later on by the calling program). If not NULL but pointing
-    /// to a non-empty std::vector, this function will use this std::vector as
-    /// internal
-    /// vertex star list. If this std::vector is not empty but incorrect, the
+    /// to a non-empty array, this function will use this array as internal
+    /// vertex star list. If this array is not empty but incorrect, the
     /// behavior is unspecified.
     /// \return Returns 0 upon success, negative values otherwise.
     int buildEdgeStars(const SimplexId &vertexNumber,
                        const SimplexId &cellNumber,
                        const LongSimplexId *cellArray,
-                       std::vector<std::vector<SimplexId>> &starList,
+                       FlatJaggedArray &starList,
                        std::vector<std::pair<SimplexId, SimplexId>> *edgeList
                        = NULL,
-                       std::vector<std::vector<SimplexId>> *vertexStars
-                       = NULL) const;
+                       FlatJaggedArray *vertexStars = NULL) const;
 
     /// Compute the list of edges of a sub-portion of a valid triangulation.
     /// \param cellNumber Number of maximum-dimensional cells in the
@@ -157,8 +147,8 @@ namespace ttk {
     /// starts by the number of vertices in the cell, followed by the vertex
     /// identifiers of the cell.
     /// \param edgeList Output edge list (each entry is an ordered std::pair
-    /// of
-    /// vertex identifiers).
+    /// of vertex identifiers). Edges are sorted by increasing vertex
+    /// identifiers.
     /// \return Returns 0 upon success, negative values otherwise.
     int buildEdgeSubList(
       const SimplexId &cellNumber,
@@ -37,40 +37,39 @@ namespace ttk {
     /// \param cellArray Pointer to a contiguous array of cells. Each entry
     /// starts by the number of vertices in the cell, followed by the vertex
     /// identifiers of the cell.
-    /// \param cellEdges Output edge lists. The size of this std::vector
+    /// \param cellEdges Output edge lists. The size of this array
     /// will be equal to the number of cells in the mesh. Each entry will be
-    /// a std::vector listing the edge identifiers of the entry's cell's
+    /// an array listing the edge identifiers of the entry's cell's
     /// edges.
     /// \param edgeList Optional list of edges. If NULL, the function will
     /// compute this list anyway and free the related memory upon return.
-    /// If not NULL but pointing to an empty std::vector, the function will
+    /// If not NULL but pointing to an empty array, the function will
     /// fill
-    /// this empty std::vector (useful if this list needs to be used later on
+    /// this empty array (useful if this list needs to be used later on
     /// by
     /// the calling program). If not NULL but pointing to a non-empty
-    /// std::vector,
-    /// this function will use this std::vector as internal edge list. If
+    /// array,
+    /// this function will use this array as internal edge list. If
     /// this
-    /// std::vector is not empty but incorrect, the behavior is unspecified.
+    /// array is not empty but incorrect, the behavior is unspecified.
     /// \param vertexEdges Optional list of edges for each vertex. If NULL,
     /// the function will compute this list anyway and free the related
-    /// memory upon return. If not NULL but pointing to an empty std::vector,
-    /// the function will fill this empty std::vector (useful if this list
+    /// memory upon return. If not NULL but pointing to an empty array,
+    /// the function will fill this empty array (useful if this list
     /// needs to
     /// be used later on by the calling program). If not NULL but pointing to
-    /// a non-empty std::vector, this function will use this std::vector as
+    /// a non-empty array, this function will use this array as
     /// internal
-    /// vertex edge list. If this std::vector is not empty but incorrect, the
+    /// vertex edge list. If this array is not empty but incorrect, the
     /// behavior is unspecified.
     /// \return Returns 0 upon success, negative values otherwise.
     int buildCellEdges(const SimplexId &vertexNumber,
                        const SimplexId &cellNumber,
                        const LongSimplexId *cellArray,
-                       std::vector<std::vector<SimplexId>> &cellEdges,
+                       FlatJaggedArray &cellEdges,
                        std::vector<std::pair<SimplexId, SimplexId>> *edgeList
                        = NULL,
-                       std::vector<std::vector<SimplexId>> *vertexEdges
-                       = NULL) const;
+                       FlatJaggedArray *vertexEdges = NULL) const;
 
     /// Compute the list of cell-neighbors of each cell of a triangulation
     /// (unspecified behavior if the input mesh is not a triangulation).
@@ -84,19 +83,19 @@ namespace ttk {
     /// starts by the number of vertices in the cell, followed by the vertex
     /// identifiers of the cell.
     /// \param cellNeighbors Output neighbor list. The size of this
-    /// std::vector
+    /// array
     /// will be equal to the number of cells in the mesh. Each entry will be
-    /// a std::vector listing the cell identifiers of the entry's cell's
+    /// an array listing the cell identifiers of the entry's cell's
     /// neighbors.
     /// \param triangleStars Optional list of triangle stars (list of
     /// 3-dimensional cells connected to each triangle). If NULL, the
     /// function will compute this list anyway and free the related memory
-    /// upon return. If not NULL but pointing to an empty std::vector, the
-    /// function will fill this empty std::vector (useful if this list needs
+    /// upon return. If not NULL but pointing to an empty array, the
+    /// function will fill this empty array (useful if this list needs
     /// to be used later on by the calling program). If not NULL but pointing
-    /// to a non-empty std::vector, this function will use this std::vector as
+    /// to a non-empty array, this function will use this array as
     /// internal
-    /// triangle star list. If this std::vector is not empty but incorrect,
+    /// triangle star list. If this array is not empty but incorrect,
     /// the
     /// behavior is unspecified.
     /// \return Returns 0 upon success, negative values otherwise.
@@ -104,8 +103,8 @@ namespace ttk {
       const SimplexId &vertexNumber,
       const SimplexId &cellNumber,
       const LongSimplexId *cellArray,
-      std::vector<std::vector<SimplexId>> &cellNeighbors,
-      std::vector<std::vector<SimplexId>> *triangleStars = NULL) const;
+      FlatJaggedArray &cellNeighbors,
+      FlatJaggedArray *triangleStars = NULL) const;
 
     /// Compute the list of cell-neighbors of each cell of a triangulation
     /// (unspecified behavior if the input mesh is not a triangulation).
@@ -116,27 +115,27 @@ namespace ttk {
     /// starts by the number of vertices in the cell, followed by the vertex
     /// identifiers of the cell.
     /// \param cellNeighbors Output neighbor list. The size of this
-    /// std::vector
+    /// array
     /// will be equal to the number of cells in the mesh. Each entry will be
-    /// a std::vector listing the cell identifiers of the entry's cell's
+    /// an array listing the cell identifiers of the entry's cell's
     /// neighbors.
     /// \param vertexStars Optional list of vertex stars (list of
     /// 3-dimensional cells connected to each vertex). If NULL, the
     /// function will compute this list anyway and free the related memory
-    /// upon return. If not NULL but pointing to an empty std::vector, the
-    /// function will fill this empty std::vector (useful if this list needs
+    /// upon return. If not NULL but pointing to an empty array, the
+    /// function will fill this empty array (useful if this list needs
     /// to be used later on by the calling program). If not NULL but pointing
-    /// to a non-empty std::vector, this function will use this std::vector as
+    /// to a non-empty array, this function will use this array as
     /// internal
-    /// vertex star list. If this std::vector is not empty but incorrect, the
+    /// vertex star list. If this array is not empty but incorrect, the
     /// behavior is unspecified.
     /// \return Returns 0 upon success, negative values otherwise.
     int buildCellNeighborsFromVertices(
       const SimplexId &vertexNumber,
       const SimplexId &cellNumber,
       const LongSimplexId *cellArray,
-      std::vector<std::vector<SimplexId>> &cellNeighbors,
-      std::vector<std::vector<SimplexId>> *vertexStars = NULL) const;
+      FlatJaggedArray &cellNeighbors,
+      FlatJaggedArray *vertexStars = NULL) const;
 
   protected:
   };
@@ -13,13 +13,13 @@ int TwoSkeleton::buildCellNeighborsFromVertices(
   const SimplexId &vertexNumber,
   const SimplexId &cellNumber,
   const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &cellNeighbors,
-  vector<vector<SimplexId>> *vertexStars) const {
+  FlatJaggedArray &cellNeighbors,
+  FlatJaggedArray *vertexStars) const {
 
   Timer t;
 
   auto localVertexStars = vertexStars;
-  vector<vector<SimplexId>> defaultVertexStars{};
+  FlatJaggedArray defaultVertexStars{};
 
   if(!localVertexStars) {
     localVertexStars = &defaultVertexStars;
@@ -36,17 +36,12 @@ int TwoSkeleton::buildCellNeighborsFromVertices(
 
   SimplexId vertexPerCell = cellArray[0];
 
-  cellNeighbors.resize(cellNumber);
-  for(SimplexId i = 0; i < (SimplexId)cellNeighbors.size(); i++)
-    cellNeighbors[i].reserve(vertexPerCell);
-
-    // pre-sort vertex stars
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif
-  for(SimplexId i = 0; i < vertexNumber; i++)
-    sort((*localVertexStars)[i].begin(), (*localVertexStars)[i].end());
+  // at most one neighbor per cell edge, compacted below
+  vector<SimplexId> neighbors(cellNumber * vertexPerCell, -1);
+  vector<SimplexId> offsets(cellNumber + 1, 0);
 
+  // NOTE: vertex stars are sorted by construction (see
+  // ZeroSkeleton::buildVertexStars())
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
@@ -58,53 +53,43 @@ int TwoSkeleton::buildCellNeighborsFromVertices(
       SimplexId v1
         = cellArray[(vertexPerCell + 1) * i + 1 + (j + 1) % vertexPerCell];
 
+      const FlatJaggedArray::Slice star0 = (*localVertexStars)[v0];
+      const FlatJaggedArray::Slice star1 = (*localVertexStars)[v1];
+
       // perform an intersection of the 2 sorted star lists
-      SimplexId pos0 = 0, pos1 = 0;
+      size_t pos0 = 0, pos1 = 0;
       SimplexId intersection = -1;
 
-      while((pos0 < (SimplexId)(*localVertexStars)[v0].size())
-            && (pos1 < (SimplexId)(*localVertexStars)[v1].size())) {
-
-        SimplexId biggest = (*localVertexStars)[v0][pos0];
-        if((*localVertexStars)[v1][pos1] > biggest) {
-          biggest = (*localVertexStars)[v1][pos1];
-        }
-
-        for(SimplexId l = pos0; l < (SimplexId)(*localVertexStars)[v0].size();
-            l++) {
-          if((*localVertexStars)[v0][l] < biggest) {
-            pos0++;
-          } else {
-            break;
-          }
-        }
-        for(SimplexId l = pos1; l < (SimplexId)(*localVertexStars)[v1].size();
-            l++) {
-          if((*localVertexStars)[v1][l] < biggest) {
-            pos1++;
-          } else {
-            break;
-          }
-        }
-
-        if((*localVertexStars)[v0][pos0] == (*localVertexStars)[v1][pos1]) {
-
-          if((*localVertexStars)[v0][pos0] != i) {
-            intersection = (*localVertexStars)[v0][pos0];
+      while((pos0 < star0.size()) && (pos1 < star1.size())) {
+        if(star0[pos0] < star1[pos1]) {
+          pos0++;
+        } else if(star1[pos1] < star0[pos0]) {
+          pos1++;
+        } else {
+          if(star0[pos0] != i) {
+            intersection = star0[pos0];
             break;
           }
-
           pos0++;
           pos1++;
         }
       }
 
       if(intersection != -1) {
-        cellNeighbors[i].push_back(intersection);
+        neighbors[i * vertexPerCell + offsets[i]] = intersection;
+        offsets[i]++;
       }
     }
   }
 
+  vector<SimplexId> data(FlatJaggedArray::countsToOffsets(offsets));
+  for(SimplexId i = 0; i < cellNumber; i++) {
+    for(SimplexId j = 0; j < offsets[i + 1] - offsets[i]; j++) {
+      data[offsets[i] + j] = neighbors[i * vertexPerCell + j];
+    }
+  }
+  cellNeighbors.setData(std::move(offsets), std::move(data));
+
   {
     stringstream msg;
     msg << "[TwoSkeleton] Cell neighbors (" << cellNumber
@@ -120,13 +105,13 @@ int TwoSkeleton::buildEdgeTriangles(
   const SimplexId &vertexNumber,
   const SimplexId &cellNumber,
   const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &edgeTriangleList,
-  vector<vector<SimplexId>> *vertexStarList,
+  FlatJaggedArray &edgeTriangleList,
+  FlatJaggedArray *vertexStarList,
   vector<pair<SimplexId, SimplexId>> *edgeList,
-  vector<vector<SimplexId>> *edgeStarList,
-  vector<vector<SimplexId>> *triangleList,
-  vector<vector<SimplexId>> *triangleStarList,
-  vector<vector<SimplexId>> *cellTriangleList) const {
+  FlatJaggedArray *edgeStarList,
+  FlatJaggedArray *triangleList,
+  FlatJaggedArray *triangleStarList,
+  FlatJaggedArray *cellTriangleList) const {
 
   Timer t;
 
@@ -151,13 +136,13 @@ int TwoSkeleton::buildEdgeTriangles(
   }
 
   auto localEdgeStarList = edgeStarList;
-  vector<vector<SimplexId>> defaultEdgeStarList{};
+  FlatJaggedArray defaultEdgeStarList{};
   if(!localEdgeStarList) {
     localEdgeStarList = &defaultEdgeStarList;
   }
 
   auto localTriangleList = triangleList;
-  vector<vector<SimplexId>> defaultTriangleList{};
+  FlatJaggedArray defaultTriangleList{};
   if(!localTriangleList) {
     localTriangleList = &defaultTriangleList;
   }
@@ -167,7 +152,7 @@ int TwoSkeleton::buildEdgeTriangles(
   // need it.
 
   auto localCellTriangleList = cellTriangleList;
-  vector<vector<SimplexId>> defaultCellTriangleList{};
+  FlatJaggedArray defaultCellTriangleList{};
   if(!localCellTriangleList) {
     localCellTriangleList = &defaultCellTriangleList;
   }
@@ -193,68 +178,64 @@ int TwoSkeleton::buildEdgeTriangles(
                       triangleStarList, localCellTriangleList);
   }
 
-  edgeTriangleList.resize(localEdgeList->size());
+  const auto &edges = *localEdgeList;
+  const auto &edgeStars = *localEdgeStarList;
+  const auto &triangles = *localTriangleList;
+  const auto &cellTriangles = *localCellTriangleList;
+
+  // lists the triangles attached to the edge i (without duplicates)
+  auto getEdgeTriangles = [&edges, &edgeStars, &triangles, &cellTriangles](
+                            const SimplexId &i, vector<SimplexId> &out) {
+    out.clear();
+    for(SimplexId j = 0; j < edgeStars.size(i); j++) {
+      SimplexId tetId = edgeStars.get(i, j);
+
+      for(SimplexId k = 0; k < cellTriangles.size(tetId); k++) {
+        SimplexId triangleId = cellTriangles.get(tetId, k);
+
+        int matchNumber = 0;
+        for(int l = 0; l < 3; l++) {
+          const SimplexId vertexId = triangles.get(triangleId, l);
+          if((vertexId == edges[i].first) || (vertexId == edges[i].second))
+            matchNumber++;
+        }
+
+        if((matchNumber == 2)
+           && (find(out.begin(), out.end(), triangleId) == out.end())) {
+          out.push_back(triangleId);
+        }
+      }
+    }
+  };
+
+  const SimplexId edgeNumber = edges.size();
+  vector<SimplexId> offsets(edgeNumber + 1, 0);
 
   // alright, let's get things done now.
+  // first pass: count, second pass: fill.
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < (SimplexId)localEdgeList->size(); i++) {
-    SimplexId vertexId0, vertexId1, vertexId2;
-
-    for(SimplexId j = 0; j < (SimplexId)(*localEdgeStarList)[i].size(); j++) {
-      SimplexId tetId = (*localEdgeStarList)[i][j];
-
-      for(SimplexId k = 0;
-          k < (SimplexId)(*localCellTriangleList)[tetId].size(); k++) {
-        SimplexId triangleId = (*localCellTriangleList)[tetId][k];
-
-        bool isAttached = false;
-
-        vertexId0 = (*localTriangleList)[triangleId][0];
-        vertexId1 = (*localTriangleList)[triangleId][1];
-        vertexId2 = (*localTriangleList)[triangleId][2];
-
-        if((*localEdgeList)[i].first == vertexId0) {
-          if(((*localEdgeList)[i].second == vertexId1)
-             || ((*localEdgeList)[i].second == vertexId2)) {
-            isAttached = true;
-          }
-        }
-
-        if((*localEdgeList)[i].first == vertexId1) {
-          if(((*localEdgeList)[i].second == vertexId0)
-             || ((*localEdgeList)[i].second == vertexId2)) {
-            isAttached = true;
-          }
-        }
-
-        if((*localEdgeList)[i].first == vertexId2) {
-          if(((*localEdgeList)[i].second == vertexId1)
-             || ((*localEdgeList)[i].second == vertexId0)) {
-            isAttached = true;
-          }
-        }
+  for(SimplexId i = 0; i < edgeNumber; i++) {
+    vector<SimplexId> edgeTriangles;
+    getEdgeTriangles(i, edgeTriangles);
+    offsets[i] = edgeTriangles.size();
+  }
 
-        if(isAttached) {
+  vector<SimplexId> data(FlatJaggedArray::countsToOffsets(offsets));
 
-          bool isIn = false;
-          for(SimplexId l = 0; l < (SimplexId)edgeTriangleList[i].size(); l++) {
-            if(edgeTriangleList[i][l] == triangleId) {
-              isIn = true;
-              break;
-            }
-          }
-          if(!isIn) {
-            edgeTriangleList[i].push_back(triangleId);
-          }
-        }
-      }
-    }
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < edgeNumber; i++) {
+    vector<SimplexId> edgeTriangles;
+    getEdgeTriangles(i, edgeTriangles);
+    copy(edgeTriangles.begin(), edgeTriangles.end(), data.begin() + offsets[i]);
   }
 
-  SimplexId edgeNumber = localEdgeList->size();
-  SimplexId triangleNumber = localTriangleList->size();
+  edgeTriangleList.setData(std::move(offsets), std::move(data));
+
+  SimplexId triangleNumber = triangles.size();
 
   {
     stringstream msg;
@@ -267,21 +248,15 @@ int TwoSkeleton::buildEdgeTriangles(
   return 0;
 }
 
-int TwoSkeleton::buildTriangleList(
-  const SimplexId &vertexNumber,
-  const SimplexId &cellNumber,
-  const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> *triangleList,
-  vector<vector<SimplexId>> *triangleStars,
-  vector<vector<SimplexId>> *cellTriangleList) const {
+int TwoSkeleton::buildTriangleList(const SimplexId &vertexNumber,
+                                   const SimplexId &cellNumber,
+                                   const LongSimplexId *cellArray,
+                                   FlatJaggedArray *triangleList,
+                                   FlatJaggedArray *triangleStars,
+                                   FlatJaggedArray *cellTriangleList) const {
 
   Timer t;
 
-  // NOTE: parallel implementation not efficient (see bench at the bottom)
-  // let's force the usage of only 1 thread.
-  ThreadId oldThreadNumber = threadNumber_;
-  threadNumber_ = 1;
-
   SimplexId triangleNumber = 0;
 
   // check the consistency of the variables -- to adapt
@@ -298,286 +273,163 @@ int TwoSkeleton::buildTriangleList(
   }
 #endif
 
-  if(triangleList) {
-    // NOTE: 9 is pretty empirical here...
-    triangleList->clear();
-    triangleList->reserve(9 * vertexNumber);
-  }
-  if(triangleStars) {
-    triangleStars->clear();
-    triangleStars->reserve(9 * vertexNumber);
-  }
-  if(cellTriangleList) {
-    cellTriangleList->resize(cellNumber);
-    for(SimplexId i = 0; i < cellNumber; i++)
-      // assuming tet-mesh here
-      (*cellTriangleList)[i].resize(4, -1);
+  // the triangle stars are derived from the cell triangles
+  auto localCellTriangleList = cellTriangleList;
+  FlatJaggedArray defaultCellTriangleList{};
+  if(!localCellTriangleList) {
+    localCellTriangleList = &defaultCellTriangleList;
   }
+  // assuming tet-mesh here
+  localCellTriangleList->setUniform(cellNumber, 4);
+  // the triangle j of the cell i is stored at position 4 * i + j
+  SimplexId *cellTriangleData = localCellTriangleList->entry(0);
 
-  if(threadNumber_ == 1) {
+  // each triangle is bucketed by its lowest vertex. within a bucket, the
+  // candidates are sorted, then a prefix sum over the buckets gives the
+  // global triangle identifiers. hence, triangles are sorted by increasing
+  // vertex identifiers, whatever the number of threads.
 
-    // for each vertex,
-    //   list of triangles
-    //    each triangle is a list vertex Id + a triangleId
-    vector<vector<pair<vector<SimplexId>, SimplexId>>> triangleTable(
-      vertexNumber);
-    for(SimplexId i = 0; i < vertexNumber; i++)
-      triangleTable[i].reserve(32);
+  // first pass: number of candidate triangles per lowest vertex
+  vector<SimplexId> offsets(vertexNumber + 1, 0);
 
-    for(SimplexId i = 0; i < cellNumber; i++) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < cellNumber; i++) {
+    for(int j = 0; j < 4; j++) {
+      // the lowest vertex of the triangle j (opposite to the vertex j + 3)
+      SimplexId lowestVertexId = cellArray[5 * i + 1 + j];
+      for(int k = 1; k < 3; k++) {
+        lowestVertexId = min(
+          lowestVertexId, (SimplexId)cellArray[5 * i + 1 + (j + k) % 4]);
+      }
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic update
+#endif
+      offsets[lowestVertexId]++;
+    }
+  }
 
-      if((!wrapper_) || ((wrapper_) && (!wrapper_->needsToAbort()))) {
+  // (second vertex, third vertex, cell triangle position)
+  vector<array<SimplexId, 3>> candidates(
+    FlatJaggedArray::countsToOffsets(offsets));
+  vector<SimplexId> cursor(offsets.begin(), offsets.end() - 1);
 
-        vector<SimplexId> triangle(3);
+  SimplexId processedCellNumber = 0;
+  const SimplexId progressStep = max(cellNumber / 10, (SimplexId)1);
 
-        for(int j = 0; j < 4; j++) {
-          // doing triangle j
+  // second pass: fill the buckets
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < cellNumber; i++) {
 
-          for(int k = 0; k < 3; k++) {
-            triangle[k] = cellArray[5 * i + 1 + (j + k) % 4];
-          }
-          sort(triangle.begin(), triangle.end());
+    // avoid any processing if the abort signal is sent
+    if((!wrapper_) || ((wrapper_) && (!wrapper_->needsToAbort()))) {
 
-          SimplexId triangleId = -1;
-          for(SimplexId k = 0; k < (SimplexId)triangleTable[triangle[0]].size();
-              k++) {
+      array<SimplexId, 3> triangle;
+      for(int j = 0; j < 4; j++) {
+        // doing triangle j
+        for(int k = 0; k < 3; k++) {
+          triangle[k] = cellArray[5 * i + 1 + (j + k) % 4];
+        }
+        sort(triangle.begin(), triangle.end());
 
-            // processing a triangle stored for that vertex
-            if((triangleTable[triangle[0]][k].first[1] == triangle[1])
-               && (triangleTable[triangle[0]][k].first[2] == triangle[2])) {
-              triangleId = triangleTable[triangle[0]][k].second;
-              break;
-            }
-          }
-          if(triangleId == -1) {
-            // not found yet
-            triangleId = triangleNumber;
-            triangleTable[triangle[0]].push_back(
-              pair<vector<SimplexId>, SimplexId>(triangle, triangleNumber));
-            triangleNumber++;
-
-            if(triangleList) {
-              triangleList->size();
-              triangleList->push_back(triangle);
-            }
-            if(triangleStars) {
-              triangleStars->resize(triangleStars->size() + 1);
-              triangleStars->back().resize(1);
-              // store the tet i in the triangleStars list
-              triangleStars->back().back() = i;
-            }
-          } else {
-            if(triangleStars) {
-              // add tet i as a neighbor of triangleId
-              (*triangleStars)[triangleId].push_back(i);
-            }
-          }
+        SimplexId position;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic capture
+#endif
+        position = cursor[triangle[0]]++;
+        candidates[position] = {{triangle[1], triangle[2], 4 * i + j}};
+      }
 
-          if(cellTriangleList) {
-            // add the triangle to the cell
-            for(int k = 0; k < 4; k++) {
-              if((*cellTriangleList)[i][k] == -1) {
-                (*cellTriangleList)[i][k] = triangleId;
-                break;
-              }
-            }
+      // update the progress bar of the wrapping code -- to adapt
+      if(debugLevel_ > advancedInfoMsg) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp critical
+#endif
+        {
+          if((wrapper_) && (!(processedCellNumber % progressStep))) {
+            wrapper_->updateProgress((processedCellNumber + 1.0)
+                                     / cellNumber);
           }
-        }
 
-        // update the progress bar of the wrapping code -- to adapt
-        if(debugLevel_ > advancedInfoMsg) {
-          if((wrapper_) && (!(i % ((cellNumber) / 10)))) {
-            wrapper_->updateProgress((i + 1.0) / cellNumber);
-          }
+          processedCellNumber++;
         }
       }
     }
-  } else {
-
-    Timer memTimer;
-    //  for each thread,
-    //    for each vertex
-    //      for each triangle
-    //        vertex ids
-    //        triangleId
-    vector<vector<vector<pair<vector<SimplexId>, SimplexId>>>>
-      threadedTriangleTable(threadNumber_);
+  }
 
-    vector<SimplexId> triangleNumbers(threadNumber_, 0);
+  // the buckets are incomplete if the processing was aborted
+  if((wrapper_) && (wrapper_->needsToAbort()))
+    return -5;
 
-    vector<vector<vector<SimplexId>>> threadedTriangleStars(threadNumber_);
+  vector<SimplexId>().swap(cursor);
 
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      threadedTriangleTable[i].resize(vertexNumber);
-    }
+  // third pass: sort the buckets and count the distinct triangles
+  vector<SimplexId> triangleOffsets(vertexNumber + 1, 0);
 
-    int count = 0;
-
-    // the following open-mp processing is only relevant for embarassingly
-    // parallel algorithms (such as smoothing) -- to adapt
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic, 1024)
 #endif
-    for(SimplexId i = 0; i < (SimplexId)cellNumber; i++) {
-
-      // avoid any processing if the abort signal is sent
-      if((!wrapper_) || ((wrapper_) && (!wrapper_->needsToAbort()))) {
-
-        ThreadId threadId = 1;
-#ifdef TTK_ENABLE_OPENMP
-        threadId = omp_get_thread_num();
-#endif
-
-        vector<SimplexId> triangle(3);
+  for(SimplexId i = 0; i < vertexNumber; i++) {
+    sort(candidates.begin() + offsets[i], candidates.begin() + offsets[i + 1]);
+    SimplexId count = 0;
+    for(SimplexId j = offsets[i]; j < offsets[i + 1]; j++) {
+      if((j == offsets[i]) || (candidates[j][0] != candidates[j - 1][0])
+         || (candidates[j][1] != candidates[j - 1][1]))
+        count++;
+    }
+    triangleOffsets[i] = count;
+  }
 
-        for(int j = 0; j < 4; j++) {
-          // doing triangle j
+  triangleNumber = FlatJaggedArray::countsToOffsets(triangleOffsets);
 
-          for(int k = 0; k < 3; k++) {
-            triangle[k] = cellArray[5 * i + 1 + (j + k) % 4];
-          }
-          sort(triangle.begin(), triangle.end());
-
-          SimplexId triangleId = -1;
-          for(SimplexId k = 0;
-              k
-              < (SimplexId)threadedTriangleTable[threadId][triangle[0]].size();
-              k++) {
-
-            // processing a triangle stored for that vertex
-            if((threadedTriangleTable[threadId][triangle[0]][k].first[1]
-                == triangle[1])
-               && (threadedTriangleTable[threadId][triangle[0]][k].first[2]
-                   == triangle[2])) {
-              triangleId
-                = threadedTriangleTable[threadId][triangle[0]][k].second;
-              break;
-            }
-          }
-          if(triangleId == -1) {
-            // not visited by this thread
-            threadedTriangleTable[threadId][triangle[0]].push_back(
-              pair<vector<SimplexId>, SimplexId>(
-                triangle, triangleNumbers[threadId]));
-            triangleNumbers[threadId]++;
-
-            if(triangleStars) {
-              threadedTriangleStars[threadId].resize(
-                threadedTriangleStars[threadId].size() + 1);
-              threadedTriangleStars[threadId].back().resize(1);
-              threadedTriangleStars[threadId].back().back() = i;
-            }
-          } else {
-            if(triangleStars) {
-              threadedTriangleStars[threadId][triangleId].push_back(i);
-            }
-          }
-        }
+  vector<SimplexId> triangleVertices;
+  if(triangleList) {
+    triangleVertices.resize(3 * triangleNumber);
+  }
 
-        // update the progress bar of the wrapping code -- to adapt
-        if(debugLevel_ > advancedInfoMsg) {
+  // fourth pass: assign the triangle identifiers
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp critical
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic, 1024)
 #endif
-          {
-            if((wrapper_) && (!(count % ((cellNumber) / 10)))) {
-              wrapper_->updateProgress((count + 1.0) / cellNumber);
-            }
-
-            count++;
-          }
+  for(SimplexId i = 0; i < vertexNumber; i++) {
+    SimplexId triangleId = triangleOffsets[i] - 1;
+    for(SimplexId j = offsets[i]; j < offsets[i + 1]; j++) {
+      if((j == offsets[i]) || (candidates[j][0] != candidates[j - 1][0])
+         || (candidates[j][1] != candidates[j - 1][1])) {
+        triangleId++;
+        if(triangleList) {
+          triangleVertices[3 * triangleId] = i;
+          triangleVertices[3 * triangleId + 1] = candidates[j][0];
+          triangleVertices[3 * triangleId + 2] = candidates[j][1];
         }
       }
+      // add the triangle to the cell
+      cellTriangleData[candidates[j][2]] = triangleId;
     }
+  }
 
-    Timer mergeTimer;
-    // now merge the lists
-    vector<vector<pair<vector<SimplexId>, SimplexId>>> mainTriangleTable(
-      vertexNumber);
-    //     for(int i = 0; i < vertexNumber; i++){
-    //       mainTriangleTable[i].reserve(32);
-    //     }
-
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-
-      // vertex j
-      for(SimplexId j = 0; j < (SimplexId)threadedTriangleTable[i].size();
-          j++) {
-
-        // triangle k
-        for(SimplexId k = 0; k < (SimplexId)threadedTriangleTable[i][j].size();
-            k++) {
-
-          SimplexId triangleId = -1;
-          // triangle l
-          for(SimplexId l = 0; l < (SimplexId)mainTriangleTable[j].size();
-              l++) {
-            if((threadedTriangleTable[i][j][k].first[0]
-                == mainTriangleTable[j][l].first[0])
-               && (threadedTriangleTable[i][j][k].first[1]
-                   == mainTriangleTable[j][l].first[1])
-               && (threadedTriangleTable[i][j][k].first[2]
-                   == mainTriangleTable[j][l].first[2])) {
-
-              triangleId = mainTriangleTable[j][l].second;
-              break;
-            }
-          }
-          if(triangleId == -1) {
-
-            triangleId = triangleNumber;
-            mainTriangleTable[j].push_back(pair<vector<SimplexId>, SimplexId>(
-              threadedTriangleTable[i][j][k].first, triangleNumber));
-            triangleNumber++;
-
-            if(triangleList)
-              triangleList->push_back(mainTriangleTable[j].back().first);
-
-            if(triangleStars) {
-              triangleStars->resize(triangleStars->size() + 1);
-              triangleStars->back().resize(1);
-              triangleStars->back()
-                = threadedTriangleStars[i]
-                                       [threadedTriangleTable[i][j][k].second];
-            }
-          } else {
-            if(triangleStars) {
-              for(SimplexId l = 0;
-                  l < (SimplexId)threadedTriangleStars
-                        [i][threadedTriangleTable[i][j][k].second]
-                          .size();
-                  l++) {
-                (*triangleStars)[triangleId].push_back(
-                  threadedTriangleStars[i][threadedTriangleTable[i][j][k]
-                                             .second][l]);
-              }
-            }
-          }
+  // free the lookup table before allocating the outputs
+  vector<array<SimplexId, 3>>().swap(candidates);
 
-          if(cellTriangleList) {
-            // add the triangle to the cell
-            SimplexId cellId = -1;
-
-            for(SimplexId l = 0;
-                l
-                < (SimplexId)
-                    threadedTriangleStars[i]
-                                         [threadedTriangleTable[i][j][k].second]
-                                           .size();
-                l++) {
-              cellId = threadedTriangleStars[i][threadedTriangleTable[i][j][k]
-                                                  .second][l];
-              for(int m = 0; m < 4; m++) {
-                if((*cellTriangleList)[cellId][m] == -1) {
-                  (*cellTriangleList)[cellId][m] = triangleId;
-                  break;
-                }
-              }
-            }
-          }
-        }
-      }
-    }
+  if(triangleList) {
+    vector<SimplexId> vertexOffsets(triangleNumber + 1);
+    for(SimplexId i = 0; i <= triangleNumber; i++)
+      vertexOffsets[i] = 3 * i;
+    triangleList->setData(
+      std::move(vertexOffsets), std::move(triangleVertices));
+  }
+
+  if(triangleStars) {
+    const FlatJaggedArray &cellTriangles = *localCellTriangleList;
+    triangleStars->fillTransposed(
+      triangleNumber, cellNumber, 4,
+      [&cellTriangles](const SimplexId &i, const int &k) {
+        return cellTriangles.get(i, k);
+      },
+      [](const SimplexId &i, const int &) { return i; });
   }
 
   {
@@ -588,24 +440,6 @@ int TwoSkeleton::buildTriangleList(
     dMsg(cout, msg.str(), timeMsg);
   }
 
-  threadNumber_ = oldThreadNumber;
-
-  // ethaneDiolMedium.vtu, 70Mtets, hal9000 (12coresHT)
-  // 1 thread: 58.5631 s
-  // 24 threads: 87.5816 s (~)
-
-  // ethaneDiol.vtu, 8.7Mtets, vger (2coresHT) - no tet adj
-  // 1 thread: 5.7427 s
-  // 4 threads: 9.14764 s (~)
-
-  // ethaneDiol.vtu, 8.7Mtets, vger (2coresHT) - tet adjacency
-  // 1 thread: 8.59854 s
-  // 4 threads: 15.837 s (~)
-
-  // ethaneDiol.vtu, 8.7Mtets, vger (2coresHT) - tet adjacency only
-  // 1 thread: 6.85897 s
-  // 4 threads: 14.78 s (~)
-
   return 0;
 }
 
@@ -613,12 +447,12 @@ int TwoSkeleton::buildTriangleEdgeList(
   const SimplexId &vertexNumber,
   const SimplexId &cellNumber,
   const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &triangleEdgeList,
-  vector<vector<SimplexId>> *vertexEdgeList,
+  FlatJaggedArray &triangleEdgeList,
+  FlatJaggedArray *vertexEdgeList,
   vector<pair<SimplexId, SimplexId>> *edgeList,
-  vector<vector<SimplexId>> *triangleList,
-  vector<vector<SimplexId>> *triangleStarList,
-  vector<vector<SimplexId>> *cellTriangleList) const {
+  FlatJaggedArray *triangleList,
+  FlatJaggedArray *triangleStarList,
+  FlatJaggedArray *cellTriangleList) const {
 
   Timer t;
 
@@ -638,7 +472,7 @@ int TwoSkeleton::buildTriangleEdgeList(
   }
 
   auto localVertexEdgeList = vertexEdgeList;
-  vector<vector<SimplexId>> defaultVertexEdgeList{};
+  FlatJaggedArray defaultVertexEdgeList{};
   if(!localVertexEdgeList) {
     localVertexEdgeList = &defaultVertexEdgeList;
   }
@@ -658,7 +492,7 @@ int TwoSkeleton::buildTriangleEdgeList(
   // can compute them for free optionally.
 
   auto localTriangleList = triangleList;
-  vector<vector<SimplexId>> defaultTriangleList{};
+  FlatJaggedArray defaultTriangleList{};
   if(!localTriangleList) {
     localTriangleList = &defaultTriangleList;
   }
@@ -668,7 +502,8 @@ int TwoSkeleton::buildTriangleEdgeList(
                       triangleStarList, cellTriangleList);
   }
 
-  triangleEdgeList.resize(localTriangleList->size());
+  const SimplexId triangleNumber = localTriangleList->size();
+  triangleEdgeList.setUniform(triangleNumber, 3);
 
   // now for each triangle, grab its vertices, add the edges in the triangle
   // with no duplicate
@@ -676,14 +511,16 @@ int TwoSkeleton::buildTriangleEdgeList(
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < (SimplexId)localTriangleList->size(); i++) {
-    SimplexId vertexId = -1;
-    for(SimplexId j = 0; j < (SimplexId)(*localTriangleList)[i].size(); j++) {
-      vertexId = (*localTriangleList)[i][j];
+  for(SimplexId i = 0; i < triangleNumber; i++) {
+    const FlatJaggedArray::Slice triangle = (*localTriangleList)[i];
+    SimplexId *triangleEdges = triangleEdgeList.entry(i);
+    int triangleEdgeNumber = 0;
+
+    for(size_t j = 0; j < triangle.size(); j++) {
+      const SimplexId vertexId = triangle[j];
 
-      for(SimplexId k = 0;
-          k < (SimplexId)(*localVertexEdgeList)[vertexId].size(); k++) {
-        SimplexId edgeId = (*localVertexEdgeList)[vertexId][k];
+      for(SimplexId k = 0; k < localVertexEdgeList->size(vertexId); k++) {
+        SimplexId edgeId = localVertexEdgeList->get(vertexId, k);
 
         SimplexId otherVertexId = (*localEdgeList)[edgeId].first;
 
@@ -692,9 +529,8 @@ int TwoSkeleton::buildTriangleEdgeList(
         }
 
         bool isInTriangle = false;
-        for(SimplexId l = 0; l < (SimplexId)(*localTriangleList)[i].size();
-            l++) {
-          if((*localTriangleList)[i][l] == otherVertexId) {
+        for(size_t l = 0; l < triangle.size(); l++) {
+          if(triangle[l] == otherVertexId) {
             isInTriangle = true;
             break;
           }
@@ -702,21 +538,20 @@ int TwoSkeleton::buildTriangleEdgeList(
 
         if(isInTriangle) {
           bool isIn = false;
-          for(SimplexId l = 0; l < (SimplexId)triangleEdgeList[i].size(); l++) {
-            if(triangleEdgeList[i][l] == edgeId) {
+          for(int l = 0; l < triangleEdgeNumber; l++) {
+            if(triangleEdges[l] == edgeId) {
               isIn = true;
               break;
             }
           }
-          if(!isIn) {
-            triangleEdgeList[i].push_back(edgeId);
+          if((!isIn) && (triangleEdgeNumber < 3)) {
+            triangleEdges[triangleEdgeNumber++] = edgeId;
           }
         }
       }
     }
   }
 
-  SimplexId triangleNumber = localTriangleList->size();
   SimplexId edgeNumber = localEdgeList->size();
 
   {
@@ -731,11 +566,10 @@ int TwoSkeleton::buildTriangleEdgeList(
   return 0;
 }
 
-int TwoSkeleton::buildTriangleLinks(
-  const vector<vector<SimplexId>> &triangleList,
-  const vector<vector<SimplexId>> &triangleStars,
-  const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &triangleLinks) const {
+int TwoSkeleton::buildTriangleLinks(const FlatJaggedArray &triangleList,
+                                    const FlatJaggedArray &triangleStars,
+                                    const LongSimplexId *cellArray,
+                                    FlatJaggedArray &triangleLinks) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(triangleList.empty())
@@ -748,27 +582,32 @@ int TwoSkeleton::buildTriangleLinks(
 
   Timer t;
 
-  triangleLinks.resize(triangleList.size());
+  // one link vertex per tetrahedron of the triangle star
+  vector<SimplexId> offsets(triangleStars.getOffsets());
+  vector<SimplexId> links(triangleStars.dataSize(), -1);
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
   for(SimplexId i = 0; i < (SimplexId)triangleList.size(); i++) {
 
-    for(SimplexId j = 0; j < (SimplexId)triangleStars[i].size(); j++) {
+    for(SimplexId j = 0; j < triangleStars.size(i); j++) {
 
       for(int k = 0; k < 4; k++) {
-        SimplexId vertexId = cellArray[5 * triangleStars[i][j] + 1 + k];
+        SimplexId vertexId = cellArray[5 * triangleStars.get(i, j) + 1 + k];
 
-        if((vertexId != triangleList[i][0]) && (vertexId != triangleList[i][1])
-           && (vertexId != triangleList[i][2])) {
-          triangleLinks[i].push_back(vertexId);
+        if((vertexId != triangleList.get(i, 0))
+           && (vertexId != triangleList.get(i, 1))
+           && (vertexId != triangleList.get(i, 2))) {
+          links[offsets[i] + j] = vertexId;
           break;
         }
       }
     }
   }
 
+  triangleLinks.setData(std::move(offsets), std::move(links));
+
   {
     stringstream msg;
     msg << "[TwoSkeleton] Triangle links built in " << t.getElapsedTime()
@@ -781,62 +620,25 @@ int TwoSkeleton::buildTriangleLinks(
 
 int TwoSkeleton::buildVertexTriangles(
   const SimplexId &vertexNumber,
-  const vector<vector<SimplexId>> &triangleList,
-  vector<vector<SimplexId>> &vertexTriangleList) const {
+  const FlatJaggedArray &triangleList,
+  FlatJaggedArray &vertexTriangleList) const {
 
   Timer t;
 
-  ThreadId oldThreadNumber = threadNumber_;
-
-  threadNumber_ = 1;
-
-  if(threadNumber_ != 1) {
-    vector<vector<vector<SimplexId>>> threadedLists(threadNumber_);
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      threadedLists[i].resize(vertexNumber);
-    }
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif
-    for(SimplexId i = 0; i < (SimplexId)triangleList.size(); i++) {
-      ThreadId threadId = 0;
-#ifdef TTK_ENABLE_OPENMP
-      threadId = omp_get_thread_num();
-#endif
-
-      for(SimplexId j = 0; j < (SimplexId)triangleList[i].size(); j++) {
-        threadedLists[threadId][triangleList[i][j]].push_back(i);
-      }
-    }
-
-    // merge back
-    vertexTriangleList.resize(vertexNumber, vector<SimplexId>());
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      for(SimplexId j = 0; j < vertexNumber; j++) {
-        for(SimplexId k = 0; k < (SimplexId)threadedLists[i][j].size(); k++) {
-          vertexTriangleList[j].push_back(threadedLists[i][j][k]);
-        }
-      }
-    }
-  } else {
-    vertexTriangleList.resize(vertexNumber);
-    for(SimplexId i = 0; i < (SimplexId)triangleList.size(); i++) {
-      for(SimplexId j = 0; j < (SimplexId)triangleList[i].size(); j++) {
-        vertexTriangleList[triangleList[i][j]].push_back(i);
-      }
-    }
-  }
+  vertexTriangleList.fillTransposed(
+    vertexNumber, triangleList.size(), 3,
+    [&triangleList](const SimplexId &i, const int &j) {
+      return triangleList.get(i, j);
+    },
+    [](const SimplexId &i, const int &) { return i; });
 
   {
     stringstream msg;
     msg << "[TwoSkeleton] Vertex triangle list (" << vertexNumber
-        << " vertices) computed in " << t.getElapsedTime() << " s. ("
-        << threadNumber_ << " thread(s))." << endl;
+        << " vertices) computed in " << t.getElapsedTime() << " s. (1"
+        << " thread(s))." << endl;
     dMsg(cout, msg.str(), timeMsg);
   }
 
-  threadNumber_ = oldThreadNumber;
-
   return 0;
 }
@@ -19,6 +19,7 @@
 #include <ZeroSkeleton.h>
 
 #include <algorithm>
+#include <array>
 
 namespace ttk {
 
@@ -38,27 +39,27 @@ namespace ttk {
     /// starts by the number of vertices in the cell, followed by the vertex
     /// identifiers of the cell.
     /// \param cellNeighbors Output neighbor list. The size of this
-    /// std::vector
+    /// array
     /// will be equal to the number of cells in the mesh. Each entry will be
-    /// a std::vector listing the cell identifiers of the entry's cell's
+    /// an array listing the cell identifiers of the entry's cell's
     /// neighbors.
     /// \param vertexStars Optional list of vertex stars (list of
     /// 2-dimensional cells connected to each vertex). If NULL, the
     /// function will compute this list anyway and free the related memory
-    /// upon return. If not NULL but pointing to an empty std::vector, the
-    /// function will fill this empty std::vector (useful if this list needs
+    /// upon return. If not NULL but pointing to an empty array, the
+    /// function will fill this empty array (useful if this list needs
     /// to be used later on by the calling program). If not NULL but pointing
-    /// to a non-empty std::vector, this function will use this std::vector as
+    /// to a non-empty array, this function will use this array as
     /// internal
-    /// vertex star list. If this std::vector is not empty but incorrect, the
+    /// vertex star list. If this array is not empty but incorrect, the
     /// behavior is unspecified.
     /// \return Returns 0 upon success, negative values otherwise.
     int buildCellNeighborsFromVertices(
       const SimplexId &vertexNumber,
       const SimplexId &cellNumber,
       const LongSimplexId *cellArray,
-      std::vector<std::vector<SimplexId>> &cellNeighbors,
-      std::vector<std::vector<SimplexId>> *vertexStars = NULL) const;
+      FlatJaggedArray &cellNeighbors,
+      FlatJaggedArray *vertexStars = NULL) const;
 
     /// Compute the list of triangles connected to each edge for 3D
     /// triangulations (unspecified behavior if the input mesh is not a
@@ -70,93 +71,93 @@ namespace ttk {
     /// starts by the number of vertices in the cell, followed by the vertex
     /// identifiers of the cell.
     /// \param edgeTriangleList Output edge triangle list. The size of this
-    /// std::vector will be equal to the number of edges in the triangulation.
+    /// array will be equal to the number of edges in the triangulation.
     /// Each
-    /// entry will be a std::vector listing the triangle identifiers for each
+    /// entry will be an array listing the triangle identifiers for each
     /// triangle connected to the entry's edge.
     /// \param vertexStarList Optional output vertex star list (list of
     /// tetrahedron identifiers for each vertex). If NULL, the function
     /// will compute this list anyway and free the related memory upon
-    /// return. If not NULL but pointing to an empty std::vector, the
+    /// return. If not NULL but pointing to an empty array, the
     /// function
-    /// will fill this empty std::vector (useful if this list needs to be
+    /// will fill this empty array (useful if this list needs to be
     /// used
     /// later on by the calling program). If not NULL but pointing to a
-    /// non-empty std::vector, this function will use this std::vector as
+    /// non-empty array, this function will use this array as
     /// internal
-    /// vertex star list. If this std::vector is not empty but incorrect, the
+    /// vertex star list. If this array is not empty but incorrect, the
     /// behavior is unspecified.
     /// \param edgeList Optional output edge list (list of std::pairs of
     /// vertex
     /// identifiers). If NULL, the function will compute this list anyway and
     /// free the related memory upon return. If not NULL but pointing to an
-    /// empty std::vector, the function will fill this empty std::vector
+    /// empty array, the function will fill this empty array
     /// (useful if this
     /// list needs to be used later on by the calling program). If not NULL
-    /// but pointing to a non-empty std::vector, this function will use this
-    /// std::vector
-    /// as internal edge list. If this std::vector is not empty but
+    /// but pointing to a non-empty array, this function will use this
+    /// array
+    /// as internal edge list. If this array is not empty but
     /// incorrect, the
     /// behavior is unspecified.
     /// \param edgeStarList Optional output edge star list (list of
     /// tetrahedron identifiers for each edge). If NULL, the function
     /// will compute this list anyway and free the related memory upon
-    /// return. If not NULL but pointing to an empty std::vector, the
+    /// return. If not NULL but pointing to an empty array, the
     /// function
-    /// will fill this empty std::vector (useful if this list needs to be
+    /// will fill this empty array (useful if this list needs to be
     /// used
     /// later on by the calling program). If not NULL but pointing to a
-    /// non-empty std::vector, this function will use this std::vector as
+    /// non-empty array, this function will use this array as
     /// internal
-    /// edge star list. If this std::vector is not empty but incorrect, the
+    /// edge star list. If this array is not empty but incorrect, the
     /// behavior is unspecified.
     /// \param triangleList Optional output triangle list (list of
-    /// std::vectors of
+    /// arrays of
     /// vertex identifiers). If NULL, the function will compute this list
     /// anyway and free the related memory upon return. If not NULL but
-    /// pointing to an empty std::vector, the function will fill this empty
-    /// std::vector
+    /// pointing to an empty array, the function will fill this empty
+    /// array
     /// (useful if this list needs to be used later on by the calling
-    /// program). If not NULL but pointing to a non-empty std::vector, this
-    /// function will use this std::vector as internal triangle list. If this
-    /// std::vector is not empty but incorrect, the behavior is unspecified.
+    /// program). If not NULL but pointing to a non-empty array, this
+    /// function will use this array as internal triangle list. If this
+    /// array is not empty but incorrect, the behavior is unspecified.
     /// \param triangleStarList Optional output triangle star list (list of
     /// tetrahedron identifiers for each triangle). If NULL, the function
     /// will compute this list anyway and free the related memory upon
-    /// return. If not NULL but pointing to an empty std::vector, the
+    /// return. If not NULL but pointing to an empty array, the
     /// function
-    /// will fill this empty std::vector (useful if this list needs to be
+    /// will fill this empty array (useful if this list needs to be
     /// used
     /// later on by the calling program). If not NULL but pointing to a
-    /// non-empty std::vector, this function will use this std::vector as
+    /// non-empty array, this function will use this array as
     /// internal
-    /// triangle star list. If this std::vector is not empty but incorrect,
+    /// triangle star list. If this array is not empty but incorrect,
     /// the
     /// behavior is unspecified.
     /// \param cellTriangleList Optional output cell triangle list (list of
     /// triangle identifiers for each tetrahedron). If NULL, the function
     /// will compute this list anyway and free the related memory upon
-    /// return. If not NULL but pointing to an empty std::vector, the
+    /// return. If not NULL but pointing to an empty array, the
     /// function
-    /// will fill this empty std::vector (useful if this list needs to be
+    /// will fill this empty array (useful if this list needs to be
     /// used
     /// later on by the calling program). If not NULL but pointing to a
-    /// non-empty std::vector, this function will use this std::vector as
+    /// non-empty array, this function will use this array as
     /// internal
-    /// cell triangle list. If this std::vector is not empty but incorrect,
+    /// cell triangle list. If this array is not empty but incorrect,
     /// the
     /// behavior is unspecified.
     int buildEdgeTriangles(
       const SimplexId &vertexNumber,
       const SimplexId &cellNumber,
       const LongSimplexId *cellArray,
-      std::vector<std::vector<SimplexId>> &edgeTriangleList,
-      std::vector<std::vector<SimplexId>> *vertexStarList = NULL,
+      FlatJaggedArray &edgeTriangleList,
+      FlatJaggedArray *vertexStarList = NULL,
       std::vector<std::pair<SimplexId, SimplexId>> *edgeList = NULL,
-      std::vector<std::vector<SimplexId>> *edgeStarList = NULL,
-      std::vector<std::vector<SimplexId>> *triangleList = NULL,
-      std::vector<std::vector<SimplexId>> *triangleStarList = NULL,
-      std::vector<std::vector<SimplexId>> *cellTriangleList = NULL) const;
+      FlatJaggedArray *edgeStarList = NULL,
+      FlatJaggedArray *triangleList = NULL,
+      FlatJaggedArray *triangleStarList = NULL,
+      FlatJaggedArray *cellTriangleList = NULL) const;
 
     /// Compute the list of triangles of a triangulation represented by a
     /// vtkUnstructuredGrid object. Unspecified behavior if the input mesh is
@@ -168,18 +169,23 @@ namespace ttk {
     /// starts by the number of vertices in the cell, followed by the vertex
     /// identifiers of the cell.
     /// \param triangleList Optional output triangle list (each entry is the
-    /// ordered std::vector of the vertex identifiers of the entry's
-    /// triangle).
+    /// ordered array of the vertex identifiers of the entry's
+    /// triangle). Triangles are sorted by increasing vertex identifiers.
     /// \param triangleStars Optional output for triangle tet-adjacency (for
     /// each triangle, list of its adjacent tetrahedra).
     /// \return Returns 0 upon success, negative values otherwise.
+    /// \note The triangles are bucketed by lowest vertex in a temporary
+    /// buffer of 4 candidates of 3 identifiers per tetrahedron (12
+    /// SimplexId per tetrahedron). This buffer is freed before the outputs
+    /// are allocated but it determines the peak memory usage of this
+    /// function.
     int buildTriangleList(
       const SimplexId &vertexNumber,
       const SimplexId &cellNumber,
       const LongSimplexId *cellArray,
-      std::vector<std::vector<SimplexId>> *triangleList = NULL,
-      std::vector<std::vector<SimplexId>> *triangleStars = NULL,
-      std::vector<std::vector<SimplexId>> *cellTriangleList = NULL) const;
+      FlatJaggedArray *triangleList = NULL,
+      FlatJaggedArray *triangleStars = NULL,
+      FlatJaggedArray *cellTriangleList = NULL) const;
 
     /// Compute the list of edges connected to each triangle for 3D
     /// triangulations (unspecified behavior if the input mesh is not a
@@ -191,69 +197,69 @@ namespace ttk {
     /// starts by the number of vertices in the cell, followed by the vertex
     /// identifiers of the cell.
     /// \param triangleEdgeList Output triangle edge list. The size of this
-    /// std::vector will be equal to the number of triangles in the
+    /// array will be equal to the number of triangles in the
     /// triangulation.
-    /// Each entry will be a std::vector listing the edge identifiers for
+    /// Each entry will be an array listing the edge identifiers for
     /// each
     /// edge connected to the entry's triangle.
     /// \param vertexEdgeList Optional output vertex edge list (list of
     /// edge identifiers for each vertex). If NULL, the function
     /// will compute this list anyway and free the related memory upon
-    /// return. If not NULL but pointing to an empty std::vector, the
+    /// return. If not NULL but pointing to an empty array, the
     /// function
-    /// will fill this empty std::vector (useful if this list needs to be
+    /// will fill this empty array (useful if this list needs to be
     /// used
     /// later on by the calling program). If not NULL but pointing to a
-    /// non-empty std::vector, this function will use this std::vector as
+    /// non-empty array, this function will use this array as
     /// internal
-    /// vertex edge list. If this std::vector is not empty but incorrect, the
+    /// vertex edge list. If this array is not empty but incorrect, the
     /// behavior is unspecified.
     /// \param edgeList Optional output edge list (list of std::pairs of
     /// vertex
     /// identifiers). If NULL, the function will compute this list anyway and
     /// free the related memory upon return. If not NULL but pointing to an
-    /// empty std::vector, the function will fill this empty std::vector
+    /// empty array, the function will fill this empty array
     /// (useful if this
     /// list needs to be used later on by the calling program). If not NULL
-    /// but pointing to a non-empty std::vector, this function will use this
-    /// std::vector
-    /// as internal edge list. If this std::vector is not empty but
+    /// but pointing to a non-empty array, this function will use this
+    /// array
+    /// as internal edge list. If this array is not empty but
     /// incorrect, the
     /// behavior is unspecified.
     /// \param triangleList Optional output triangle list (list of
-    /// std::vectors of
+    /// arrays of
     /// vertex identifiers). If NULL, the function will compute this list
     /// anyway and free the related memory upon return. If not NULL but
-    /// pointing to an empty std::vector, the function will fill this empty
-    /// std::vector
+    /// pointing to an empty array, the function will fill this empty
+    /// array
     /// (useful if this list needs to be used later on by the calling
-    /// program). If not NULL but pointing to a non-empty std::vector, this
-    /// function will use this std::vector as internal triangle list. If this
-    /// std::vector is not empty but incorrect, the behavior is unspecified.
+    /// program). If not NULL but pointing to a non-empty array, this
+    /// function will use this array as internal triangle list. If this
+    /// array is not empty but incorrect, the behavior is unspecified.
     /// \param triangleStarList Optional output triangle star list (list of
     /// tetrahedron identifiers for each triangle). If NULL, the function
     /// will compute this list anyway and free the related memory upon
-    /// return. If not NULL but pointing to an empty std::vector, the
+    /// return. If not NULL but pointing to an empty array, the
     /// function
-    /// will fill this empty std::vector (useful if this list needs to be
+    /// will fill this empty array (useful if this list needs to be
     /// used
     /// later on by the calling program). If not NULL but pointing to a
-    /// non-empty std::vector, this function will use this std::vector as
+    /// non-empty array, this function will use this array as
     /// internal
-    /// triangle star list. If this std::vector is not empty but incorrect,
+    /// triangle star list. If this array is not empty but incorrect,
     /// the
     /// behavior is unspecified.
     /// \param cellTriangleList Optional output cell triangle list (list of
     /// triangle identifiers for each tetrahedron). If NULL, the function
     /// will compute this list anyway and free the related memory upon
-    /// return. If not NULL but pointing to an empty std::vector, the
+    /// return. If not NULL but pointing to an empty array, the
     /// function
-    /// will fill this empty std::vector (useful if this list needs to be
+    /// will fill this empty array (useful if this list needs to be
     /// used
     /// later on by the calling program). If not NULL but pointing to a
-    /// non-empty std::vector, this function will use this std::vector as
+    /// non-empty array, this function will use this array as
     /// internal
-    /// cell triangle list. If this std::vector is not empty but incorrect,
+    /// cell triangle list. If this array is not empty but incorrect,
     /// the
     /// behavior is unspecified.
     /// \return Returns 0 upon success, negative values otherwise.
@@ -261,12 +267,12 @@ namespace ttk {
       const SimplexId &vertexNumber,
       const SimplexId &cellNumber,
       const LongSimplexId *cellArray,
-      std::vector<std::vector<SimplexId>> &triangleEdgeList,
-      std::vector<std::vector<SimplexId>> *vertexEdgeList = NULL,
+      FlatJaggedArray &triangleEdgeList,
+      FlatJaggedArray *vertexEdgeList = NULL,
       std::vector<std::pair<SimplexId, SimplexId>> *edgeList = NULL,
-      std::vector<std::vector<SimplexId>> *triangleList = NULL,
-      std::vector<std::vector<SimplexId>> *triangleStarList = NULL,
-      std::vector<std::vector<SimplexId>> *cellTriangleList = NULL) const;
+      FlatJaggedArray *triangleList = NULL,
+      FlatJaggedArray *triangleStarList = NULL,
+      FlatJaggedArray *cellTriangleList = NULL) const;
 
     /// Compute the links of triangles in a 3D triangulation.
     /// \param triangleList Input triangle list. The number of entries of this
@@ -285,23 +291,23 @@ namespace ttk {
     /// corresponding triangle.
     /// \return Returns 0 upon success, negative values otherwise.
     int buildTriangleLinks(
-      const std::vector<std::vector<SimplexId>> &triangeList,
-      const std::vector<std::vector<SimplexId>> &triangleStars,
+      const FlatJaggedArray &triangeList,
+      const FlatJaggedArray &triangleStars,
       const LongSimplexId *cellArray,
-      std::vector<std::vector<SimplexId>> &triangleLinks) const;
+      FlatJaggedArray &triangleLinks) const;
 
     /// Compute the list of triangles connected to each vertex for 3D
     /// triangulations (unspecified behavior if the input mesh is not a
     /// triangulation).
     /// \param vertexNumber Number of vertices in the triangulation.
-    /// \param triangleList Input triangle list (list of std::vectors of
+    /// \param triangleList Input triangle list (list of arrays of
     /// vertex identifiers).
     /// \param vertexTriangleList Output vertex triangle list (list of
-    /// std::vectors of triangle identifiers).
+    /// arrays of triangle identifiers).
     int buildVertexTriangles(
       const SimplexId &vertexNumber,
-      const std::vector<std::vector<SimplexId>> &triangleList,
-      std::vector<std::vector<SimplexId>> &vertexTriangleList) const;
+      const FlatJaggedArray &triangleList,
+      FlatJaggedArray &vertexTriangleList) const;
 
   protected:
   };
@@ -13,75 +13,26 @@ ZeroSkeleton::~ZeroSkeleton() {
 int ZeroSkeleton::buildVertexEdges(
   const SimplexId &vertexNumber,
   const vector<pair<SimplexId, SimplexId>> &edgeList,
-  vector<vector<SimplexId>> &vertexEdges) const {
+  FlatJaggedArray &vertexEdges) const {
 
   Timer t;
 
-  // NOTE: parallel implementation not efficient (see bench at the bottom)
-  // let's force the usage of only 1 thread.
-  ThreadId oldThreadNumber = threadNumber_;
-  threadNumber_ = 1;
-
-  vertexEdges.resize(vertexNumber);
-  for(SimplexId i = 0; i < (SimplexId)vertexEdges.size(); i++) {
-    vertexEdges[i].clear();
-  }
-
-  if(threadNumber_ == 1) {
-    for(SimplexId i = 0; i < (SimplexId)edgeList.size(); i++) {
-      vertexEdges[edgeList[i].first].push_back(i);
-      vertexEdges[edgeList[i].second].push_back(i);
-    }
-  } else {
-    vector<vector<vector<SimplexId>>> threadedVertexEdges(threadNumber_);
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      threadedVertexEdges[i].resize(vertexNumber);
-    }
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif
-    for(SimplexId i = 0; i < (SimplexId)edgeList.size(); i++) {
-
-      ThreadId threadId = 0;
-
-#ifdef TTK_ENABLE_OPENMP
-      threadId = omp_get_thread_num();
-#endif
-
-      threadedVertexEdges[threadId][edgeList[i].first].push_back(i);
-      threadedVertexEdges[threadId][edgeList[i].second].push_back(i);
-    }
-
-    // now merge the thing
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      for(SimplexId j = 0; j < (SimplexId)threadedVertexEdges[i].size(); j++) {
-        for(SimplexId k = 0; k < (SimplexId)threadedVertexEdges[i][j].size();
-            k++) {
-
-          bool hasFound = false;
-          for(SimplexId l = 0; l < (SimplexId)vertexEdges[j].size(); l++) {
-            if(vertexEdges[j][l] == threadedVertexEdges[i][j][k]) {
-              hasFound = true;
-              break;
-            }
-          }
-          if(!hasFound)
-            vertexEdges[j].push_back(threadedVertexEdges[i][j][k]);
-        }
-      }
-    }
-  }
+  // NOTE: the transposition is a memory-bound counting sort, a single thread
+  // is enough here.
+  vertexEdges.fillTransposed(
+    vertexNumber, edgeList.size(), 2,
+    [&edgeList](const SimplexId &i, const int &k) {
+      return k ? edgeList[i].second : edgeList[i].first;
+    },
+    [](const SimplexId &i, const int &) { return i; });
 
   {
     stringstream msg;
     msg << "[ZeroSkeleton] Vertex edges built in " << t.getElapsedTime()
-        << " s. (" << threadNumber_ << " thread(s))." << endl;
+        << " s. (1 thread(s))." << endl;
     dMsg(cout, msg.str(), timeMsg);
   }
 
-  threadNumber_ = oldThreadNumber;
-
   // ethaneDiolMedium.vtu, 70Mtets, hal9000 (12coresHT)
   // 1 thread: 11.85 s
   // 24 threads: 20.93 s [not efficient]
@@ -185,7 +136,7 @@ int ZeroSkeleton::buildVertexLinks(
   const SimplexId &cellNumber,
   const LongSimplexId *cellArray,
   vector<vector<LongSimplexId>> &vertexLinks,
-  vector<vector<SimplexId>> *vertexStars) const {
+  FlatJaggedArray *vertexStars) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(!cellArray)
@@ -195,7 +146,7 @@ int ZeroSkeleton::buildVertexLinks(
   Timer t;
 
   auto localVertexStars = vertexStars;
-  vector<vector<SimplexId>> defaultVertexStars{};
+  FlatJaggedArray defaultVertexStars{};
   if(!localVertexStars) {
     localVertexStars = &defaultVertexStars;
   }
@@ -363,10 +314,10 @@ int ZeroSkeleton::buildVertexLinks(
 }
 
 int ZeroSkeleton::buildVertexLinks(
-  const vector<vector<SimplexId>> &vertexStars,
-  const vector<vector<SimplexId>> &cellEdges,
+  const FlatJaggedArray &vertexStars,
+  const FlatJaggedArray &cellEdges,
   const vector<pair<SimplexId, SimplexId>> &edgeList,
-  vector<vector<SimplexId>> &vertexLinks) const {
+  FlatJaggedArray &vertexLinks) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(vertexStars.empty())
@@ -379,28 +330,36 @@ int ZeroSkeleton::buildVertexLinks(
 
   Timer t;
 
-  vertexLinks.resize(vertexStars.size());
+  // in a valid triangulation, each triangle of the star of a vertex
+  // contributes exactly one edge to its link: the link and the star share
+  // the same layout.
+  vector<SimplexId> offsets(vertexStars.getOffsets());
+  vector<SimplexId> links(vertexStars.dataSize(), -1);
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < (SimplexId)vertexLinks.size(); i++) {
+  for(SimplexId i = 0; i < (SimplexId)vertexStars.size(); i++) {
+
+    for(SimplexId j = 0; j < vertexStars.size(i); j++) {
+      const SimplexId cellId = vertexStars.get(i, j);
 
-    for(SimplexId j = 0; j < (SimplexId)vertexStars[i].size(); j++) {
-      for(SimplexId k = 0; k < (SimplexId)cellEdges[vertexStars[i][j]].size();
-          k++) {
-        SimplexId edgeId = cellEdges[vertexStars[i][j]][k];
+      for(SimplexId k = 0; k < cellEdges.size(cellId); k++) {
+        SimplexId edgeId = cellEdges.get(cellId, k);
 
         SimplexId vertexId0 = edgeList[edgeId].first;
         SimplexId vertexId1 = edgeList[edgeId].second;
 
         if((vertexId0 != i) && (vertexId1 != i)) {
-          vertexLinks[i].push_back(edgeId);
+          links[offsets[i] + j] = edgeId;
+          break;
         }
       }
     }
   }
 
+  vertexLinks.setData(std::move(offsets), std::move(links));
+
   {
     stringstream msg;
     msg << "[ZeroSkeleton] Vertex links built in " << t.getElapsedTime()
@@ -411,11 +370,10 @@ int ZeroSkeleton::buildVertexLinks(
   return 0;
 }
 
-int ZeroSkeleton::buildVertexLinks(
-  const vector<vector<SimplexId>> &vertexStars,
-  const vector<vector<SimplexId>> &cellTriangles,
-  const vector<vector<SimplexId>> &triangleList,
-  vector<vector<SimplexId>> &vertexLinks) const {
+int ZeroSkeleton::buildVertexLinks(const FlatJaggedArray &vertexStars,
+                                   const FlatJaggedArray &cellTriangles,
+                                   const FlatJaggedArray &triangleList,
+                                   FlatJaggedArray &vertexLinks) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(vertexStars.empty())
@@ -428,33 +386,40 @@ int ZeroSkeleton::buildVertexLinks(
 
   Timer t;
 
-  vertexLinks.resize(vertexStars.size());
+  // in a valid triangulation, each tetrahedron of the star of a vertex
+  // contributes exactly one triangle to its link.
+  vector<SimplexId> offsets(vertexStars.getOffsets());
+  vector<SimplexId> links(vertexStars.dataSize(), -1);
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < (SimplexId)vertexLinks.size(); i++) {
+  for(SimplexId i = 0; i < (SimplexId)vertexStars.size(); i++) {
+
+    for(SimplexId j = 0; j < vertexStars.size(i); j++) {
+      const SimplexId cellId = vertexStars.get(i, j);
 
-    for(SimplexId j = 0; j < (SimplexId)vertexStars[i].size(); j++) {
-      for(SimplexId k = 0;
-          k < (SimplexId)cellTriangles[vertexStars[i][j]].size(); k++) {
-        SimplexId triangleId = cellTriangles[vertexStars[i][j]][k];
+      for(SimplexId k = 0; k < cellTriangles.size(cellId); k++) {
+        SimplexId triangleId = cellTriangles.get(cellId, k);
 
         bool hasVertex = false;
         for(int l = 0; l < 3; l++) {
-          if(i == triangleList[triangleId][l]) {
+          if(i == triangleList.get(triangleId, l)) {
             hasVertex = true;
             break;
           }
         }
 
         if(!hasVertex) {
-          vertexLinks[i].push_back(triangleId);
+          links[offsets[i] + j] = triangleId;
+          break;
         }
       }
     }
   }
 
+  vertexLinks.setData(std::move(offsets), std::move(links));
+
   {
     stringstream msg;
     msg << "[ZeroSkeleton] Vertex links built in " << t.getElapsedTime()
@@ -469,7 +434,7 @@ int ZeroSkeleton::buildVertexNeighbors(
   const SimplexId &vertexNumber,
   const SimplexId &cellNumber,
   const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &oneSkeleton,
+  FlatJaggedArray &oneSkeleton,
   vector<pair<SimplexId, SimplexId>> *edgeList) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
@@ -479,8 +444,6 @@ int ZeroSkeleton::buildVertexNeighbors(
 
   Timer t;
 
-  oneSkeleton.resize(vertexNumber);
-
   auto localEdgeList = edgeList;
   vector<pair<SimplexId, SimplexId>> defaultEdgeList{};
   if(!localEdgeList) {
@@ -494,17 +457,20 @@ int ZeroSkeleton::buildVertexNeighbors(
     osk.buildEdgeList(vertexNumber, cellNumber, cellArray, *localEdgeList);
   }
 
-  for(SimplexId i = 0; i < (SimplexId)localEdgeList->size(); i++) {
-    oneSkeleton[(*localEdgeList)[i].first].push_back(
-      (*localEdgeList)[i].second);
-    oneSkeleton[(*localEdgeList)[i].second].push_back(
-      (*localEdgeList)[i].first);
-  }
+  const auto &edges = *localEdgeList;
+  oneSkeleton.fillTransposed(
+    vertexNumber, edges.size(), 2,
+    [&edges](const SimplexId &i, const int &k) {
+      return k ? edges[i].second : edges[i].first;
+    },
+    [&edges](const SimplexId &i, const int &k) {
+      return k ? edges[i].first : edges[i].second;
+    });
 
   {
     stringstream msg;
     msg << "[ZeroSkeleton] One-skeleton built in " << t.getElapsedTime()
-        << " s. (" << threadNumber_ << " thread(s))." << endl;
+        << " s. (1 thread(s))." << endl;
     dMsg(cout, msg.str(), timeMsg);
   }
 
@@ -516,97 +482,33 @@ int ZeroSkeleton::buildVertexNeighbors(
   return 0;
 }
 
-int ZeroSkeleton::buildVertexStars(
-  const SimplexId &vertexNumber,
-  const SimplexId &cellNumber,
-  const LongSimplexId *cellArray,
-  vector<vector<SimplexId>> &vertexStars) const {
+int ZeroSkeleton::buildVertexStars(const SimplexId &vertexNumber,
+                                   const SimplexId &cellNumber,
+                                   const LongSimplexId *cellArray,
+                                   FlatJaggedArray &vertexStars) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
   if(!cellArray)
     return -1;
 #endif
 
-  // NOTE: parallel implementation not efficient (see bench at the bottom)
-  // let's force the usage of only 1 thread.
-  ThreadId oldThreadNumber = threadNumber_;
-  threadNumber_ = 1;
-
   Timer t;
 
-  vertexStars.resize(vertexNumber);
-  for(SimplexId i = 0; i < vertexNumber; i++)
-    vertexStars[i].reserve(32);
-
-  vector<vector<vector<SimplexId>> *> threadedZeroSkeleton(threadNumber_);
-  if(threadNumber_ == 1) {
-    threadedZeroSkeleton[0] = &vertexStars;
-  } else {
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      threadedZeroSkeleton[i] = new vector<vector<SimplexId>>();
-      threadedZeroSkeleton[i]->resize(vertexNumber);
-      for(SimplexId j = 0; j < (SimplexId)threadedZeroSkeleton[i]->size();
-          j++) {
-        (*threadedZeroSkeleton[i])[j].reserve(32);
-      }
-    }
-  }
-
-  SimplexId vertexNumberPerCell = cellArray[0];
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif
-  for(SimplexId i = 0; i < cellNumber; i++) {
+  const SimplexId vertexNumberPerCell = cellArray[0];
 
-    ThreadId threadId = 0;
-#ifdef TTK_ENABLE_OPENMP
-    threadId = omp_get_thread_num();
-#endif
-
-    for(SimplexId j = 0; j < vertexNumberPerCell; j++) {
-      (*threadedZeroSkeleton[threadId])[cellArray[(vertexNumberPerCell + 1) * i
-                                                  + 1 + j]]
-        .push_back(i);
-    }
-  }
-
-  if(threadNumber_ > 1) {
-    // now merge the thing
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-
-      // looping on vertices
-      for(SimplexId j = 0; j < (SimplexId)threadedZeroSkeleton[i]->size();
-          j++) {
-
-        // looping on the vertex star
-        for(SimplexId k = 0;
-            k < (SimplexId)(*threadedZeroSkeleton[i])[j].size(); k++) {
-
-          bool hasFound = false;
-          if(threadNumber_) {
-            for(SimplexId l = 0; l < (SimplexId)vertexStars[j].size(); l++) {
-              if(vertexStars[j][l] == (*threadedZeroSkeleton[i])[j][k]) {
-                hasFound = true;
-                break;
-              }
-            }
-          }
-          if(!hasFound)
-            vertexStars[j].push_back((*threadedZeroSkeleton[i])[j][k]);
-        }
-      }
-    }
-
-    for(ThreadId i = 0; i < threadNumber_; i++) {
-      delete threadedZeroSkeleton[i];
-    }
-  }
+  // cells are visited in increasing order, hence each vertex star comes out
+  // sorted (the cell neighbor computations rely on this).
+  vertexStars.fillTransposed(
+    vertexNumber, cellNumber, vertexNumberPerCell,
+    [cellArray, vertexNumberPerCell](const SimplexId &i, const int &j) {
+      return (SimplexId)cellArray[(vertexNumberPerCell + 1) * i + 1 + j];
+    },
+    [](const SimplexId &i, const int &) { return i; });
 
   {
     stringstream msg;
     msg << "[ZeroSkeleton] Vertex stars built in " << t.getElapsedTime()
-        << " s. (" << threadNumber_ << " thread(s))." << endl;
+        << " s. (1 thread(s))." << endl;
     dMsg(cout, msg.str(), timeMsg);
   }
 
@@ -614,18 +516,16 @@ int ZeroSkeleton::buildVertexStars(
     stringstream msg;
 
     for(SimplexId i = 0; i < (SimplexId)vertexStars.size(); i++) {
-      msg << "[ZeroSkeleton] Vertex #" << i << " (" << vertexStars[i].size()
+      msg << "[ZeroSkeleton] Vertex #" << i << " (" << vertexStars.size(i)
           << " cell(s)): ";
-      for(SimplexId j = 0; j < (SimplexId)vertexStars[i].size(); j++) {
-        msg << " " << vertexStars[i][j];
+      for(SimplexId j = 0; j < vertexStars.size(i); j++) {
+        msg << " " << vertexStars.get(i, j);
       }
       msg << endl;
     }
     dMsg(cout, msg.str(), Debug::advancedInfoMsg);
   }
 
-  threadNumber_ = oldThreadNumber;
-
   // ethaneDiol.vtu, 8.7Mtets, hal9000 (12coresHT)
   // 1 thread: 0.53 s
   // 24 threads: 7.99 s
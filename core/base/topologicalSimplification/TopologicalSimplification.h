@@ -28,8 +28,9 @@
 #include <Wrapper.h>
 
 #include <Triangulation.h>
+#include <algorithm>
 #include <cmath>
-#include <set>
+#include <functional>
 #include <tuple>
 #include <type_traits>
 
@@ -326,13 +327,16 @@ int ttk::TopologicalSimplification::execute() const {
   Timer t;
 
   // pre-processing
+  bool hasNaN = false;
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
+#pragma omp parallel for num_threads(threadNumber_) reduction(|| : hasNaN)
 #endif
   for(SimplexId k = 0; k < vertexNumber_; ++k) {
     scalars[k] = inputScalars[k];
-    if(std::isnan((double)scalars[k]))
+    if(std::isnan((double)scalars[k])) {
       scalars[k] = 0;
+      hasNaN = true;
+    }
 
     offsets[k] = inputOffsets[k];
   }
@@ -363,8 +367,41 @@ int ttk::TopologicalSimplification::execute() const {
     dMsg(std::cout, msg.str(), advancedInfoMsg);
   }
 
-  // declare the tuple-comparison functor
-  SweepCmp cmp;
+  // vertices sorted by increasing (scalar, offset) order. each sweep
+  // outputs a monotone field along its adjustment sequence, which gives the
+  // order for the next sweep without sorting again
+  std::vector<SimplexId> vertexOrder;
+  if(!hasNaN) {
+    // shared with the other filters processing the input field. copied
+    // since the sweeps update it
+    const auto order = triangulation_->getVertexOrder(
+      inputScalars, inputOffsets, threadNumber_);
+    if(!order) {
+      std::stringstream msg;
+      msg << "[TopologicalSimplification] Could not sort the vertices."
+          << std::endl;
+      dMsg(std::cerr, msg.str(), fatalMsg);
+      return -1;
+    }
+    vertexOrder = order->getSortedVertices();
+  } else {
+    vertexOrder.resize(vertexNumber_);
+    for(SimplexId k = 0; k < vertexNumber_; ++k)
+      vertexOrder[k] = k;
+    std::sort(vertexOrder.begin(), vertexOrder.end(),
+              [&](const SimplexId a, const SimplexId b) {
+                return isLowerThan<dataType>(a, b, scalars, offsets);
+              });
+  }
+
+  // position of each vertex in the order of the current sweep
+  std::vector<SimplexId> vertexRank(vertexNumber_);
+  std::vector<bool> visitedVertices(vertexNumber_);
+  std::vector<SimplexId> adjustmentSequence(vertexNumber_);
+  // sweep front, as a min-heap of vertex ranks
+  std::vector<SimplexId> sweepFront;
+  sweepFront.reserve(vertexNumber_);
+  const std::greater<SimplexId> cmp;
 
   // processing
   int iteration{};
@@ -381,36 +418,34 @@ int ttk::TopologicalSimplification::execute() const {
 
       bool isIncreasingOrder = !j;
 
-      cmp.setIsIncreasingOrder(isIncreasingOrder);
-      std::set<std::tuple<dataType, SimplexId, SimplexId>, decltype(cmp)>
-        sweepFront(cmp);
-      std::vector<bool> visitedVertices(vertexNumber_, false);
-      std::vector<SimplexId> adjustmentSequence(vertexNumber_);
+      // vertexOrder follows the sweep direction
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+      for(SimplexId k = 0; k < vertexNumber_; ++k)
+        vertexRank[vertexOrder[k]] = k;
+      visitedVertices.assign(vertexNumber_, false);
 
       // add the seeds
-      if(isIncreasingOrder) {
-        for(SimplexId k : authorizedMinima) {
-          authorizedExtrema[k] = true;
-          sweepFront.emplace(scalars[k], offsets[k], k);
-          visitedVertices[k] = true;
-        }
-      } else {
-        for(SimplexId k : authorizedMaxima) {
-          authorizedExtrema[k] = true;
-          sweepFront.emplace(scalars[k], offsets[k], k);
-          visitedVertices[k] = true;
-        }
+      sweepFront.clear();
+      const std::vector<SimplexId> &seeds
+        = (isIncreasingOrder ? authorizedMinima : authorizedMaxima);
+      for(SimplexId k : seeds) {
+        authorizedExtrema[k] = true;
+        sweepFront.push_back(vertexRank[k]);
+        visitedVertices[k] = true;
       }
+      std::make_heap(sweepFront.begin(), sweepFront.end(), cmp);
 
       // growth by neighborhood of the seeds
       SimplexId adjustmentPos = 0;
       do {
-        auto front = sweepFront.begin();
-        if(front == sweepFront.end())
+        if(sweepFront.empty())
           return -1;
 
-        SimplexId vertexId = std::get<2>(*front);
-        sweepFront.erase(front);
+        std::pop_heap(sweepFront.begin(), sweepFront.end(), cmp);
+        SimplexId vertexId = vertexOrder[sweepFront.back()];
+        sweepFront.pop_back();
 
         SimplexId neighborNumber
           = triangulation_->getVertexNeighborNumber(vertexId);
@@ -418,7 +453,8 @@ int ttk::TopologicalSimplification::execute() const {
           SimplexId neighbor;
           triangulation_->getVertexNeighbor(vertexId, k, neighbor);
           if(!visitedVertices[neighbor]) {
-            sweepFront.emplace(scalars[neighbor], offsets[neighbor], neighbor);
+            sweepFront.push_back(vertexRank[neighbor]);
+            std::push_heap(sweepFront.begin(), sweepFront.end(), cmp);
             visitedVertices[neighbor] = true;
           }
         }
@@ -446,6 +482,11 @@ int ttk::TopologicalSimplification::execute() const {
         }
         offsets[adjustmentSequence[k]] = offset;
       }
+
+      // the field is now monotone along the adjustment sequence: the next
+      // sweep (in the opposite direction) visits it backwards
+      std::reverse_copy(adjustmentSequence.begin(), adjustmentSequence.end(),
+                        vertexOrder.begin());
     }
 
     // test convergence
@@ -5,7 +5,8 @@ using namespace ttk;
 
 Triangulation::Triangulation()
   : AbstractTriangulation{}, gridDimensions_{-1, -1, -1},
-    abstractTriangulation_{nullptr}, usePeriodicBoundaries_{false} {
+    abstractTriangulation_{nullptr}, usePeriodicBoundaries_{false},
+    useVertexOrderCache_{true} {
   debugLevel_ = 0; // overrides the global debug level.
 }
 
@@ -15,7 +16,9 @@ Triangulation::Triangulation(const Triangulation &rhs)
     explicitTriangulation_{rhs.explicitTriangulation_},
     implicitTriangulation_{rhs.implicitTriangulation_},
     periodicImplicitTriangulation_{rhs.periodicImplicitTriangulation_},
-    usePeriodicBoundaries_{rhs.usePeriodicBoundaries_} {
+    usePeriodicBoundaries_{rhs.usePeriodicBoundaries_},
+    useVertexOrderCache_{rhs.useVertexOrderCache_},
+    vertexOrders_{rhs.vertexOrders_} {
 
   if(rhs.abstractTriangulation_ == &rhs.explicitTriangulation_) {
     abstractTriangulation_ = &explicitTriangulation_;
@@ -34,7 +37,9 @@ Triangulation::Triangulation(Triangulation &&rhs)
     implicitTriangulation_{std::move(rhs.implicitTriangulation_)},
     periodicImplicitTriangulation_{
       std::move(rhs.periodicImplicitTriangulation_)},
-    usePeriodicBoundaries_{std::move(rhs.usePeriodicBoundaries_)} {
+    usePeriodicBoundaries_{std::move(rhs.usePeriodicBoundaries_)},
+    useVertexOrderCache_{rhs.useVertexOrderCache_},
+    vertexOrders_{std::move(rhs.vertexOrders_)} {
 
   if(rhs.abstractTriangulation_ == &rhs.explicitTriangulation_) {
     abstractTriangulation_ = &explicitTriangulation_;
@@ -54,6 +59,8 @@ Triangulation &Triangulation::operator=(const Triangulation &rhs) {
     implicitTriangulation_ = rhs.implicitTriangulation_;
     periodicImplicitTriangulation_ = rhs.periodicImplicitTriangulation_;
     usePeriodicBoundaries_ = rhs.usePeriodicBoundaries_;
+    useVertexOrderCache_ = rhs.useVertexOrderCache_;
+    vertexOrders_ = rhs.vertexOrders_;
 
     if(rhs.abstractTriangulation_ == &rhs.explicitTriangulation_) {
       abstractTriangulation_ = &explicitTriangulation_;
@@ -77,6 +84,8 @@ Triangulation &Triangulation::operator=(Triangulation &&rhs) {
     periodicImplicitTriangulation_
       = std::move(rhs.periodicImplicitTriangulation_);
     usePeriodicBoundaries_ = std::move(rhs.usePeriodicBoundaries_);
+    useVertexOrderCache_ = rhs.useVertexOrderCache_;
+    vertexOrders_ = std::move(rhs.vertexOrders_);
 
     if(rhs.abstractTriangulation_ == &rhs.explicitTriangulation_) {
       abstractTriangulation_ = &explicitTriangulation_;
@@ -40,8 +40,10 @@
 #include <ExplicitTriangulation.h>
 #include <ImplicitTriangulation.h>
 #include <PeriodicImplicitTriangulation.h>
+#include <VertexOrder.h>
 
 #include <array>
+#include <memory>
 
 namespace ttk {
 
@@ -70,11 +72,26 @@ namespace ttk {
     /// \return Returns 0 upon success, negative values otherwise.
     inline size_t footprint() const override {
 
+      size_t size = 0;
+
       if(abstractTriangulation_) {
-        return abstractTriangulation_->footprint();
+        size = abstractTriangulation_->footprint();
       }
 
-      return 0;
+      if(!vertexOrders_.empty()) {
+        size_t orderSize = 0;
+        for(const auto &order : vertexOrders_)
+          orderSize += order->footprint();
+
+        std::stringstream msg;
+        msg << "[Triangulation] Vertex orders (" << vertexOrders_.size()
+            << "): " << (orderSize / 1024) / 1024 << " MB." << std::endl;
+        dMsg(std::cout, msg.str(), memoryMsg);
+
+        size += orderSize;
+      }
+
+      return size;
     }
 
     /// Get the \p localEdgeId-th edge of the \p cellId-th cell.
@@ -199,6 +216,10 @@ namespace ttk {
     /// from any time performance measurement.
     /// \return Returns a pointer to the cell edge list.
     /// \sa getCellNeighbors()
+    /// \warning Not available on explicit triangulations, which only store
+    /// the compressed form of the relation (NULL is returned).
+    /// \sa getCellEdgesView(), which provides the same information without
+    /// building any list.
     inline const std::vector<std::vector<SimplexId>> *getCellEdges() override {
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
@@ -329,6 +350,10 @@ namespace ttk {
     /// \note It is recommended to exclude such a pre-processing step
     /// from any time performance measurement.
     /// \return Returns a pointer to the cell neighbor list.
+    /// \warning Not available on explicit triangulations, which only store
+    /// the compressed form of the relation (NULL is returned).
+    /// \sa getCellNeighborsView(), which provides the same information without
+    /// building any list.
     inline const std::vector<std::vector<SimplexId>> *
       getCellNeighbors() override {
 #ifndef TTK_ENABLE_KAMIKAZE
@@ -484,6 +509,10 @@ namespace ttk {
     /// from any time performance measurement.
     /// \return Returns a pointer to the cell triangle list.
     /// \sa getCellNeighbors()
+    /// \warning Not available on explicit triangulations, which only store
+    /// the compressed form of the relation (NULL is returned).
+    /// \sa getCellTrianglesView(), which provides the same information without
+    /// building any list.
     inline const std::vector<std::vector<SimplexId>> *
       getCellTriangles() override {
 #ifndef TTK_ENABLE_KAMIKAZE
@@ -579,6 +608,11 @@ namespace ttk {
     /// The number of entries in this list is equal to the number of edges.
     /// Each entry is a std::pair of vertex identifiers.
     ///
+    /// In explicit mode, each pair is ordered (first < second) and the edges
+    /// are sorted by increasing (first, second) vertex identifiers, whatever
+    /// the number of threads. Former versions numbered the edges in the order
+    /// they were met in the cells.
+    ///
     /// In implicit mode, this function will force the creation of such a
     /// list (which will be time and memory consuming).
     /// THIS IS USUALLY A BAD IDEA.
@@ -591,6 +625,8 @@ namespace ttk {
     /// \note It is recommended to exclude such a pre-processing step
     /// from any time performance measurement.
     /// \return Returns a pointer to the edge list.
+    /// \sa getEdgesView(), which provides the same information without
+    /// building any list.
     inline const std::vector<std::pair<SimplexId, SimplexId>> *
       getEdges() override {
 #ifndef TTK_ENABLE_KAMIKAZE
@@ -719,6 +755,10 @@ namespace ttk {
     /// \note It is recommended to exclude such a pre-processing step
     /// from any time performance measurement.
     /// \return Returns a pointer to the edge link list.
+    /// \warning Not available on explicit triangulations, which only store
+    /// the compressed form of the relation (NULL is returned).
+    /// \sa getEdgeLinksView(), which provides the same information without
+    /// building any list.
     inline const std::vector<std::vector<SimplexId>> *getEdgeLinks() override {
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
@@ -857,6 +897,10 @@ namespace ttk {
     /// \note It is recommended to exclude such a pre-processing step
     /// from any time performance measurement.
     /// \return Returns a pointer to the edge star list.
+    /// \warning Not available on explicit triangulations, which only store
+    /// the compressed form of the relation (NULL is returned).
+    /// \sa getEdgeStarsView(), which provides the same information without
+    /// building any list.
     inline const std::vector<std::vector<SimplexId>> *getEdgeStars() override {
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
@@ -1002,6 +1046,10 @@ namespace ttk {
     /// from any time performance measurement.
     /// \return Returns a pointer to the edge triangle list.
     /// \sa getEdgeStars
+    /// \warning Not available on explicit triangulations, which only store
+    /// the compressed form of the relation (NULL is returned).
+    /// \sa getEdgeTrianglesView(), which provides the same information without
+    /// building any list.
     inline const std::vector<std::vector<SimplexId>> *
       getEdgeTriangles() override {
 #ifndef TTK_ENABLE_KAMIKAZE
@@ -1203,6 +1251,83 @@ namespace ttk {
       return abstractTriangulation_->getNumberOfVertices();
     }
 
+    /// Get the vertices sorted by increasing (scalar, offset) values, along
+    /// with the rank of each vertex in this order.
+    ///
+    /// The order is computed with a parallel radix sort (see
+    /// ttk::VertexOrder) and cached on the triangulation, so that the
+    /// filters processing the same field can share it. A cached order is
+    /// reused for the same field pointer as long as it is consistent with
+    /// the current values and offsets, it is recomputed otherwise.
+    ///
+    /// A cache hit still revalidates the order against the field, which is
+    /// linear in the number of vertices (as is the radix sort).
+    ///
+    /// Each cached order holds two SimplexId per vertex and up to 4 orders
+    /// are kept (see footprint()). Use clearVertexOrders() to release them
+    /// and setVertexOrderCaching() to disable the cache.
+    ///
+    /// \param scalars Scalar field (one value per vertex).
+    /// \param offsets Offset field breaking the ties of the scalar values
+    /// (nullptr to use the vertex identifiers).
+    /// \param threadNumber Number of threads used for the sort.
+    /// \return Returns a shared pointer to the vertex order (nullptr upon
+    /// failure).
+    template <typename scalarType, typename idType = SimplexId>
+    inline std::shared_ptr<const VertexOrder>
+      getVertexOrder(const scalarType *scalars,
+                     const idType *offsets = nullptr,
+                     const int &threadNumber = 1) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck() or !scalars)
+        return nullptr;
+#endif
+
+      const SimplexId vertexNumber = getNumberOfVertices();
+
+      for(size_t i = 0; i < vertexOrders_.size(); i++) {
+        if(vertexOrders_[i]->getSource() == scalars) {
+          std::shared_ptr<const VertexOrder> order = vertexOrders_[i];
+          vertexOrders_.erase(vertexOrders_.begin() + i);
+          if(order->isValid(vertexNumber, scalars, offsets, threadNumber)) {
+            vertexOrders_.insert(vertexOrders_.begin(), order);
+            return order;
+          }
+          break;
+        }
+      }
+
+      std::shared_ptr<VertexOrder> order = std::make_shared<VertexOrder>();
+      if(order->compute(vertexNumber, scalars, offsets, threadNumber))
+        return nullptr;
+
+      if(!useVertexOrderCache_)
+        return order;
+
+      // most recently used first
+      vertexOrders_.insert(vertexOrders_.begin(), order);
+      if(vertexOrders_.size() > maxVertexOrderNumber_)
+        vertexOrders_.pop_back();
+
+      return order;
+    }
+
+    /// Release the vertex orders cached by getVertexOrder(). The orders
+    /// still referenced by a filter are freed when it releases them.
+    inline void clearVertexOrders() {
+      vertexOrders_.clear();
+    }
+
+    /// Enable or disable the caching of the vertex orders (enabled by
+    /// default). When disabled, getVertexOrder() sorts the field at each
+    /// call and the cached orders are released.
+    inline void setVertexOrderCaching(const bool &useVertexOrderCache) {
+      useVertexOrderCache_ = useVertexOrderCache;
+      if(!useVertexOrderCache_)
+        vertexOrders_.clear();
+    }
+
     /// \warning
     /// YOU SHOULD NOT CALL THIS FUNCTION UNLESS YOU REALLY KNOW WHAT YOU ARE
     /// DOING.
@@ -1227,6 +1352,10 @@ namespace ttk {
     /// \note It is recommended to exclude such a pre-processing step
     /// from any time performance measurement.
     /// \return Returns a pointer to the triangle list.
+    /// \warning Not available on explicit triangulations, which only store
+    /// the compressed form of the relation (NULL is returned).
+    /// \sa getTrianglesView(), which provides the same information without
+    /// building any list.
     inline const std::vector<std::vector<SimplexId>> *getTriangles() override {
 #ifndef TTK_ENABLE_KAMIKAZE
       if(isEmptyCheck())
@@ -1367,6 +1496,10 @@ namespace ttk {
     /// from any time performance measurement.
     /// \return Returns a pointer to the triangle edge list.
     /// \sa getCellEdges()
+    /// \warning Not available on explicit triangulations, which only store
+    /// the compressed form of the relation (NULL is returned).
+    /// \sa getTriangleEdgesView(), which provides the same information without
+    /// building any list.
     inline const std::vector<std::vector<SimplexId>> *
       getTriangleEdges() override {
 #ifndef TTK_ENABLE_KAMIKAZE
@@ -1505,6 +1638,10 @@ namespace ttk {
     /// \note It is recommended to exclude such a pre-processing step
     /// from any time performance measurement.
     /// \return Returns a pointer to the triangle link list.
+    /// \warning Not available on explicit triangulations, which only store
+    /// the compressed form of the relation (NULL is returned).
+    /// \sa getTriangleLinksView(), which provides the same information without
+    /// building any list.
     inline const std::vector<std::vector<SimplexId>> *
       getTriangleLinks() override {
 #ifndef TTK_ENABLE_KAMIKAZE
@@ -1638,6 +1775,10 @@ namespace ttk {
     /// \note It is recommended to exclude such a pre-processing step
     /// from any time performance measurement.
     /// \return Returns a pointer to the triangle star list.
+    /// \warning Not available on explicit triangulations, which only store
+    /// the compressed form of the relation (NULL is returned).
+    /// \sa getTriangleStarsView(), which provides the same information without
+    /// building any list.
     inline const std::vector<std::vector<SimplexId>> *
       getTriangleStars() override {
 #ifndef TTK_ENABLE_KAMIKAZE
@@ -1831,6 +1972,10 @@ namespace ttk {
     /// from any time performance measurement.
     /// \return Returns a pointer to the vertex edge list.
     /// \sa getVertexStars()
+    /// \warning Not available on explicit triangulations, which only store
+    /// the compressed form of the relation (NULL is returned).
+    /// \sa getVertexEdgesView(), which provides the same information without
+    /// building any list.
     inline const std::vector<std::vector<SimplexId>> *
       getVertexEdges() override {
 #ifndef TTK_ENABLE_KAMIKAZE
@@ -1961,6 +2106,10 @@ namespace ttk {
     /// \note It is recommended to exclude such a pre-processing step
     /// from any time performance measurement.
     /// \return Returns a pointer to the vertex link list.
+    /// \warning Not available on explicit triangulations, which only store
+    /// the compressed form of the relation (NULL is returned).
+    /// \sa getVertexLinksView(), which provides the same information without
+    /// building any list.
     inline const std::vector<std::vector<SimplexId>> *
       getVertexLinks() override {
 
@@ -2079,6 +2228,10 @@ namespace ttk {
     /// \note It is recommended to exclude such a pre-processing step
     /// from any time performance measurement.
     /// \return Returns a pointer to the vertex neighbor list.
+    /// \warning Not available on explicit triangulations, which only store
+    /// the compressed form of the relation (NULL is returned).
+    /// \sa getVertexNeighborsView(), which provides the same information
+    /// without building any list.
     inline const std::vector<std::vector<SimplexId>> *
       getVertexNeighbors() override {
 #ifndef TTK_ENABLE_KAMIKAZE
@@ -2227,6 +2380,10 @@ namespace ttk {
     /// \note It is recommended to exclude such a pre-processing step
     /// from any time performance measurement.
     /// \return Returns a pointer to the vertex star list.
+    /// \warning Not available on explicit triangulations, which only store
+    /// the compressed form of the relation (NULL is returned).
+    /// \sa getVertexStarsView(), which provides the same information without
+    /// building any list.
     inline const std::vector<std::vector<SimplexId>> *
       getVertexStars() override {
 #ifndef TTK_ENABLE_KAMIKAZE
@@ -2373,6 +2530,10 @@ namespace ttk {
     /// from any time performance measurement.
     /// \return Returns a pointer to the vertex triangle list.
     /// \sa getVertexStars()
+    /// \warning Not available on explicit triangulations, which only store
+    /// the compressed form of the relation (NULL is returned).
+    /// \sa getVertexTrianglesView(), which provides the same information
+    /// without building any list.
     inline const std::vector<std::vector<SimplexId>> *
       getVertexTriangles() override {
 
@@ -3120,6 +3281,20 @@ namespace ttk {
       return abstractTriangulation_->getTetraIncenter(tetraId, incenter);
     };
 
+    /// Enable the on-disk cache of the preprocessed tables of explicit
+    /// triangulations (empty string: disabled).
+    /// \param cacheDirectory Existing directory where to store the tables.
+    /// Cache files are keyed by a hash of the input cells, so that a
+    /// subsequent run on the same mesh (for instance with a different
+    /// scalar field) can skip the preprocessing.
+    /// \return Returns 0 upon success, negative values otherwise.
+    ///
+    /// \note The cache can also be enabled with the environment variable
+    /// TTK_TRIANGULATION_CACHE_DIR.
+    inline int setCacheDirectory(const std::string &cacheDirectory) {
+      return explicitTriangulation_.setCacheDirectory(cacheDirectory);
+    }
+
     /// Tune the debug level (default: 0)
     inline int setDebugLevel(const int &debugLevel) override {
       explicitTriangulation_.setDebugLevel(debugLevel);
@@ -3191,6 +3366,7 @@ namespace ttk {
       gridDimensions_[0] = xDim;
       gridDimensions_[1] = yDim;
       gridDimensions_[2] = zDim;
+      vertexOrders_.clear();
 
       int retPeriodic = periodicImplicitTriangulation_.setInputGrid(
         xOrigin, yOrigin, zOrigin, xSpacing, ySpacing, zSpacing, xDim, yDim,
@@ -3236,6 +3412,16 @@ namespace ttk {
       return usePeriodicBoundaries_;
     }
 
+    /// Store the position class of each vertex of a (non-periodic) regular
+    /// grid with regard to its boundary, one byte per vertex, upon the
+    /// pre-processing of the vertex neighbors or stars. By default, these
+    /// classes are computed on the fly from the vertex coordinates, which
+    /// keeps the memory footprint of the grid negligible.
+    /// \sa ttk::ImplicitTriangulation::setVertexPositionTable()
+    inline void setVertexPositionTable(const bool &useVertexPositionTable) {
+      implicitTriangulation_.setVertexPositionTable(useVertexPositionTable);
+    }
+
     /// Set the input 3D points of the triangulation.
     /// \param pointNumber Number of input vertices.
     /// \param pointSet Pointer to the 3D points. This pointer should point to
@@ -3258,6 +3444,7 @@ namespace ttk {
 
       abstractTriangulation_ = &explicitTriangulation_;
       gridDimensions_[0] = gridDimensions_[1] = gridDimensions_[2] = -1;
+      vertexOrders_.clear();
       return explicitTriangulation_.setInputPoints(
         pointNumber, pointSet, doublePrecision);
     }
@@ -3299,6 +3486,11 @@ namespace ttk {
     ImplicitTriangulation implicitTriangulation_;
     PeriodicImplicitTriangulation periodicImplicitTriangulation_;
     bool usePeriodicBoundaries_;
+
+    bool useVertexOrderCache_;
+    // cached vertex orders, most recently used first (see getVertexOrder())
+    std::vector<std::shared_ptr<const VertexOrder>> vertexOrders_;
+    static const size_t maxVertexOrderNumber_ = 4;
   };
 } // namespace ttk
 
@@ -11,6 +11,7 @@ vtkStandardNewMacro(ttkDistanceField)
   OutputScalarFieldName = "OutputDistanceField";
   ForceInputVertexScalarField = false;
   InputVertexScalarFieldName = ttk::VertexScalarFieldName;
+  DeltaStepping = 0;
   UseAllCores = true;
   SetNumberOfInputPorts(2);
 
@@ -150,6 +151,7 @@ int ttkDistanceField::doIt(vector<vtkDataSet *> &inputs,
     identifiers_->GetVoidPointer(0));
   distanceField_.setOutputIdentifiers(origin->GetVoidPointer(0));
   distanceField_.setOutputSegmentation(seg->GetVoidPointer(0));
+  distanceField_.setDeltaStepping(DeltaStepping);
 
   vtkDataArray *distanceScalars{};
   switch(OutputScalarFieldType) {
@@ -87,6 +87,9 @@ public:
   vtkSetMacro(InputVertexScalarFieldName, std::string);
   vtkGetMacro(InputVertexScalarFieldName, std::string);
 
+  vtkSetMacro(DeltaStepping, double);
+  vtkGetMacro(DeltaStepping, double);
+
   int getTriangulation(vtkDataSet *input);
   int getIdentifiers(vtkDataSet *input);
 
@@ -104,6 +107,7 @@ private:
   std::string OutputScalarFieldName;
   bool ForceInputVertexScalarField;
   std::string InputVertexScalarFieldName;
+  double DeltaStepping;
 
   ttk::DistanceField distanceField_;
   ttk::Triangulation *triangulation_;
@@ -42,41 +42,6 @@ namespace ttk {
 #endif
         return arr;
       }
-
-      inline static CriticalType
-        getNodeType(FTMTree_MT &tree, const idNode nodeId, Params params) {
-        const Node *node = tree.getNode(nodeId);
-        int upDegree{};
-        int downDegree{};
-        if(params.treeType == TreeType::Join
-           or params.treeType == TreeType::Contour) {
-          upDegree = node->getNumberOfUpSuperArcs();
-          downDegree = node->getNumberOfDownSuperArcs();
-        } else {
-          downDegree = node->getNumberOfUpSuperArcs();
-          upDegree = node->getNumberOfDownSuperArcs();
-        }
-        int degree = upDegree + downDegree;
-
-        // saddle point
-        if(degree > 1) {
-          if(upDegree == 2 and downDegree == 1)
-            return CriticalType::Saddle2;
-          else if(upDegree == 1 and downDegree == 2)
-            return CriticalType::Saddle1;
-          else if(upDegree == 1 and downDegree == 1)
-            return CriticalType::Regular;
-          else
-            return CriticalType::Degenerate;
-        }
-        // local extremum
-        else {
-          if(upDegree)
-            return CriticalType::Local_minimum;
-          else
-            return CriticalType::Local_maximum;
-        }
-      }
     };
 
     struct ArcData : public WrapperData {
@@ -279,8 +244,7 @@ namespace ttk {
         ids->SetTuple1(arrIdx, idOffset + nodeId);
         scalars->SetTuple1(arrIdx, cellScalar);
         vertIds->SetTuple1(arrIdx, g_vertexId);
-        type->SetTuple1(
-          arrIdx, static_cast<int>(getNodeType(*tree, nodeId, params)));
+        type->SetTuple1(arrIdx, static_cast<int>(tree->getNodeType(nodeId)));
 
         if(params.advStats) {
           idSuperArc saId = getAdjSa(node);
@@ -396,7 +360,6 @@ namespace ttk {
         const Node *upNode = tree->getNode(upNodeId);
         const SimplexId l_upVertexId = upNode->getVertexId();
         const SimplexId g_upVertexId = idMapper->GetTuple1(l_upVertexId);
-        const CriticalType upNodeType = getNodeType(*tree, upNodeId, params);
         float coordUp[3];
         triangulation->getVertexPoint(
           l_upVertexId, coordUp[0], coordUp[1], coordUp[2]);
@@ -405,8 +368,6 @@ namespace ttk {
         const Node *downNode = tree->getNode(downNodeId);
         const SimplexId l_downVertexId = downNode->getVertexId();
         const SimplexId g_downVertexId = idMapper->GetTuple1(l_downVertexId);
-        const CriticalType downNodeType
-          = getNodeType(*tree, downNodeId, params);
         float coordDown[3];
         triangulation->getVertexPoint(
           l_downVertexId, coordDown[0], coordDown[1], coordDown[2]);
@@ -417,26 +378,7 @@ namespace ttk {
 
         idSuperArc nid = arc->getNormalizedId();
 
-        ArcType regionType;
-        // RegionType
-        if(upNodeType == CriticalType::Local_minimum
-           && downNodeType == CriticalType::Local_maximum) {
-          regionType = ArcType::Min_arc;
-        } else if(upNodeType == CriticalType::Local_minimum
-                  || downNodeType == CriticalType::Local_minimum) {
-          regionType = ArcType::Min_arc;
-        } else if(upNodeType == CriticalType::Local_maximum
-                  || downNodeType == CriticalType::Local_maximum) {
-          regionType = ArcType::Max_arc;
-        } else if(upNodeType == CriticalType::Saddle1
-                  && downNodeType == CriticalType::Saddle1) {
-          regionType = ArcType::Saddle1_arc;
-        } else if(upNodeType == CriticalType::Saddle2
-                  && downNodeType == CriticalType::Saddle2) {
-          regionType = ArcType::Saddle2_arc;
-        } else {
-          regionType = ArcType::Saddle1_saddle2_arc;
-        }
+        const ArcType regionType = tree->getArcType(arcId);
 
         // fill extrema and regular verts of this arc
 
@@ -474,6 +416,78 @@ namespace ttk {
         }
       }
 
+      // direct segmentation: arc ids and region types are written by the
+      // base layer in the output arrays (inPlace) or in local arrays then
+      // scattered with idMapper, without per-arc vertex lists
+      void fillArrayDirect(LocalFTM &l_tree,
+                           Triangulation *triangulation,
+                           vtkDataArray *idMapper,
+                           const bool inPlace,
+                           Params params) {
+        if(!params.segm)
+          return;
+
+        FTMTree_MT *tree = l_tree.tree.getTree(params.treeType);
+        const idNode idOffset = l_tree.offset;
+        const SimplexId nbVert = tree->getNumberOfVertices();
+
+        std::vector<SimplexId> localIds;
+        std::vector<char> localTypes;
+        SimplexId *arcIds;
+        char *regionTypes;
+        if(inPlace) {
+          arcIds = static_cast<SimplexId *>(ids->GetVoidPointer(0));
+          regionTypes = typeRegion->GetPointer(0);
+        } else {
+          localIds.resize(nbVert);
+          localTypes.resize(nbVert);
+          arcIds = localIds.data();
+          regionTypes = localTypes.data();
+        }
+
+        std::vector<SimplexId> regionSizes;
+        tree->getVertexSegmentation(
+          arcIds, regionTypes, params.advStats ? &regionSizes : nullptr);
+
+        // span of each segmentation id
+        std::vector<double> regionSpans;
+        if(params.advStats) {
+          const idSuperArc nbArcs = tree->getNumberOfSuperArcs();
+          regionSpans.resize(nbArcs);
+          for(idSuperArc arcId = 0; arcId < nbArcs; ++arcId) {
+            SuperArc *arc = tree->getSuperArc(arcId);
+            float coordUp[3], coordDown[3];
+            triangulation->getVertexPoint(
+              tree->getNode(arc->getUpNodeId())->getVertexId(), coordUp[0],
+              coordUp[1], coordUp[2]);
+            triangulation->getVertexPoint(
+              tree->getNode(arc->getDownNodeId())->getVertexId(), coordDown[0],
+              coordDown[1], coordDown[2]);
+            const idSuperArc sid
+              = params.normalize ? arc->getNormalizedId() : arcId;
+            regionSpans[sid] = Geometry::distance(coordUp, coordDown);
+          }
+        }
+
+        if(inPlace && !params.advStats && !idOffset)
+          return;
+
+        for(SimplexId v = 0; v < nbVert; ++v) {
+          const SimplexId g_vertexId
+            = inPlace ? v : idMapper->GetTuple1(v);
+          // isolated vertices are marked with -1, as in place
+          const SimplexId sid = arcIds[v];
+          ids->SetTuple1(g_vertexId, sid != -1 ? idOffset + sid : -1);
+          typeRegion->SetTuple1(g_vertexId, regionTypes[v]);
+          if(params.advStats) {
+            sizeRegion->SetTuple1(
+              g_vertexId, sid != -1 ? regionSizes[sid] : 0);
+            spanRegion->SetTuple1(
+              g_vertexId, sid != -1 ? regionSpans[sid] : 0);
+          }
+        }
+      }
+
       void addArray(vtkPointData *pointData, Params params) {
         if(!params.segm)
           return;
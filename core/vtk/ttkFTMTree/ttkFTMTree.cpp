@@ -373,10 +373,18 @@ int ttkFTMTree::doIt(vector<vtkDataSet *> &inputs,
     ftmTree_[cc].tree.setVertexSoSoffsets(offsets_[cc].data());
     ftmTree_[cc].tree.setTreeType(GetTreeType());
     ftmTree_[cc].tree.setSegmentation(GetWithSegmentation());
+    ftmTree_[cc].tree.setDirectSegmentation(GetWithDirectSegmentation());
     ftmTree_[cc].tree.setNormalizeIds(GetWithNormalize());
 
+    int ret = 0;
     switch(inputScalars_[cc]->GetDataType()) {
-      vtkTemplateMacro((ftmTree_[cc].tree.build<VTK_TT, SimplexId>()));
+      vtkTemplateMacro((ret = ftmTree_[cc].tree.build<VTK_TT, SimplexId>()));
+    }
+    if(ret) {
+#ifndef TTK_ENABLE_KAMIKAZE
+      cerr << "[ttkFTMTree] Error : tree computation failed." << endl;
+#endif
+      return -1;
     }
 
     ftmTree_[cc].offset = acc_nbNodes;
@@ -527,6 +535,12 @@ int ttkFTMTree::getSegmentation(vtkDataSet *outputSegmentation) {
     vtkDataArray *idMapper
       = connected_components_[cc]->GetPointData()->GetArray(
         ttk::VertexScalarFieldName);
+    if(params_.directSegm) {
+      // a single component shares the ids of the output
+      vertData.fillArrayDirect(
+        ftmTree_[cc], triangulation_[cc], idMapper, nbCC_ == 1, params_);
+      continue;
+    }
     const idSuperArc numberOfSuperArcs = tree->getNumberOfSuperArcs();
     // #pragma omp for
     for(idSuperArc arcId = 0; arcId < numberOfSuperArcs; ++arcId) {
@@ -93,6 +93,15 @@ public:
     return params_.segm;
   }
 
+  void SetWithDirectSegmentation(const bool direct) {
+    params_.directSegm = direct;
+    Modified();
+  }
+
+  bool GetWithDirectSegmentation(void) const {
+    return params_.directSegm;
+  }
+
   void SetWithNormalize(const bool norm) {
     params_.normalize = norm;
     Modified();
@@ -9,6 +9,7 @@ vtkStandardNewMacro(ttkIntegralLines)
   : hasUpdatedMesh_{false}, inputScalars_{nullptr}, offsets_{nullptr},
     inputOffsets_{nullptr}, identifiers_{nullptr} {
   Direction = 0;
+  StopAtTracedVertices = false;
   SetNumberOfInputPorts(2);
   triangulation_ = NULL;
 
@@ -159,7 +160,7 @@ int ttkIntegralLines::getIdentifiers(vtkPointSet *input) {
 }
 
 int ttkIntegralLines::getTrajectories(vtkDataSet *input,
-                                      vector<vector<SimplexId>> &trajectories,
+                                      const FlatJaggedArray &trajectories,
                                       vtkUnstructuredGrid *output) {
   vtkSmartPointer<vtkUnstructuredGrid> ug
     = vtkSmartPointer<vtkUnstructuredGrid>::New();
@@ -190,8 +191,9 @@ int ttkIntegralLines::getTrajectories(vtkDataSet *input,
   float p1[3];
   vtkIdType ids[2];
   for(SimplexId i = 0; i < (SimplexId)trajectories.size(); ++i) {
-    if(trajectories[i].size()) {
-      SimplexId vertex = trajectories[i][0];
+    const FlatJaggedArray::Slice trajectory = trajectories[i];
+    if(trajectory.size()) {
+      SimplexId vertex = trajectory[0];
       // init
       triangulation_->getVertexPoint(vertex, p0[0], p0[1], p0[2]);
       ids[0] = pts->InsertNextPoint(p0);
@@ -202,8 +204,8 @@ int ttkIntegralLines::getTrajectories(vtkDataSet *input,
       for(unsigned int k = 0; k < scalarArrays.size(); ++k)
         inputScalars[k]->InsertNextTuple1(scalarArrays[k]->GetTuple1(vertex));
 
-      for(SimplexId j = 1; j < (SimplexId)trajectories[i].size(); ++j) {
-        vertex = trajectories[i][j];
+      for(SimplexId j = 1; j < (SimplexId)trajectory.size(); ++j) {
+        vertex = trajectory[j];
         triangulation_->getVertexPoint(vertex, p1[0], p1[1], p1[2]);
         ids[1] = pts->InsertNextPoint(p1);
         // distanceScalars
@@ -319,11 +321,12 @@ int ttkIntegralLines::doIt(vector<vtkDataSet *> &inputs,
   }
 #endif
 
-  vector<vector<SimplexId>> trajectories;
+  FlatJaggedArray trajectories;
 
   integralLines_.setVertexNumber(numberOfPointsInDomain);
   integralLines_.setSeedNumber(numberOfPointsInSeeds);
   integralLines_.setDirection(Direction);
+  integralLines_.setStopAtTracedVertices(StopAtTracedVertices);
   integralLines_.setInputScalarField(inputScalars_->GetVoidPointer(0));
   integralLines_.setInputOffsets(inputOffsets_->GetVoidPointer(0));
 
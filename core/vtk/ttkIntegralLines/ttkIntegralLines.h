@@ -82,6 +82,9 @@ public:
   vtkSetMacro(OutputScalarFieldType, int);
   vtkGetMacro(OutputScalarFieldType, int);
 
+  vtkSetMacro(StopAtTracedVertices, int);
+  vtkGetMacro(StopAtTracedVertices, int);
+
   vtkSetMacro(ForceInputVertexScalarField, int);
   vtkGetMacro(ForceInputVertexScalarField, int);
 
@@ -99,7 +102,7 @@ public:
   int getOffsets(vtkDataSet *input);
   int getIdentifiers(vtkPointSet *input);
   int getTrajectories(vtkDataSet *input,
-                      std::vector<std::vector<ttk::SimplexId>> &trajectories,
+                      const ttk::FlatJaggedArray &trajectories,
                       vtkUnstructuredGrid *output);
 
   template <typename VTK_TT>
@@ -119,6 +122,7 @@ private:
   std::string ScalarField;
   int Direction;
   int OutputScalarFieldType;
+  int StopAtTracedVertices;
   bool ForceInputVertexScalarField;
   std::string InputVertexScalarFieldName;
   int OffsetScalarFieldId;
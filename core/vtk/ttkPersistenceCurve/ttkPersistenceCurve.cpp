@@ -21,6 +21,7 @@ vtkStandardNewMacro(ttkPersistenceCurve)
   InputOffsetScalarFieldName = ttk::OffsetScalarFieldName;
   ForceInputOffsetScalarField = false;
   ComputeSaddleConnectors = false;
+  PersistenceThreshold = 0;
   UseAllCores = true;
 
   inputTriangulation_ = vtkSmartPointer<ttkTriangulationFilter>::New();
@@ -312,6 +313,7 @@ int ttkPersistenceCurve::doIt(vtkDataSet *input,
   persistenceCurve_.setInputScalars(inputScalars_->GetVoidPointer(0));
   persistenceCurve_.setInputOffsets(inputOffsets_->GetVoidPointer(0));
   persistenceCurve_.setComputeSaddleConnectors(ComputeSaddleConnectors);
+  persistenceCurve_.setPersistenceThreshold(PersistenceThreshold);
   switch(inputScalars_->GetDataType()) {
     vtkTemplateMacro(ret = dispatch<VTK_TT>());
   }
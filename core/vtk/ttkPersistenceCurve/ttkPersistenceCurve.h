@@ -99,6 +99,9 @@ public:
   vtkSetMacro(ComputeSaddleConnectors, int);
   vtkGetMacro(ComputeSaddleConnectors, int);
 
+  vtkSetMacro(PersistenceThreshold, double);
+  vtkGetMacro(PersistenceThreshold, double);
+
   vtkTable *GetOutput();
   vtkTable *GetOutput(int);
 
@@ -137,6 +140,7 @@ private:
   std::string InputOffsetScalarFieldName;
   bool ForceInputOffsetScalarField;
   bool ComputeSaddleConnectors;
+  double PersistenceThreshold;
 
   ttk::PersistenceCurve persistenceCurve_;
   ttk::Triangulation *triangulation_;
@@ -19,6 +19,8 @@ vtkStandardNewMacro(ttkPersistenceDiagram)
   InputOffsetScalarFieldName = ttk::OffsetScalarFieldName;
   ForceInputOffsetScalarField = false;
   ComputeSaddleConnectors = false;
+  UseUnionFind = false;
+  PersistenceThreshold = 0;
   UseAllCores = true;
   ShowInsideDomain = false;
   computeDiagram_ = true;
@@ -299,6 +301,8 @@ int ttkPersistenceDiagram::doIt(vector<vtkDataSet *> &inputs,
   persistenceDiagram_.setInputScalars(inputScalars_->GetVoidPointer(0));
   persistenceDiagram_.setInputOffsets(inputOffsets_->GetVoidPointer(0));
   persistenceDiagram_.setComputeSaddleConnectors(ComputeSaddleConnectors);
+  persistenceDiagram_.setUseUnionFind(UseUnionFind);
+  persistenceDiagram_.setPersistenceThreshold(PersistenceThreshold);
   switch(inputScalars_->GetDataType()) {
     vtkTemplateMacro(ret = dispatch<VTK_TT>());
   }
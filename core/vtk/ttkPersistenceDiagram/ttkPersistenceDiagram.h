@@ -128,6 +128,20 @@ public:
   }
   vtkGetMacro(ComputeSaddleConnectors, int);
 
+  void SetUseUnionFind(int data) {
+    UseUnionFind = data;
+    Modified();
+    computeDiagram_ = true;
+  }
+  vtkGetMacro(UseUnionFind, int);
+
+  void SetPersistenceThreshold(double data) {
+    PersistenceThreshold = data;
+    Modified();
+    computeDiagram_ = true;
+  }
+  vtkGetMacro(PersistenceThreshold, double);
+
   void SetInputOffsetScalarFieldName(std::string data) {
     InputOffsetScalarFieldName = data;
     Modified();
@@ -222,6 +236,8 @@ private:
   std::string InputOffsetScalarFieldName;
   bool ForceInputOffsetScalarField;
   bool ComputeSaddleConnectors;
+  bool UseUnionFind;
+  double PersistenceThreshold;
   int ShowInsideDomain;
   bool PeriodicBoundaryConditions;
 
@@ -23,12 +23,15 @@ vtkStandardNewMacro(ttkPersistenceDiagramClustering)
   TimeLimit = 9999999;
   NumberOfClusters = 1;
   Deterministic = 1;
+  UseJacobi = false;
   ThreadNumber = 1;
   PairTypeClustering = -1;
   numberOfInputsFromCommandLine = 1;
   UseProgressive = 1;
   UseAccelerated = 0;
   UseKmeansppInit = 0;
+  UseMiniBatch = false;
+  MiniBatchSize = 100;
   Alpha = 1;
   DeltaLim = 0.01;
   Lambda = 1;
@@ -80,6 +83,11 @@ int ttkPersistenceDiagramClustering::dispatch(
   vtkUnstructuredGrid *outputMatchings) {
 
   int ret{};
+  // the diagrams are read from disk by the mini-batch clustering
+  const bool streaming = !diagramFileNames_.empty() && Method == 0;
+  if(streaming) {
+    numInputs = diagramFileNames_.size();
+  }
   vector<vector<macroDiagramTuple>> *intermediateDiagrams;
   vector<vector<vector<macroMatchingTuple>>> *all_matchings;
   vector<vector<macroDiagramTuple>> *final_centroids;
@@ -114,7 +122,7 @@ int ttkPersistenceDiagramClustering::dispatch(
   if(needUpdate_) {
 
     max_dimension_total_ = 0;
-    for(int i = 0; i < numInputs; i++) {
+    for(int i = 0; i < numInputs && !streaming; i++) {
       double max_dimension = getPersistenceDiagram<VTK_TT>(
         &(intermediateDiagrams->at(i)), inputDiagram[i], Spacing, 0);
       if(max_dimension_total_ < max_dimension) {
@@ -134,6 +142,7 @@ int ttkPersistenceDiagramClustering::dispatch(
       }
       persistenceDiagramsClustering.setWasserstein(wassersteinMetric);
       persistenceDiagramsClustering.setDeterministic(Deterministic);
+      persistenceDiagramsClustering.setUseJacobi(UseJacobi);
       persistenceDiagramsClustering.setForceUseOfAlgorithm(ForceUseOfAlgorithm);
       persistenceDiagramsClustering.setPairTypeClustering(PairTypeClustering);
       persistenceDiagramsClustering.setNumberOfInputs(numInputs);
@@ -148,12 +157,52 @@ int ttkPersistenceDiagramClustering::dispatch(
       persistenceDiagramsClustering.setNumberOfClusters(NumberOfClusters);
       persistenceDiagramsClustering.setUseAccelerated(UseAccelerated);
       persistenceDiagramsClustering.setUseKmeansppInit(UseKmeansppInit);
+      persistenceDiagramsClustering.setUseMiniBatch(UseMiniBatch);
+      persistenceDiagramsClustering.setMiniBatchSize(MiniBatchSize);
       persistenceDiagramsClustering.setDistanceWritingOptions(
         DistanceWritingOptions);
 
+      if(streaming) {
+        persistenceDiagramsClustering.setUseMiniBatch(true);
+        // called concurrently for the diagrams of a batch: one reader per
+        // diagram
+        persistenceDiagramsClustering.setDiagramReader(
+          [this](const int i, vector<macroDiagramTuple> &diagram) {
+            vtkSmartPointer<vtkXMLUnstructuredGridReader> reader
+              = vtkSmartPointer<vtkXMLUnstructuredGridReader>::New();
+            reader->SetFileName(diagramFileNames_[i].data());
+            reader->Update();
+            vtkUnstructuredGrid *grid = reader->GetOutput();
+            if(!grid || !grid->GetCellData()->GetArray("PairIdentifier")) {
+              stringstream msg;
+              msg << "[ttkPersistenceDiagramClustering] Could not read a "
+                  << "persistence diagram from `" << diagramFileNames_[i]
+                  << "'." << endl;
+              dMsg(cerr, msg.str(), fatalMsg);
+              return -1;
+            }
+            diagram.clear();
+            const double max_dimension
+              = getPersistenceDiagram<VTK_TT>(&diagram, grid, Spacing, 0);
+            if(max_dimension < 0) {
+              return -2;
+            }
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp critical(ttkPersistenceDiagramClusteringReader)
+#endif
+            {
+              if(max_dimension_total_ < max_dimension) {
+                max_dimension_total_ = max_dimension;
+              }
+            }
+            return 0;
+          });
+      }
+
       persistenceDiagramsClustering.setDiagrams((void *)intermediateDiagrams);
-      inv_clustering_
-        = persistenceDiagramsClustering.execute(final_centroids, all_matchings);
+      // the matchings of all the diagrams would not fit in memory either
+      inv_clustering_ = persistenceDiagramsClustering.execute(
+        final_centroids, streaming ? NULL : all_matchings);
 
       needUpdate_ = false;
     }
@@ -192,6 +241,27 @@ int ttkPersistenceDiagramClustering::dispatch(
     }
   }
 
+  if(streaming) {
+    // the clustered diagrams and the matchings would hold every diagram
+    vtkWarningMacro("[ttkPersistenceDiagramClustering] Diagrams read from "
+                    "disk: the clustered diagrams and the matchings are not "
+                    "computed. The cluster of each diagram is given by the "
+                    "field data array `ClusterId' of the first output.");
+    vtkSmartPointer<vtkIntArray> clusterIds
+      = vtkSmartPointer<vtkIntArray>::New();
+    clusterIds->SetName("ClusterId");
+    clusterIds->SetNumberOfTuples(inv_clustering_.size());
+    for(size_t i = 0; i < inv_clustering_.size(); i++) {
+      clusterIds->SetValue(i, inv_clustering_[i]);
+    }
+    outputClusters->Initialize();
+    outputClusters->GetFieldData()->AddArray(clusterIds);
+    outputMatchings->Initialize();
+    outputCentroids->ShallowCopy(createOutputCentroids<VTK_TT>(
+      final_centroids, inv_clustering_, max_dimension_total_, Spacing));
+    return ret;
+  }
+
   outputMatchings->ShallowCopy(
     createMatchings(final_centroids, inv_clustering_, *intermediateDiagrams,
                     all_matchings, max_dimension_total_, Spacing));
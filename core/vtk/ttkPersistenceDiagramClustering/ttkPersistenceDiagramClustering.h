@@ -13,6 +13,11 @@
 /// Proc. of IEEE VIS 2019.\n
 /// IEEE Transactions on Visualization and Computer Graphics, 2019.
 ///
+/// With setDiagramFileNames(), the diagrams are read from disk batch after
+/// batch (in parallel within a batch) by the mini-batch clustering: only the
+/// centroids and the cluster of each diagram are produced, not the clustered
+/// diagrams nor the matchings.
+///
 /// \sa PersistenceDiagramClustering
 
 #ifndef _TTK_PERSISTENCEDIAGRAMSCLUSTERING_H
@@ -37,6 +42,7 @@
 #include <vtkDataSet.h>
 #include <vtkDataSetAlgorithm.h>
 #include <vtkDoubleArray.h>
+#include <vtkFieldData.h>
 #include <vtkFiltersCoreModule.h>
 #include <vtkFloatArray.h>
 #include <vtkInformation.h>
@@ -47,6 +53,7 @@
 #include <vtkSmartPointer.h>
 #include <vtkTable.h>
 #include <vtkUnstructuredGrid.h>
+#include <vtkXMLUnstructuredGridReader.h>
 
 // ttk code includes
 #include <PersistenceDiagramClustering.h>
@@ -74,6 +81,15 @@ public:
     numberOfInputsFromCommandLine = number;
     SetNumberOfInputPorts(number);
   }
+  /// Diagrams (*.vtu) read from disk one batch at a time by the mini-batch
+  /// clustering, instead of the inputs. Only the centroids and the cluster
+  /// of each diagram (field data "ClusterId" of the first output) are
+  /// produced.
+  void setDiagramFileNames(const std::vector<std::string> &fileNames) {
+    diagramFileNames_ = fileNames;
+    Modified();
+    needUpdate_ = true;
+  }
   static ttkPersistenceDiagramClustering *New();
 
   vtkTypeMacro(ttkPersistenceDiagramClustering, vtkDataSetAlgorithm);
@@ -194,6 +210,20 @@ public:
   }
   vtkGetMacro(UseKmeansppInit, bool);
 
+  void SetUseMiniBatch(bool data) {
+    UseMiniBatch = data;
+    Modified();
+    needUpdate_ = true;
+  }
+  vtkGetMacro(UseMiniBatch, bool);
+
+  void SetMiniBatchSize(int data) {
+    MiniBatchSize = data;
+    Modified();
+    needUpdate_ = true;
+  }
+  vtkGetMacro(MiniBatchSize, int);
+
   void SetForceUseOfAlgorithm(bool data) {
     ForceUseOfAlgorithm = data;
     Modified();
@@ -208,6 +238,13 @@ public:
   }
   vtkGetMacro(Deterministic, bool);
 
+  void SetUseJacobi(bool data) {
+    UseJacobi = data;
+    Modified();
+    needUpdate_ = true;
+  }
+  vtkGetMacro(UseJacobi, bool);
+
   void SetPairTypeClustering(int data) {
     PairTypeClustering = data;
     Modified();
@@ -314,9 +351,11 @@ private:
   // vtkUnstructuredGrid* output_centroids_;
 
   int numberOfInputsFromCommandLine;
+  std::vector<std::string> diagramFileNames_;
   int PairTypeClustering;
   bool ForceUseOfAlgorithm;
   bool Deterministic;
+  bool UseJacobi;
   bool UseAllCores;
   int ThreadNumber;
   bool UseOutputMatching;
@@ -337,6 +376,8 @@ private:
   int NumberOfClusters;
   bool UseAccelerated;
   bool UseKmeansppInit;
+  bool UseMiniBatch;
+  int MiniBatchSize;
 
   std::string ScalarField;
   std::string WassersteinMetric;
@@ -0,0 +1,202 @@
+#include <ttkPersistenceDiagramDistanceMatrix.h>
+
+#include <iomanip>
+
+using namespace std;
+using namespace ttk;
+
+vtkStandardNewMacro(ttkPersistenceDiagramDistanceMatrix)
+
+  template <typename dataType>
+  int ttkPersistenceDiagramDistanceMatrix::getPersistenceDiagram(
+    std::vector<diagramTuple> &diagram,
+    vtkUnstructuredGrid *CTPersistenceDiagram_) {
+
+  vtkIntArray *vertexIdentifierScalars
+    = vtkIntArray::SafeDownCast(CTPersistenceDiagram_->GetPointData()->GetArray(
+      ttk::VertexScalarFieldName));
+  vtkIntArray *nodeTypeScalars = vtkIntArray::SafeDownCast(
+    CTPersistenceDiagram_->GetPointData()->GetArray("CriticalType"));
+  vtkIntArray *pairIdentifierScalars = vtkIntArray::SafeDownCast(
+    CTPersistenceDiagram_->GetCellData()->GetArray("PairIdentifier"));
+  vtkIntArray *extremumIndexScalars = vtkIntArray::SafeDownCast(
+    CTPersistenceDiagram_->GetCellData()->GetArray("PairType"));
+  vtkDoubleArray *persistenceScalars = vtkDoubleArray::SafeDownCast(
+    CTPersistenceDiagram_->GetCellData()->GetArray("Persistence"));
+  vtkDoubleArray *birthScalars = vtkDoubleArray::SafeDownCast(
+    CTPersistenceDiagram_->GetPointData()->GetArray("Birth"));
+  vtkDoubleArray *deathScalars = vtkDoubleArray::SafeDownCast(
+    CTPersistenceDiagram_->GetPointData()->GetArray("Death"));
+  vtkFloatArray *critCoordinates = vtkFloatArray::SafeDownCast(
+    CTPersistenceDiagram_->GetPointData()->GetArray("Coordinates"));
+  vtkPoints *points = CTPersistenceDiagram_->GetPoints();
+
+  if(!vertexIdentifierScalars || !nodeTypeScalars || !pairIdentifierScalars
+     || !extremumIndexScalars || !persistenceScalars || !critCoordinates
+     || !points || !deathScalars != !birthScalars) {
+    return -1;
+  }
+
+  const int pairingsSize = pairIdentifierScalars->GetNumberOfTuples();
+  diagram.clear();
+  diagram.reserve(pairingsSize);
+
+  for(int i = 0; i < pairingsSize; ++i) {
+    if(pairIdentifierScalars->GetValue(i) == -1) {
+      continue;
+    }
+
+    const double *critCoords1 = critCoordinates->GetTuple3(2 * i);
+    const float coordX1 = critCoords1[0];
+    const float coordY1 = critCoords1[1];
+    const float coordZ1 = critCoords1[2];
+    const double *critCoords2 = critCoordinates->GetTuple3(2 * i + 1);
+    const float coordX2 = critCoords2[0];
+    const float coordY2 = critCoords2[1];
+    const float coordZ2 = critCoords2[2];
+
+    const dataType value1 = !birthScalars
+                              ? (dataType)points->GetPoint(2 * i)[0]
+                              : (dataType)birthScalars->GetValue(2 * i);
+    const dataType value2 = !deathScalars
+                              ? (dataType)points->GetPoint(2 * i + 1)[1]
+                              : (dataType)deathScalars->GetValue(2 * i + 1);
+
+    // the global min-max pair is given the types of a min-max pair, as in
+    // ttkPersistenceDiagramClustering
+    const bool isGlobalPair = (pairIdentifierScalars->GetValue(i) == 0);
+    const CriticalType nodeType1
+      = isGlobalPair ? CriticalType::Local_minimum
+                     : (CriticalType)nodeTypeScalars->GetValue(2 * i);
+    const CriticalType nodeType2
+      = isGlobalPair ? CriticalType::Local_maximum
+                     : (CriticalType)nodeTypeScalars->GetValue(2 * i + 1);
+
+    diagram.push_back(std::make_tuple(
+      vertexIdentifierScalars->GetValue(2 * i), nodeType1,
+      vertexIdentifierScalars->GetValue(2 * i + 1), nodeType2,
+      (dataType)persistenceScalars->GetValue(i),
+      extremumIndexScalars->GetValue(i), value1, coordX1, coordY1, coordZ1,
+      value2, coordX2, coordY2, coordZ2));
+  }
+
+  return 0;
+}
+
+int ttkPersistenceDiagramDistanceMatrix::doIt(
+  std::vector<vtkUnstructuredGrid *> &inputDiagrams, vtkTable *output) {
+  Memory m;
+
+  using dataType = double;
+  const int numberOfInputs = inputDiagrams.size();
+  vector<vector<diagramTuple>> diagrams(numberOfInputs);
+  for(int i = 0; i < numberOfInputs; ++i) {
+    if(getPersistenceDiagram<dataType>(diagrams[i], inputDiagrams[i])) {
+      stringstream msg;
+      msg << "[ttkPersistenceDiagramDistanceMatrix] Input " << i
+          << " is not a persistence diagram." << endl;
+      dMsg(cerr, msg.str(), fatalMsg);
+      return -1;
+    }
+  }
+
+  PersistenceDiagramDistanceMatrix<dataType> distanceMatrix;
+  distanceMatrix.setWrapper(this);
+  if(distanceMatrix.setWasserstein(WassersteinMetric)) {
+    return -1;
+  }
+  distanceMatrix.setAlpha(Alpha);
+  distanceMatrix.setLambda(Lambda);
+  distanceMatrix.setDeltaLim(DeltaLim);
+  distanceMatrix.setPairType(PairType);
+  distanceMatrix.setDistanceThreshold(DistanceThreshold);
+  distanceMatrix.setNumberOfNeighbors(NumberOfNeighbors);
+  distanceMatrix.setUseJacobi(UseJacobi);
+  distanceMatrix.setNumberOfInputs(numberOfInputs);
+  distanceMatrix.setDiagrams((void *)&diagrams);
+
+  vector<vector<dataType>> distances;
+  vector<vector<char>> exactMask;
+  const int ret = distanceMatrix.execute(distances, &exactMask);
+  if(ret) {
+    return ret;
+  }
+
+  for(int j = 0; j < numberOfInputs; ++j) {
+    stringstream name;
+    name << "Diagram" << setw(3) << setfill('0') << j;
+    vtkSmartPointer<vtkDoubleArray> column
+      = vtkSmartPointer<vtkDoubleArray>::New();
+    column->SetName(name.str().data());
+    column->SetNumberOfTuples(numberOfInputs);
+    for(int i = 0; i < numberOfInputs; ++i) {
+      column->SetValue(i, distances[i][j]);
+    }
+    output->AddColumn(column);
+  }
+
+  // kept out of the columns, which are read as a matrix downstream: tuple i
+  // tells which entries of row i are exact distances (the others are bounds)
+  vtkSmartPointer<vtkCharArray> exact = vtkSmartPointer<vtkCharArray>::New();
+  exact->SetName("ExactEntries");
+  exact->SetNumberOfComponents(numberOfInputs);
+  exact->SetNumberOfTuples(numberOfInputs);
+  for(int i = 0; i < numberOfInputs; ++i) {
+    for(int j = 0; j < numberOfInputs; ++j) {
+      exact->SetComponent(i, j, exactMask[i][j]);
+    }
+  }
+  output->GetFieldData()->AddArray(exact);
+
+  {
+    stringstream msg;
+    msg << "[ttkPersistenceDiagramDistanceMatrix] Memory usage: "
+        << m.getElapsedUsage() << " MB." << endl;
+    dMsg(cout, msg.str(), memoryMsg);
+  }
+
+  return 0;
+}
+
+bool ttkPersistenceDiagramDistanceMatrix::needsToAbort() {
+  return GetAbortExecute();
+}
+
+int ttkPersistenceDiagramDistanceMatrix::updateProgress(const float &progress) {
+
+  {
+    stringstream msg;
+    msg << "[ttkPersistenceDiagramDistanceMatrix] " << progress * 100
+        << "% processed...." << endl;
+    dMsg(cout, msg.str(), advancedInfoMsg);
+  }
+
+  UpdateProgress(progress);
+  return 0;
+}
+
+int ttkPersistenceDiagramDistanceMatrix::RequestData(
+  vtkInformation *request,
+  vtkInformationVector **inputVector,
+  vtkInformationVector *outputVector) {
+
+  const int numberOfInputs = inputVector[0]->GetNumberOfInformationObjects();
+  std::vector<vtkUnstructuredGrid *> inputDiagrams(numberOfInputs);
+  for(int i = 0; i < numberOfInputs; ++i) {
+    inputDiagrams[i] = vtkUnstructuredGrid::SafeDownCast(
+      vtkDataSet::GetData(inputVector[0], i));
+    if(!inputDiagrams[i]) {
+      return 0;
+    }
+  }
+
+  vtkInformation *outInfo = outputVector->GetInformationObject(0);
+  vtkTable *output
+    = vtkTable::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
+
+  if(doIt(inputDiagrams, output)) {
+    return 0;
+  }
+
+  return 1;
+}
@@ -0,0 +1,190 @@
+/// \ingroup vtk
+/// \class ttkPersistenceDiagramDistanceMatrix
+///
+/// \brief TTK VTK-filter that computes the matrix of the Wasserstein
+/// distances between the persistence diagrams of an ensemble.
+///
+/// \param Input Persistence diagrams (vtkUnstructuredGrid, repeatable)
+/// \param Output Distance matrix (vtkTable), one column per diagram
+///
+/// When a distance threshold or a number of neighbours is given, the
+/// entries that are not refined hold a lower bound of the distance, which is
+/// already above the threshold or the k-th nearest neighbour distance of
+/// their row. The field data array ExactEntries (one component per column)
+/// masks the exact entries of each row. The output can be given to
+/// ttkDimensionReduction.
+///
+/// This filter can be used as any other VTK filter (for instance, by using the
+/// sequence of calls SetInputData(), Update(), GetOutput()).
+///
+/// \sa ttk::PersistenceDiagramDistanceMatrix
+#pragma once
+
+#ifndef diagramTuple
+#define diagramTuple                                                       \
+  std::tuple<ttk::SimplexId, ttk::CriticalType, ttk::SimplexId,            \
+             ttk::CriticalType, dataType, ttk::SimplexId, dataType, float, \
+             float, float, dataType, float, float, float>
+#endif
+
+// VTK includes
+#include <vtkCellData.h>
+#include <vtkCharArray.h>
+#include <vtkDataSet.h>
+#include <vtkDoubleArray.h>
+#include <vtkFieldData.h>
+#include <vtkFiltersCoreModule.h>
+#include <vtkFloatArray.h>
+#include <vtkInformation.h>
+#include <vtkInformationVector.h>
+#include <vtkIntArray.h>
+#include <vtkObjectFactory.h>
+#include <vtkPointData.h>
+#include <vtkSmartPointer.h>
+#include <vtkTable.h>
+#include <vtkTableAlgorithm.h>
+#include <vtkUnstructuredGrid.h>
+
+// ttk code includes
+#include <PersistenceDiagramDistanceMatrix.h>
+#include <ttkWrapper.h>
+
+#ifndef TTK_PLUGIN
+class VTKFILTERSCORE_EXPORT ttkPersistenceDiagramDistanceMatrix
+#else
+class ttkPersistenceDiagramDistanceMatrix
+#endif
+  : public vtkTableAlgorithm,
+    public ttk::Wrapper {
+
+public:
+  static ttkPersistenceDiagramDistanceMatrix *New();
+  vtkTypeMacro(ttkPersistenceDiagramDistanceMatrix, vtkTableAlgorithm)
+
+    // default ttk setters
+    vtkSetMacro(debugLevel_, int);
+
+  void SetThreadNumber(int threadNumber) {
+    ThreadNumber = threadNumber;
+    SetThreads();
+  }
+
+  void SetThreads() {
+    if(!UseAllCores)
+      threadNumber_ = ThreadNumber;
+    else {
+      threadNumber_ = ttk::OsCall::getNumberOfCores();
+    }
+    Modified();
+  }
+
+  void SetUseAllCores(bool onOff) {
+    UseAllCores = onOff;
+    SetThreads();
+  }
+  // end of default ttk setters
+
+  vtkSetMacro(WassersteinMetric, std::string);
+  vtkGetMacro(WassersteinMetric, std::string);
+
+  void SetAlpha(double data) {
+    if(data > 0 && data <= 1) {
+      Alpha = data;
+    } else if(data > 1) {
+      Alpha = 1;
+    } else {
+      Alpha = 0.001;
+    }
+    Modified();
+  }
+  vtkGetMacro(Alpha, double);
+
+  void SetAntiAlpha(double data) {
+    SetAlpha(1 - data);
+  }
+
+  vtkSetMacro(Lambda, double);
+  vtkGetMacro(Lambda, double);
+
+  vtkSetMacro(DeltaLim, double);
+  vtkGetMacro(DeltaLim, double);
+
+  vtkSetMacro(PairType, int);
+  vtkGetMacro(PairType, int);
+
+  vtkSetMacro(DistanceThreshold, double);
+  vtkGetMacro(DistanceThreshold, double);
+
+  vtkSetMacro(NumberOfNeighbors, int);
+  vtkGetMacro(NumberOfNeighbors, int);
+
+  vtkSetMacro(UseJacobi, bool);
+  vtkGetMacro(UseJacobi, bool);
+
+  int FillInputPortInformation(int port, vtkInformation *info) override {
+    switch(port) {
+      case 0:
+        info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(),
+                  "vtkUnstructuredGrid");
+        info->Set(vtkAlgorithm::INPUT_IS_REPEATABLE(), 1);
+        break;
+    }
+
+    return 1;
+  }
+
+  int FillOutputPortInformation(int port, vtkInformation *info) override {
+    switch(port) {
+      case 0:
+        info->Set(vtkDataObject::DATA_TYPE_NAME(), "vtkTable");
+        break;
+    }
+
+    return 1;
+  }
+
+protected:
+  ttkPersistenceDiagramDistanceMatrix() {
+    WassersteinMetric = "2";
+    Alpha = 1;
+    Lambda = 1;
+    DeltaLim = 0.01;
+    PairType = -1;
+    DistanceThreshold = -1;
+    NumberOfNeighbors = 0;
+    UseJacobi = false;
+
+    UseAllCores = true;
+    ThreadNumber = 1;
+  }
+
+  ~ttkPersistenceDiagramDistanceMatrix(){};
+
+  int RequestData(vtkInformation *request,
+                  vtkInformationVector **inputVector,
+                  vtkInformationVector *outputVector) override;
+
+private:
+  std::string WassersteinMetric;
+  double Alpha;
+  double Lambda;
+  double DeltaLim;
+  int PairType;
+  double DistanceThreshold;
+  int NumberOfNeighbors;
+  bool UseJacobi;
+
+  bool UseAllCores;
+  int ThreadNumber;
+
+  template <typename dataType>
+  int getPersistenceDiagram(std::vector<diagramTuple> &diagram,
+                            vtkUnstructuredGrid *CTPersistenceDiagram_);
+
+  int doIt(std::vector<vtkUnstructuredGrid *> &inputDiagrams,
+           vtkTable *output);
+
+  bool needsToAbort() override;
+
+  int updateProgress(const float &progress) override;
+};
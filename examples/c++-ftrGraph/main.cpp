@@ -0,0 +1,88 @@
+/// \ingroup examples
+///
+/// \brief C++-only stress benchmark of the Reeb graph computation
+/// (ttk::ftr::FTRGraph) on a synthetic field.
+///
+/// A noisy sinusoid is sampled on a regular grid (2D or 3D): its level sets
+/// are made of many large contours, which makes the dynamic graph tracking
+/// them (ttk::ftr::DynamicGraph) the bottleneck of the computation. The
+/// noise adds small critical points, and thus many short-lived contours.
+/// The segmentation is not computed and the preprocessing of the
+/// triangulation is not timed.
+
+// include the local headers
+#include <CommandLineParser.h>
+#include <FTRGraph.h>
+
+#include <cmath>
+#include <numeric>
+#include <random>
+
+int main(int argc, char **argv) {
+
+  int size = 40, dimension = 3, threadNumber = 1;
+  double periods = 3, noise = 0.1;
+  ttk::CommandLineParser parser;
+
+  ttk::globalDebugLevel_ = 3;
+
+  // register the arguments to the command line parser
+  parser.setArgument("n", &size, "Number of vertices along each axis", true);
+  parser.setArgument("d", &dimension, "Dimension of the grid (2 or 3)", true);
+  parser.setArgument(
+    "p", &periods, "Number of periods of the sinusoid along each axis", true);
+  parser.setArgument(
+    "e", &noise, "Amplitude of the uniform noise added to the field", true);
+  parser.setArgument("t", &threadNumber, "Number of threads", true);
+  // parse
+  parser.parse(argc, argv);
+
+  ttk::Debug d;
+
+  // generating the grid
+  ttk::Triangulation triangulation;
+  triangulation.setInputGrid(
+    0, 0, 0, 1, 1, 1, size, size, dimension == 3 ? size : 1);
+  const ttk::SimplexId vertexNumber = triangulation.getNumberOfVertices();
+
+  // sampling the field, with a fixed seed for the runs to be comparable
+  std::vector<float> field(vertexNumber);
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> distribution(-noise, noise);
+  const double frequency = 2 * M_PI * periods / size;
+  for(ttk::SimplexId i = 0; i < vertexNumber; ++i) {
+    const int x = i % size, y = (i / size) % size, z = i / (size * size);
+    double value = std::sin(frequency * x) * std::sin(frequency * y);
+    if(dimension == 3) {
+      value *= std::sin(frequency * z);
+    }
+    field[i] = value + distribution(generator);
+  }
+  std::vector<ttk::SimplexId> offsets(vertexNumber);
+  std::iota(offsets.begin(), offsets.end(), 0);
+
+  // computing the Reeb graph
+  ttk::ftr::FTRGraph<float> ftrGraph(&triangulation);
+  ttk::ftr::Params params;
+  params.segm = false;
+  params.threadNumber = threadNumber;
+  ftrGraph.setParams(params);
+  ftrGraph.setScalars(field.data());
+  ftrGraph.setVertexSoSoffsets(&offsets);
+
+  ttk::Timer t;
+  ftrGraph.build();
+  const double time = t.getElapsedTime();
+
+  ttk::ftr::Graph graph = std::move(ftrGraph.extractOutputGraph());
+  {
+    std::stringstream msg;
+    msg << "[main] Reeb graph of a " << size << "^" << dimension
+        << " grid: " << graph.getNumberOfNodes() << " nodes, "
+        << graph.getNumberOfArcs() << " arcs, in " << time << " s ("
+        << threadNumber << " thread(s))." << std::endl;
+    d.dMsg(std::cout, msg.str(), d.timeMsg);
+  }
+
+  return 0;
+}
@@ -7,9 +7,26 @@
 using namespace std;
 using namespace ttk;
 
+// With the streaming option, only the first input goes through the
+// pipeline: the clustering reads all of them from disk, batch after batch.
+class PersistenceDiagramClusteringProgram
+  : public vtkProgram<ttkPersistenceDiagramClustering> {
+
+public:
+  int streamInputs_{0};
+
+protected:
+  int load(const vector<string> &inputPaths) override {
+    if(!streamInputs_ || inputPaths.empty())
+      return ttkProgramBase::load(inputPaths);
+    ttkObject_->setDiagramFileNames(inputPaths);
+    return ttkProgramBase::load(vector<string>(1, inputPaths[0]));
+  }
+};
+
 int main(int argc, char **argv) {
 
-  vtkProgram<ttkPersistenceDiagramClustering> program;
+  PersistenceDiagramClusteringProgram program;
 
   // specify local parameters to the TTK module with default values.
   double timeLimit = -1;
@@ -23,6 +40,7 @@ int main(int argc, char **argv) {
   int method = 0;
   int use_prog = 1;
   int write_distances = 0;
+  int miniBatchSize = 0;
 
   // register these arguments to the command line parser
   program.parser_.setArgument("M", &method, "Select algorithm", true);
@@ -36,6 +54,14 @@ int main(int argc, char **argv) {
   program.parser_.setArgument(
     "A", &accelerated, "Use the kmean acceleration", true);
   program.parser_.setArgument("I", &kmeanspp, "Use the kmeanspp init.", true);
+  program.parser_.setArgument(
+    "B", &miniBatchSize,
+    "Mini-batch KMeans with batches of this size (0: disabled)", true);
+  program.parser_.setArgument(
+    "S", &program.streamInputs_,
+    "Read the input diagrams from disk batch after batch (mini-batch KMeans, "
+    "outputs the centroids and the cluster of each diagram only)",
+    true);
   program.parser_.setArgument(
     "K", &numberOfClusters, "Number of Clusters", true);
   program.parser_.setArgument(
@@ -73,6 +99,10 @@ int main(int argc, char **argv) {
   program.ttkObject_->SetUseAccelerated(accelerated);
   program.ttkObject_->SetPairTypeClustering(pairType);
   program.ttkObject_->SetUseKmeansppInit(kmeanspp);
+  program.ttkObject_->SetUseMiniBatch(miniBatchSize > 0);
+  if(miniBatchSize > 0) {
+    program.ttkObject_->SetMiniBatchSize(miniBatchSize);
+  }
   program.ttkObject_->SetTimeLimit(timeLimit);
   program.ttkObject_->SetAlpha(geometry_penalization);
   program.ttkObject_->SetNumberOfClusters(numberOfClusters);